@@ -0,0 +1,75 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+/* Usage: bench_flat_map.out [n ...]. The default sizes stay within a few
+ * hundred MB; pass 100000000 to reproduce the 100M run (about 5 GB for
+ * s21::map plus 1 GB for flat_map). */
+
+static const size_t kLookups = 1000000;
+
+template <typename Fn>
+double elapsed_ns(Fn fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(stop - start).count();
+}
+
+template <typename Map>
+void lookups(const char *name, Map &m, const std::vector<int> &probes) {
+  long long sum = 0;
+  double ns = elapsed_ns([&] {
+    for (int key : probes) sum += m.contains(key);
+  });
+  std::printf("  %-24s %8.1f ns/lookup (hits %lld)\n", name,
+              ns / probes.size(), sum);
+}
+
+void run(size_t n) {
+  std::printf("n=%zu\n", n);
+  std::vector<int> keys(n);
+  std::iota(keys.begin(), keys.end(), 0);
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+
+  std::vector<int> probes(kLookups);
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<int> dist(0, int(2 * n - 1));
+  for (int &probe : probes) probe = dist(gen);
+
+  {
+    std::vector<std::pair<int, int>> items(n);
+    for (size_t i = 0; i < n; ++i) items[i] = {keys[i], int(i)};
+
+    s21::flat_map<int, int> flat;
+    double ns = elapsed_ns([&] {
+      flat = s21::flat_map<int, int>(items.begin(), items.end());
+    });
+    std::printf("  %-24s %8.1f ns/element\n", "flat_map bulk build", ns / n);
+    lookups("flat_map::contains", flat, probes);
+  }
+  {
+    s21::map<int, int> tree;
+    double ns = elapsed_ns([&] {
+      for (size_t i = 0; i < n; ++i) tree.insert(keys[i], int(i));
+    });
+    std::printf("  %-24s %8.1f ns/element\n", "map insert", ns / n);
+    lookups("map::contains", tree, probes);
+  }
+}
+
+int main(int argc, char **argv) {
+  if (argc > 1) {
+    for (int i = 1; i < argc; ++i) run(std::strtoull(argv[i], nullptr, 10));
+  } else {
+    for (size_t n : {1000u, 1000000u}) run(n);
+  }
+  return 0;
+}
@@ -0,0 +1,80 @@
+#include <chrono>
+#include <cstdio>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../s21_containers.h"
+
+/* Connections cycle idle -> active -> closing -> idle, one random
+ * connection at a time, as a server moves them between state lists */
+struct Connection {
+  int id;
+  int state;
+  std::string peer;
+  char buffer[128];
+  s21::list_hook hook;
+
+  explicit Connection(int i = 0)
+      : id(i), state(0), peer("10.0.0." + std::to_string(i)), buffer() {}
+};
+
+static const int kConnections = 4096;
+static const int kMoves = 2000000;
+
+static std::vector<int> picks() {
+  std::mt19937 gen(5);
+  std::vector<int> result(kMoves);
+  for (int &pick : result) pick = int(gen() % kConnections);
+  return result;
+}
+
+template <typename Fn>
+void measure(const char *name, Fn fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto stop = std::chrono::steady_clock::now();
+  double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+  std::printf("%-40s %8.1f ns/move\n", name, ns / kMoves);
+}
+
+int main() {
+  std::vector<int> order = picks();
+
+  measure("std::list<Connection *> erase+push_back", [&] {
+    /* every move frees a node and allocates one, and the element's
+     * position has to be kept on the side */
+    using List = std::list<Connection *>;
+    std::vector<Connection> pool;
+    for (int i = 0; i < kConnections; ++i) pool.emplace_back(i);
+    List lists[3];
+    std::vector<List::iterator> where;
+    for (Connection &c : pool) {
+      lists[0].push_back(&c);
+      where.push_back(--lists[0].end());
+    }
+    for (int pick : order) {
+      Connection &c = pool[pick];
+      lists[c.state].erase(where[pick]);
+      c.state = (c.state + 1) % 3;
+      lists[c.state].push_back(&c);
+      where[pick] = --lists[c.state].end();
+    }
+  });
+
+  measure("s21::intrusive_list splice", [&] {
+    using List = s21::intrusive_list<Connection, &Connection::hook>;
+    std::vector<Connection> pool;
+    for (int i = 0; i < kConnections; ++i) pool.emplace_back(i);
+    List lists[3];
+    for (Connection &c : pool) lists[0].push_back(c);
+    for (int pick : order) {
+      Connection &c = pool[pick];
+      List &from = lists[c.state];
+      c.state = (c.state + 1) % 3;
+      lists[c.state].splice(lists[c.state].end(), from, from.iterator_to(c));
+    }
+  });
+  return 0;
+}
@@ -0,0 +1,75 @@
+#include <chrono>
+#include <cstdio>
+#include <list>
+#include <memory>
+#include <random>
+
+#include "../s21_containers.h"
+
+static const int kNodes = 2000000;
+
+/* Bump allocator over one buffer that is reset between measurements, so
+ * every list starts from the same node layout whatever ran before it */
+struct Arena {
+  static std::unique_ptr<char[]> buffer;
+  static size_t used;
+};
+std::unique_ptr<char[]> Arena::buffer(new char[size_t(kNodes) * 64]);
+size_t Arena::used = 0;
+
+template <typename T>
+struct ArenaAllocator {
+  using value_type = T;
+
+  ArenaAllocator() = default;
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U> &) {}
+
+  T *allocate(size_t n) {
+    size_t offset = (Arena::used + alignof(T) - 1) / alignof(T) * alignof(T);
+    Arena::used = offset + n * sizeof(T);
+    return reinterpret_cast<T *>(Arena::buffer.get() + offset);
+  }
+  void deallocate(T *, size_t) {}
+  bool operator==(const ArenaAllocator &) const { return true; }
+  bool operator!=(const ArenaAllocator &) const { return false; }
+};
+
+template <typename List, typename Fill, typename Sort>
+void measure(const char *name, Fill fill, Sort sort) {
+  Arena::used = 0;
+  List list;
+  fill(list);
+  auto start = std::chrono::steady_clock::now();
+  sort(list);
+  auto stop = std::chrono::steady_clock::now();
+  double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+  std::printf("%-36s %8.1f ns/element\n", name, ns / kNodes);
+}
+
+using StdList = std::list<int, ArenaAllocator<int>>;
+using S21List = s21::list<int, ArenaAllocator<int>>;
+
+int main() {
+  auto random = [](auto &list) {
+    std::mt19937 gen(1);
+    for (int i = 0; i < kNodes; ++i) list.push_back(int(gen()));
+  };
+  auto runs = [](auto &list) {
+    /* 64 presorted runs, alternately ascending and descending */
+    for (int i = 0; i < kNodes; ++i) {
+      int run = i / (kNodes / 64);
+      list.push_back(run % 2 ? -i : i);
+    }
+  };
+  auto sequential = [](auto &list) { list.sort(); };
+  auto parallel = [](auto &list) { list.parallel_sort(4u); };
+
+  measure<StdList>("std::list::sort (random)", random, sequential);
+  measure<S21List>("s21::list::sort (random)", random, sequential);
+  measure<S21List>("s21::list::parallel_sort (random)", random, parallel);
+  measure<StdList>("std::list::sort (64 runs)", runs, sequential);
+  measure<S21List>("s21::list::sort (64 runs)", runs, sequential);
+  measure<S21List>("s21::list::parallel_sort (64 runs)", runs, parallel);
+  return 0;
+}
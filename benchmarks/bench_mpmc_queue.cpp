@@ -0,0 +1,84 @@
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers.h"
+
+static const int kItems = 1 << 20;
+
+/* s21::queue behind a mutex and two condition variables, bounded like the
+ * lock-free queue so both sides block the same way */
+class LockedQueue {
+ public:
+  explicit LockedQueue(size_t capacity) : capacity_(capacity) {}
+
+  void push(int value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_full_.wait(lock, [&] { return queue_.size() < capacity_; });
+    queue_.push(value);
+    not_empty_.notify_one();
+  }
+  void pop(int &out) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_empty_.wait(lock, [&] { return !queue_.empty(); });
+    out = queue_.front();
+    queue_.pop();
+    not_full_.notify_one();
+  }
+
+ private:
+  size_t capacity_;
+  s21::queue<int> queue_;
+  std::mutex mutex_;
+  std::condition_variable not_full_, not_empty_;
+};
+
+/* Throughput of kItems values through the queue with the given number of
+ * producer and consumer threads */
+template <typename Queue>
+void run(const char *name, int producers, int consumers) {
+  Queue q(1024);
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; ++p) {
+    threads.emplace_back([&, p] {
+      for (int i = p; i < kItems; i += producers) q.push(i);
+    });
+  }
+  long long sum = 0;
+  std::mutex sum_mutex;
+  for (int c = 0; c < consumers; ++c) {
+    threads.emplace_back([&, c] {
+      long long local = 0;
+      int value = 0;
+      for (int i = c; i < kItems; i += consumers) {
+        q.pop(value);
+        local += value;
+      }
+      std::lock_guard<std::mutex> guard(sum_mutex);
+      sum += local;
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  auto stop = std::chrono::steady_clock::now();
+  double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+  std::printf("%-26s %dP/%dC %8.1f ns/item (%lld)\n", name, producers,
+              consumers, ns / kItems, sum);
+}
+
+int main() {
+  const int shapes[][2] = {{1, 1}, {4, 1}, {4, 4}};
+  for (auto &shape : shapes) {
+    run<LockedQueue>("s21::queue + mutex", shape[0], shape[1]);
+    if (shape[0] == 1 && shape[1] == 1) {
+      run<s21::spsc_queue<int>>("s21::spsc_queue", 1, 1);
+    } else if (shape[1] == 1) {
+      run<s21::mpsc_queue<int>>("s21::mpsc_queue", shape[0], 1);
+    }
+    run<s21::mpmc_queue<int>>("s21::mpmc_queue", shape[0], shape[1]);
+  }
+  return 0;
+}
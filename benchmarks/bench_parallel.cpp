@@ -0,0 +1,65 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers.h"
+
+/* Batch scoring: score every element of a large vector, then sum the
+ * scores and find the first outlier, sequentially and on pools of
+ * growing size. Speedups need as many cores as pool threads. */
+static const std::size_t kElements = 4000000;
+
+static double score(double x) { return 1.0 / (1.0 + std::exp(-x * 0.001)); }
+
+template <typename Fn>
+double measure(Fn fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+int main() {
+  s21::vector<double> values(kElements);
+  std::mt19937 gen(3);
+  std::uniform_real_distribution<double> dist(-5000, 5000);
+  for (std::size_t i = 0; i < kElements; ++i) values[i] = dist(gen);
+  s21::vector<double> scores(kElements);
+  std::vector<double> sorted;
+
+  double total = 0;
+  double ms = measure([&] {
+    for (std::size_t i = 0; i < kElements; ++i) scores[i] = score(values[i]);
+    for (std::size_t i = 0; i < kElements; ++i) total += scores[i];
+  });
+  std::printf("%-34s %8.1f ms (sum %.1f)\n", "sequential score+sum", ms, total);
+  ms = measure([&] {
+    sorted.assign(values.data(), values.data() + kElements);
+    std::sort(sorted.begin(), sorted.end());
+  });
+  std::printf("%-34s %8.1f ms\n", "std::sort", ms);
+
+  unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+  for (unsigned threads : {1u, 2u, 4u, hardware}) {
+    s21::parallel::thread_pool pool(threads);
+    s21::parallel::options opts;
+    opts.pool = &pool;
+    ms = measure([&] {
+      s21::parallel::transform(values, scores.data(), score, opts);
+      total = s21::parallel::reduce(scores, 0.0, opts);
+    });
+    std::printf("parallel score+sum, %2u threads    %8.1f ms (sum %.1f)\n",
+                threads, ms, total);
+    ms = measure([&] {
+      sorted.assign(values.data(), values.data() + kElements);
+      s21::parallel::sort(sorted.data(), sorted.data() + kElements, opts);
+    });
+    std::printf("parallel::sort, %2u threads        %8.1f ms\n", threads,
+                ms);
+  }
+  return 0;
+}
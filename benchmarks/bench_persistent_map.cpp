@@ -0,0 +1,67 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers.h"
+
+static const int kKeys = 100000;
+static const size_t kReads = 200000;
+
+/* Latency of one read while a writer thread keeps updating the map */
+template <typename Read, typename Write>
+void run(const char *name, Read read, Write write) {
+  std::atomic<bool> done(false);
+  std::thread writer([&] {
+    std::mt19937 gen(1);
+    for (int i = 0; !done; ++i) write(int(gen() % kKeys), i);
+  });
+
+  std::vector<double> ns(kReads);
+  std::mt19937 gen(2);
+  long long hits = 0;
+  for (double &sample : ns) {
+    int key = int(gen() % kKeys);
+    auto start = std::chrono::steady_clock::now();
+    hits += read(key);
+    auto stop = std::chrono::steady_clock::now();
+    sample = std::chrono::duration<double, std::nano>(stop - start).count();
+  }
+  done = true;
+  writer.join();
+
+  std::sort(ns.begin(), ns.end());
+  std::printf("%-34s p50 %8.0f ns  p99 %10.0f ns  p99.9 %10.0f ns (%lld)\n",
+              name, ns[kReads / 2], ns[kReads * 99 / 100],
+              ns[kReads * 999 / 1000], hits);
+}
+
+int main() {
+  s21::map<int, int> locked;
+  std::mutex mutex;
+  s21::persistent_map<int, int> persistent;
+  for (int i = 0; i < kKeys; i += 2) {
+    locked.insert(i, i);
+    persistent.insert(i, i);
+  }
+
+  run(
+      "s21::map + mutex",
+      [&](int key) {
+        std::lock_guard<std::mutex> guard(mutex);
+        return locked.contains(key);
+      },
+      [&](int key, int value) {
+        std::lock_guard<std::mutex> guard(mutex);
+        locked.insert_or_assign(key, value);
+      });
+  run(
+      "s21::persistent_map snapshot",
+      [&](int key) { return persistent.snapshot().contains(key); },
+      [&](int key, int value) { persistent.insert_or_assign(key, value); });
+  return 0;
+}
@@ -0,0 +1,70 @@
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+#include "../s21_containers.h"
+
+static const int kOps = 1 << 21;
+
+template <typename Fn>
+void measure(const char *name, Fn fn) {
+  auto start = std::chrono::steady_clock::now();
+  long long checksum = fn();
+  auto stop = std::chrono::steady_clock::now();
+  double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+  std::printf("%-34s %8.2f ns/op (%lld)\n", name, ns / kOps, checksum);
+}
+
+/* Steady state: the queue holds `depth` elements, every push is matched
+ * by a pop, so the list allocates and frees a node per operation */
+template <typename Queue, typename Make>
+long long steady(int depth, Make make) {
+  Queue q;
+  for (int i = 0; i < depth; ++i) q.push(make(i));
+  long long sum = 0;
+  for (int i = 0; i < kOps; ++i) {
+    q.push(make(i));
+    sum += long(sizeof(q.front()));
+    q.pop();
+  }
+  return sum + long(q.size());
+}
+
+/* Fill to kOps elements, then drain */
+template <typename Queue>
+long long fillDrain() {
+  Queue q;
+  for (int i = 0; i < kOps; ++i) q.push(i);
+  long long sum = 0;
+  while (!q.empty()) {
+    sum += q.front();
+    q.pop();
+  }
+  return sum;
+}
+
+int main() {
+  using DequeQueue = s21::queue<int>;
+  using ListQueue = s21::queue<int, s21::list<int>>;
+  auto number = [](int i) { return i; };
+  auto text = [](int i) { return std::string(24, char('a' + i % 26)); };
+
+  for (int depth : {16, 4096}) {
+    std::printf("steady state, depth %d\n", depth);
+    measure("  queue<int> (deque)",
+            [&] { return steady<DequeQueue>(depth, number); });
+    measure("  queue<int, list>",
+            [&] { return steady<ListQueue>(depth, number); });
+    measure("  queue<string> (deque)", [&] {
+      return steady<s21::queue<std::string>>(depth, text);
+    });
+    measure("  queue<string, list>", [&] {
+      return steady<s21::queue<std::string, s21::list<std::string>>>(depth,
+                                                                     text);
+    });
+  }
+  std::printf("fill %d then drain\n", kOps);
+  measure("  queue<int> (deque)", [] { return fillDrain<DequeQueue>(); });
+  measure("  queue<int, list>", [] { return fillDrain<ListQueue>(); });
+  return 0;
+}
@@ -0,0 +1,92 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "../s21_containers.h"
+
+/* Key that counts every comparison the tree performs on it */
+struct CountedKey {
+  static size_t comparisons;
+  int value;
+
+  CountedKey(int v = 0) : value(v) {}
+  bool operator<(const CountedKey &other) const {
+    ++comparisons;
+    return value < other.value;
+  }
+  bool operator==(const CountedKey &other) const {
+    ++comparisons;
+    return value == other.value;
+  }
+  bool operator!=(const CountedKey &other) const {
+    ++comparisons;
+    return value != other.value;
+  }
+};
+
+size_t CountedKey::comparisons = 0;
+
+template <typename Fn>
+void measure(const char *name, size_t n, Fn fn) {
+  CountedKey::comparisons = 0;
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto stop = std::chrono::steady_clock::now();
+  double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+  std::printf("%-28s n=%-8zu %8.2f cmp/insert %8.1f ns/insert\n", name, n,
+              double(CountedKey::comparisons) / n, ns / n);
+}
+
+int main() {
+  for (size_t n : {1000u, 100000u}) {
+    std::vector<int> keys(n);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+
+    measure("set::insert (random)", n, [&] {
+      s21::set<CountedKey> s;
+      for (int k : keys) s.insert(k);
+    });
+    measure("set::insert (duplicates)", n, [&] {
+      s21::set<CountedKey> s;
+      for (int k : keys) s.insert(k);
+      CountedKey::comparisons = 0;
+      for (int k : keys) s.insert(k);
+    });
+    measure("map::operator[] (random)", n, [&] {
+      s21::map<CountedKey, int> m;
+      for (int k : keys) m[k] = k;
+    });
+    measure("map::insert (random)", n, [&] {
+      s21::map<CountedKey, int> m;
+      for (int k : keys) m.insert(k, k);
+    });
+    measure("map::insert (sorted)", n, [&] {
+      s21::map<CountedKey, int> m;
+      for (size_t k = 0; k < n; ++k) m.insert(int(k), int(k));
+    });
+    measure("map::emplace_hint (sorted)", n, [&] {
+      s21::map<CountedKey, int> m;
+      for (size_t k = 0; k < n; ++k) {
+        m.emplace_hint(m.end(), CountedKey(int(k)), int(k));
+      }
+    });
+    std::vector<CountedKey> sorted(n);
+    std::iota(sorted.begin(), sorted.end(), 0);
+    measure("set(first, last) (sorted)", n,
+            [&] { s21::set<CountedKey> s(sorted.begin(), sorted.end()); });
+
+    /* per key of the small side: join-based merge only touches the big
+     * tree along the paths between the small tree's keys */
+    std::vector<CountedKey> sparse;
+    for (size_t k = 0; k < n; k += 64) sparse.push_back(int(k) * 2 + 1);
+    s21::set<CountedKey> big(sorted.begin(), sorted.end());
+    s21::set<CountedKey> small(sparse.begin(), sparse.end());
+    measure("set::merge (n / 64 keys)", sparse.size(),
+            [&] { big.merge(small); });
+  }
+  return 0;
+}
@@ -0,0 +1,40 @@
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#include "../s21_containers.h"
+
+/* Global allocation accounting: bytes requested through operator new */
+static size_t allocated_bytes = 0;
+
+void *operator new(std::size_t size) {
+  allocated_bytes += size;
+  void *ptr = std::malloc(size);
+  if (!ptr) throw std::bad_alloc();
+  return ptr;
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+
+template <typename Fill>
+void measure(const char *name, size_t n, Fill fill) {
+  size_t before = allocated_bytes;
+  fill(n);
+  std::printf("%-24s n=%-8zu %6.1f bytes/element\n", name, n,
+              double(allocated_bytes - before) / n);
+}
+
+int main() {
+  const size_t n = 100000;
+  measure("set<int>", n, [](size_t count) {
+    s21::set<int> s;
+    for (size_t i = 0; i < count; ++i) s.insert(int(i));
+  });
+  measure("map<int, std::string>", n, [](size_t count) {
+    s21::map<int, std::string> m;
+    for (size_t i = 0; i < count; ++i) m.insert(int(i), std::string());
+  });
+  return 0;
+}
@@ -0,0 +1,94 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <numeric>
+#include <vector>
+
+#include "../s21_containers.h"
+
+static const size_t kSize = 1 << 20;
+static const int kRounds = 200;
+
+template <typename Fn>
+double elapsed_ns(Fn fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(stop - start).count();
+}
+
+/* Throughput of one kernel in GB/s, best of three runs */
+template <typename Fn>
+void report(const char *name, size_t bytes, Fn fn) {
+  double best = 1e300;
+  for (int run = 0; run < 3; ++run) {
+    best = std::min(best, elapsed_ns([&] {
+      for (int round = 0; round < kRounds; ++round) {
+        fn();
+        asm volatile("" ::: "memory"); /* keep the scan inside the loop */
+      }
+    }));
+  }
+  std::printf("  %-28s %7.2f GB/s\n", name, double(bytes) * kRounds / best);
+}
+
+static const char *isaName(s21::simd::Isa isa) {
+  switch (isa) {
+    case s21::simd::Isa::kAvx512:
+      return "avx512";
+    case s21::simd::Isa::kAvx2:
+      return "avx2";
+    case s21::simd::Isa::kSse2:
+      return "sse2";
+    default:
+      return "scalar";
+  }
+}
+
+template <typename T>
+void run(const char *type) {
+  s21::vector<T> v(kSize), w(kSize);
+  for (size_t i = 0; i < kSize; ++i) {
+    v[i] = T(i % 100);
+    w[i] = T(i % 7);
+  }
+  std::vector<T> ref(v.data(), v.data() + kSize);
+  s21::vector<T> copy(v);
+  const size_t bytes = kSize * sizeof(T);
+  volatile double sink = 0;
+
+  std::printf("%s, %zu elements\n", type, kSize);
+  report("std::count", bytes,
+         [&] { sink = double(std::count(ref.begin(), ref.end(), T(200))); });
+  report("std::find", bytes, [&] {
+    sink = double(std::find(ref.begin(), ref.end(), T(200)) - ref.begin());
+  });
+  report("std::max_element", bytes,
+         [&] { sink = double(*std::max_element(ref.begin(), ref.end())); });
+  report("std::accumulate", bytes,
+         [&] { sink = double(std::accumulate(ref.begin(), ref.end(), T())); });
+
+  const s21::simd::Isa best = s21::simd::detected_isa();
+  for (s21::simd::Isa isa : {s21::simd::Isa::kScalar, s21::simd::Isa::kSse2,
+                             s21::simd::Isa::kAvx2, s21::simd::Isa::kAvx512}) {
+    if (isa > best) break;
+    s21::simd::set_isa(isa);
+    std::printf(" %s\n", isaName(isa));
+    report("count", bytes, [&] { sink = double(v.count(T(200))); });
+    report("find", bytes,
+           [&] { sink = double(v.find(T(200)) - v.begin()); });
+    report("max", bytes, [&] { sink = double(v.max()); });
+    report("sum", bytes, [&] { sink = double(v.sum()); });
+    report("dot", 2 * bytes, [&] { sink = double(v.dot(w)); });
+    report("compare", 2 * bytes, [&] { sink = double(v.compare(copy)); });
+    report("fill", bytes, [&] { w.fill(T(1)); });
+  }
+  s21::simd::set_isa(best);
+}
+
+int main() {
+  run<float>("float");
+  run<int>("int");
+  run<unsigned char>("unsigned char");
+  return 0;
+}
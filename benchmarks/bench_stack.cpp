@@ -0,0 +1,46 @@
+#include <chrono>
+#include <cstdio>
+#include <stack>
+#include <vector>
+
+#include "../s21_containers.h"
+
+static const int kStacks = 1 << 20;
+
+template <typename Fn>
+void measure(const char *name, Fn fn) {
+  auto start = std::chrono::steady_clock::now();
+  long long checksum = fn();
+  auto stop = std::chrono::steady_clock::now();
+  double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+  std::printf("%-28s %8.1f ns/stack (%lld)\n", name, ns / kStacks, checksum);
+}
+
+/* Many short-lived stacks, each pushed to `depth` and drained, as a DFS
+ * over a small graph would */
+template <typename Stack>
+long long shortLived(int depth) {
+  long long sum = 0;
+  for (int i = 0; i < kStacks; ++i) {
+    Stack s;
+    for (int k = 0; k < depth; ++k) s.push(i + k);
+    while (!s.empty()) {
+      sum += s.top();
+      s.pop();
+    }
+  }
+  return sum;
+}
+
+int main() {
+  for (int depth : {8, 64}) {
+    std::printf("depth %d\n", depth);
+    measure("  std::stack<int>",
+            [&] { return shortLived<std::stack<int>>(depth); });
+    measure("  s21::stack<int>",
+            [&] { return shortLived<s21::stack<int>>(depth); });
+    measure("  s21::small_stack<int, 16>",
+            [&] { return shortLived<s21::small_stack<int, 16>>(depth); });
+  }
+  return 0;
+}
@@ -0,0 +1,53 @@
+#include <chrono>
+#include <cstdio>
+#include <numeric>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+static const size_t kLookups = 1000000;
+
+template <typename Fn>
+double elapsed_ns(Fn fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(stop - start).count();
+}
+
+template <typename Map>
+void run(const char *name, const std::vector<int> &keys,
+         const std::vector<int> &probes) {
+  Map m;
+  double build = elapsed_ns([&] {
+    for (size_t i = 0; i < keys.size(); ++i) m[keys[i]] = int(i);
+  });
+  long long hits = 0;
+  double lookup = elapsed_ns([&] {
+    for (int key : probes) hits += m.find(key) != m.end();
+  });
+  std::printf("  %-24s %8.1f ns/insert %8.1f ns/lookup (hits %lld)\n", name,
+              build / keys.size(), lookup / probes.size(), hits);
+}
+
+int main() {
+  for (size_t n : {1000u, 1000000u}) {
+    std::printf("n=%zu\n", n);
+    std::vector<int> keys(n);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+
+    std::vector<int> probes(kLookups);
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> dist(0, int(2 * n - 1));
+    for (int &probe : probes) probe = dist(gen);
+
+    run<s21::unordered_map<int, int>>("s21::unordered_map", keys, probes);
+    run<std::unordered_map<int, int>>("std::unordered_map", keys, probes);
+    run<s21::map<int, int>>("s21::map", keys, probes);
+  }
+  return 0;
+}
@@ -0,0 +1,71 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+/* Global allocation accounting: bytes requested through operator new */
+static size_t allocated_bytes = 0;
+
+void *operator new(std::size_t size) {
+  allocated_bytes += size;
+  void *ptr = std::malloc(size);
+  if (!ptr) throw std::bad_alloc();
+  return ptr;
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+
+static const int kItems = 1 << 22;
+
+template <typename Fn>
+double timeNs(Fn fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(stop - start).count();
+}
+
+/* Memory, traversal and FIFO cost of kItems ints; the list nodes are
+ * shuffled in memory by interleaved pushes to a second list, as in a
+ * long-running work list */
+template <typename List>
+void run(const char *name) {
+  List list, noise;
+  size_t before = allocated_bytes;
+  std::mt19937 gen(3);
+  for (int i = 0; i < kItems; ++i) {
+    list.push_back(i);
+    if (gen() % 2) noise.push_back(i);
+  }
+  double bytes =
+      double(allocated_bytes - before) / (list.size() + noise.size());
+
+  long long sum = 0;
+  double traverse = timeNs([&] {
+    for (int value : list) sum += value;
+  });
+  double sorting = timeNs([&] { noise.sort(); });
+  double fifo = timeNs([&] {
+    for (int i = 0; i < kItems; ++i) {
+      sum += list.front();
+      list.pop_front();
+      list.push_back(i);
+    }
+  });
+  std::printf(
+      "%-26s %6.1f bytes/elem  traverse %5.2f ns  sort %6.1f ns  fifo "
+      "%5.2f ns (%lld)\n",
+      name, bytes, traverse / kItems, sorting / noise.size(), fifo / kItems,
+      sum);
+}
+
+int main() {
+  run<s21::list<int>>("s21::list<int>");
+  run<s21::unrolled_list<int>>("s21::unrolled_list<int>");
+  return 0;
+}
@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+"""Compare a Google Benchmark JSON run against a saved baseline.
+
+    compare.py BASELINE CURRENT [--threshold PERCENT] [--metric NAME]
+
+Prints the change of every benchmark found in both files and exits with
+status 1 if any got slower than the baseline by more than the threshold.
+Runs with --benchmark_repetitions are compared by their medians.
+"""
+
+import argparse
+import json
+import sys
+
+UNITS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load(path, metric):
+    """Nanoseconds per iteration by benchmark name, and the run context"""
+    with open(path) as f:
+        data = json.load(f)
+    runs, medians = {}, {}
+    for run in data.get("benchmarks", []):
+        if run.get("error_occurred"):
+            continue
+        name = run.get("run_name", run["name"])
+        ns = run[metric] * UNITS[run.get("time_unit", "ns")]
+        if run.get("run_type") == "aggregate":
+            if run.get("aggregate_name") == "median":
+                medians[name] = ns
+        else:
+            runs.setdefault(name, []).append(ns)
+    times = {name: sum(v) / len(v) for name, v in runs.items()}
+    times.update(medians)
+    return times, data.get("context", {})
+
+
+def warn_context(baseline, current):
+    for key in ("host_name", "num_cpus", "mhz_per_cpu", "library_build_type"):
+        if baseline.get(key) != current.get(key):
+            print("warning: %s differs: %s vs %s"
+                  % (key, baseline.get(key), current.get(key)))
+
+
+def fmt(ns):
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if ns >= scale:
+            return "%.2f %s" % (ns / scale, unit)
+    return "%.1f ns" % ns
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="slowdown in percent that counts as a "
+                             "regression (default 10)")
+    parser.add_argument("--metric", default="cpu_time",
+                        choices=("cpu_time", "real_time"))
+    parser.add_argument("--all", action="store_true",
+                        help="list unchanged benchmarks too")
+    args = parser.parse_args()
+
+    baseline, baseline_context = load(args.baseline, args.metric)
+    current, current_context = load(args.current, args.metric)
+    warn_context(baseline_context, current_context)
+
+    common = [name for name in current if name in baseline]
+    width = max([len(name) for name in common] + [9])
+    regressions = improvements = 0
+    print("%-*s %12s %12s %9s" % (width, "benchmark", "baseline", "current",
+                                  "change"))
+    for name in common:
+        change = (current[name] / baseline[name] - 1.0) * 100.0
+        if change > args.threshold:
+            regressions += 1
+            mark = "  REGRESSION"
+        elif change < -args.threshold:
+            improvements += 1
+            mark = "  faster"
+        elif args.all:
+            mark = ""
+        else:
+            continue
+        print("%-*s %12s %12s %+8.1f%%%s" % (width, name, fmt(baseline[name]),
+                                            fmt(current[name]), change, mark))
+
+    missing = len([name for name in baseline if name not in current])
+    added = len(current) - len(common)
+    print("\n%d compared, %d regressions and %d improvements beyond %g%%"
+          % (len(common), regressions, improvements, args.threshold))
+    if missing or added:
+        print("%d only in the baseline, %d only in the current run"
+              % (missing, added))
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
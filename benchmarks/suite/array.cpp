@@ -0,0 +1,23 @@
+#include <array>
+
+#include "suite.h"
+
+/* The size is part of the type, so each one is registered on its own */
+#define ARRAY_PAIR(fn, T, N)                        \
+  BENCHMARK_TEMPLATE(fn, std::array<T, N>)->Arg(N); \
+  BENCHMARK_TEMPLATE(fn, s21::array<T, N>)->Arg(N)
+
+#define ARRAY_ELEMENTS(fn)           \
+  ARRAY_PAIR(fn, int, 256);          \
+  ARRAY_PAIR(fn, int, 4096);         \
+  ARRAY_PAIR(fn, std::string, 256);  \
+  ARRAY_PAIR(fn, std::string, 4096); \
+  ARRAY_PAIR(fn, Blob, 256);         \
+  ARRAY_PAIR(fn, Blob, 4096)
+
+/* Insert assigns every slot of a fresh array; there is nothing to erase */
+ARRAY_ELEMENTS(Insert);
+ARRAY_ELEMENTS(Lookup);
+ARRAY_ELEMENTS(Iterate);
+ARRAY_ELEMENTS(Copy);
+ARRAY_ELEMENTS(Move);
@@ -0,0 +1,10 @@
+#include <list>
+
+#include "suite.h"
+
+/* No Lookup: neither list has random access or a find */
+SUITE_ELEMENTS(Insert, std::list, s21::list);
+SUITE_ELEMENTS(Iterate, std::list, s21::list);
+SUITE_ELEMENTS(Erase, std::list, s21::list);
+SUITE_ELEMENTS(Copy, std::list, s21::list);
+SUITE_ELEMENTS(Move, std::list, s21::list);
@@ -0,0 +1,20 @@
+#include <map>
+
+#include "suite.h"
+
+/* Keys of every element type, mapped to int */
+#define MAP_PAIR(fn, K)                                           \
+  BENCHMARK_TEMPLATE(fn, std::map<K, int>)->Apply(suite::sizes); \
+  BENCHMARK_TEMPLATE(fn, s21::map<K, int>)->Apply(suite::sizes)
+
+#define MAP_KEYS(fn)          \
+  MAP_PAIR(fn, int);          \
+  MAP_PAIR(fn, std::string); \
+  MAP_PAIR(fn, Blob)
+
+MAP_KEYS(Insert);
+MAP_KEYS(Lookup);
+MAP_KEYS(Iterate);
+MAP_KEYS(Erase);
+MAP_KEYS(Copy);
+MAP_KEYS(Move);
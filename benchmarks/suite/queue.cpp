@@ -0,0 +1,9 @@
+#include <queue>
+
+#include "suite.h"
+
+/* Adapters only reach their ends: no Lookup or Iterate */
+SUITE_ELEMENTS(Insert, std::queue, s21::queue);
+SUITE_ELEMENTS(Erase, std::queue, s21::queue);
+SUITE_ELEMENTS(Copy, std::queue, s21::queue);
+SUITE_ELEMENTS(Move, std::queue, s21::queue);
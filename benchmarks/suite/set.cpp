@@ -0,0 +1,10 @@
+#include <set>
+
+#include "suite.h"
+
+SUITE_ELEMENTS(Insert, std::set, s21::set);
+SUITE_ELEMENTS(Lookup, std::set, s21::set);
+SUITE_ELEMENTS(Iterate, std::set, s21::set);
+SUITE_ELEMENTS(Erase, std::set, s21::set);
+SUITE_ELEMENTS(Copy, std::set, s21::set);
+SUITE_ELEMENTS(Move, std::set, s21::set);
@@ -0,0 +1,9 @@
+#include <stack>
+
+#include "suite.h"
+
+/* Adapters only reach one end: no Lookup or Iterate */
+SUITE_ELEMENTS(Insert, std::stack, s21::stack);
+SUITE_ELEMENTS(Erase, std::stack, s21::stack);
+SUITE_ELEMENTS(Copy, std::stack, s21::stack);
+SUITE_ELEMENTS(Move, std::stack, s21::stack);
@@ -0,0 +1,340 @@
+#ifndef S21_BENCH_SUITE_H
+#define S21_BENCH_SUITE_H
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../../s21_containers.h"
+#include "../../s21_containersplus.h"
+
+/* Google Benchmark suite: every s21 container next to its std::
+ * counterpart, on the same operations, element types and sizes. Names
+ * read Operation<container>/size, so a saved baseline lines up with
+ * later runs by name. */
+
+/* A 64-byte element, trivially copyable, ordered by its first word */
+struct Blob {
+  std::uint64_t words[8];
+
+  bool operator<(const Blob& other) const { return words[0] < other.words[0]; }
+  bool operator==(const Blob& other) const {
+    return words[0] == other.words[0];
+  }
+  bool operator!=(const Blob& other) const { return !(*this == other); }
+};
+
+namespace suite {
+
+/* Element i of a benchmark: distinct for distinct i and scattered, so
+ * trees see a random insertion order */
+inline std::uint32_t scramble(std::size_t i) {
+  return std::uint32_t(i) * 2654435761u;
+}
+
+template <class T>
+T make(std::size_t i);
+
+template <>
+inline int make<int>(std::size_t i) {
+  return int(scramble(i));
+}
+
+/* Past the small-string buffer, so every copy allocates */
+template <>
+inline std::string make<std::string>(std::size_t i) {
+  return "element-" + std::to_string(scramble(i)) + "-of-the-suite";
+}
+
+template <>
+inline Blob make<Blob>(std::size_t i) {
+  Blob blob{};
+  blob.words[0] = scramble(i);
+  return blob;
+}
+
+/* Something cheap to sum per element, so a walk cannot be dropped */
+inline std::size_t weight(int value) { return std::size_t(value); }
+inline std::size_t weight(const std::string& value) { return value.size(); }
+inline std::size_t weight(const Blob& value) { return value.words[0]; }
+template <class K, class T>
+std::size_t weight(const std::pair<K, T>& value) {
+  return weight(value.first);
+}
+
+template <class C, class = void>
+struct is_map : std::false_type {};
+template <class C>
+struct is_map<C, std::void_t<typename C::mapped_type>> : std::true_type {};
+
+template <class C, class = void>
+struct has_push_back : std::false_type {};
+template <class C>
+struct has_push_back<C, std::void_t<decltype(std::declval<C&>().push_back(
+                            std::declval<typename C::value_type>()))>>
+    : std::true_type {};
+
+template <class C, class = void>
+struct has_push : std::false_type {};
+template <class C>
+struct has_push<C, std::void_t<decltype(std::declval<C&>().push(
+                       std::declval<typename C::value_type>()))>>
+    : std::true_type {};
+
+template <class C, class = void>
+struct has_insert : std::false_type {};
+template <class C>
+struct has_insert<C, std::void_t<decltype(std::declval<C&>().insert(
+                         std::declval<typename C::value_type>()))>>
+    : std::true_type {};
+
+template <class C, class = void>
+struct has_find : std::false_type {};
+template <class C>
+struct has_find<C, std::void_t<decltype(std::declval<C&>().find(
+                       std::declval<typename C::key_type>()))>>
+    : std::true_type {};
+
+template <class C, class = void>
+struct has_pop_front : std::false_type {};
+template <class C>
+struct has_pop_front<C, std::void_t<decltype(std::declval<C&>().pop_front())>>
+    : std::true_type {};
+
+template <class C, class = void>
+struct has_top : std::false_type {};
+template <class C>
+struct has_top<C, std::void_t<decltype(std::declval<C&>().top())>>
+    : std::true_type {};
+
+/* The element an adapter pops next */
+template <class C>
+const auto& peek(C& c) {
+  if constexpr (has_top<C>::value) {
+    return c.top();
+  } else {
+    return c.front();
+  }
+}
+
+/* What element i of C is built from; maps get make<key>(i) mapped to i */
+template <class C>
+auto element(std::size_t i) {
+  if constexpr (is_map<C>::value) {
+    return std::pair<typename C::key_type, typename C::mapped_type>(
+        make<typename C::key_type>(i), typename C::mapped_type(i));
+  } else {
+    return make<typename C::value_type>(i);
+  }
+}
+
+template <class C>
+auto elements(std::size_t n) {
+  std::vector<decltype(element<C>(0))> result;
+  result.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) result.push_back(element<C>(i));
+  return result;
+}
+
+/* Add input to c the way C grows: push_back, push or insert; arrays get
+ * their first input.size() slots assigned */
+template <class C, class Input>
+void fill(C& c, const Input& input) {
+  std::size_t i = 0;
+  for (const auto& value : input) {
+    if constexpr (has_push_back<C>::value) {
+      c.push_back(value);
+    } else if constexpr (has_push<C>::value) {
+      c.push(value);
+    } else if constexpr (has_insert<C>::value) {
+      c.insert(value);
+    } else {
+      c[i++] = value;
+    }
+  }
+}
+
+template <class K, class T>
+const K& key(const std::pair<K, T>& value) {
+  return value.first;
+}
+template <class T>
+const T& key(const T& value) {
+  return value;
+}
+
+/* Take elements out of c the way C shrinks and return how many went:
+ * associative containers erase every key in random order, lists pop
+ * from the front, adapters pop until empty. Popped elements are read
+ * first, or a pop loop over trivial elements folds into one store.
+ * Vectors erase their front half at once, as one by one from the front
+ * would be quadratic. */
+template <class C, class Input>
+std::size_t drain(C& c, const Input& input,
+                  const std::vector<std::size_t>& order) {
+  std::size_t count = c.size();
+  if constexpr (has_find<C>::value) {
+    for (std::size_t i : order) c.erase(c.find(key(input[i])));
+  } else if constexpr (has_pop_front<C>::value) {
+    while (!c.empty()) {
+      benchmark::DoNotOptimize(c.front());
+      c.pop_front();
+    }
+  } else if constexpr (has_push<C>::value) {
+    while (!c.empty()) {
+      benchmark::DoNotOptimize(peek(c));
+      c.pop();
+    }
+  } else {
+    count /= 2;
+    c.erase(c.begin(), c.begin() + std::ptrdiff_t(count));
+  }
+  return count;
+}
+
+/* Elements an Erase iteration drains at least, see Erase() */
+constexpr std::size_t kEraseBatch = 1 << 16;
+
+/* n indices below n in random order, the same on every run */
+inline std::vector<std::size_t> shuffled(std::size_t n) {
+  std::vector<std::size_t> order(n);
+  for (std::size_t i = 0; i < n; ++i) order[i] = i;
+  std::shuffle(order.begin(), order.end(), std::mt19937(unsigned(n)));
+  return order;
+}
+
+inline std::size_t size(const benchmark::State& state) {
+  return std::size_t(state.range(0));
+}
+
+/* Operations that touch every element report elements per second too */
+inline void processed(benchmark::State& state, std::size_t n) {
+  state.SetItemsProcessed(std::int64_t(state.iterations()) * std::int64_t(n));
+}
+
+inline void sizes(benchmark::internal::Benchmark* b) {
+  b->Arg(1 << 8)->Arg(1 << 12)->Arg(1 << 16);
+}
+
+}  // namespace suite
+
+/* Operations every container shares. Containers are built outside the
+ * timed loop unless building is what is measured. */
+
+/* An empty container grown to n elements, then destroyed */
+template <class C>
+void Insert(benchmark::State& state) {
+  std::size_t n = suite::size(state);
+  auto input = suite::elements<C>(n);
+  for (auto _ : state) {
+    C c;
+    suite::fill(c, input);
+    benchmark::DoNotOptimize(&c);
+  }
+  suite::processed(state, n);
+}
+
+template <class C>
+void Iterate(benchmark::State& state) {
+  std::size_t n = suite::size(state);
+  C c;
+  suite::fill(c, suite::elements<C>(n));
+  for (auto _ : state) {
+    std::size_t sum = 0;
+    for (const auto& value : c) sum += suite::weight(value);
+    benchmark::DoNotOptimize(sum);
+  }
+  suite::processed(state, n);
+}
+
+template <class C>
+void Copy(benchmark::State& state) {
+  std::size_t n = suite::size(state);
+  C source;
+  suite::fill(source, suite::elements<C>(n));
+  for (auto _ : state) {
+    C copy(source);
+    benchmark::DoNotOptimize(&copy);
+  }
+  suite::processed(state, n);
+}
+
+/* n random reads, by key or by index */
+template <class C>
+void Lookup(benchmark::State& state) {
+  std::size_t n = suite::size(state);
+  auto input = suite::elements<C>(n);
+  std::vector<std::size_t> order = suite::shuffled(n);
+  C c;
+  suite::fill(c, input);
+  for (auto _ : state) {
+    std::size_t sum = 0;
+    for (std::size_t i : order) {
+      if constexpr (suite::has_find<C>::value) {
+        sum += suite::weight(*c.find(suite::key(input[i])));
+      } else {
+        sum += suite::weight(c[i]);
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  suite::processed(state, n);
+}
+
+/* The copies to drain are made with the clock stopped. Stopping it
+ * costs about a microsecond, so one iteration drains a batch of copies
+ * holding at least kEraseBatch elements: the time is per batch, and
+ * items_per_second is the figure to compare across sizes. */
+template <class C>
+void Erase(benchmark::State& state) {
+  std::size_t n = suite::size(state);
+  auto input = suite::elements<C>(n);
+  std::vector<std::size_t> order = suite::shuffled(n);
+  C source;
+  suite::fill(source, input);
+  std::vector<C> batch(std::max<std::size_t>(1, suite::kEraseBatch / n));
+  std::int64_t erased = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    for (C& c : batch) c = source;
+    state.ResumeTiming();
+    for (C& c : batch) erased += std::int64_t(suite::drain(c, input, order));
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(erased);
+  state.counters["batch"] = double(batch.size());
+}
+
+/* A move construction and a move assignment back; O(1) for everything
+ * but arrays, so no per-element rate */
+template <class C>
+void Move(benchmark::State& state) {
+  C source;
+  suite::fill(source, suite::elements<C>(suite::size(state)));
+  for (auto _ : state) {
+    C moved(std::move(source));
+    benchmark::DoNotOptimize(&moved);
+    source = std::move(moved);
+    benchmark::ClobberMemory();
+  }
+}
+
+/* Register fn for the std:: and the s21:: container, std:: first */
+#define SUITE_PAIR(fn, std_type, s21_type)               \
+  BENCHMARK_TEMPLATE(fn, std_type)->Apply(suite::sizes); \
+  BENCHMARK_TEMPLATE(fn, s21_type)->Apply(suite::sizes)
+
+/* ... for int, std::string and Blob elements */
+#define SUITE_ELEMENTS(fn, std_tmpl, s21_tmpl)                   \
+  SUITE_PAIR(fn, std_tmpl<int>, s21_tmpl<int>);                  \
+  SUITE_PAIR(fn, std_tmpl<std::string>, s21_tmpl<std::string>); \
+  SUITE_PAIR(fn, std_tmpl<Blob>, s21_tmpl<Blob>)
+
+#endif  // S21_BENCH_SUITE_H
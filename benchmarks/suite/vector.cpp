@@ -0,0 +1,10 @@
+#include <vector>
+
+#include "suite.h"
+
+SUITE_ELEMENTS(Insert, std::vector, s21::vector);
+SUITE_ELEMENTS(Lookup, std::vector, s21::vector);
+SUITE_ELEMENTS(Iterate, std::vector, s21::vector);
+SUITE_ELEMENTS(Erase, std::vector, s21::vector);
+SUITE_ELEMENTS(Copy, std::vector, s21::vector);
+SUITE_ELEMENTS(Move, std::vector, s21::vector);
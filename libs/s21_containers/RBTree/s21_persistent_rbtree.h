@@ -0,0 +1,234 @@
+#ifndef S21_PERSISTENT_RBTREE_H_
+#define S21_PERSISTENT_RBTREE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <utility>
+
+#include "s21_rbtree.h"
+
+namespace s21 {
+/* Persistent (path-copying) red-black tree. Nodes are immutable once
+ * published and reference counted, so versions share every subtree a
+ * write did not touch: a write copies O(log n) nodes and a version costs
+ * only the nodes that differ from the others.
+ *
+ * One writer thread updates the tree, any number of threads read it
+ * through snapshot(), an O(1) immutable view that stays valid and
+ * unchanged however long it is kept. Taking a snapshot and publishing a
+ * write hold a spinlock for a pointer copy and a counter increment only,
+ * reading a snapshot takes no lock at all. The allocator must be usable
+ * from every thread that drops the last snapshot of a version. */
+template <typename K, typename V, typename KeyOfValue,
+          typename Allocator = std::allocator<V>>
+class PersistentRBTree {
+ protected:
+  struct Node {
+    std::atomic<size_t> refs; /* parents and snapshots holding the node */
+    Node *left, *right;
+    size_t size;
+    Color color;
+    V value;
+
+    template <class... Args>
+    explicit Node(Args &&...args)
+        : refs(1),
+          left(nullptr),
+          right(nullptr),
+          size(1),
+          color(RED),
+          value(std::forward<Args>(args)...) {}
+  };
+
+  using node_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+ public:
+  class ConstIterator;
+  class Snapshot;
+
+  using key_type = K;
+  using value_type = V;
+  using const_reference = const value_type &;
+  using const_iterator = ConstIterator;
+  using snapshot_type = Snapshot;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  /* In-order forward iterator. It keeps the path from the root, so it
+   * needs no parent links; the version it walks must outlive it. */
+  class ConstIterator {
+   public:
+    ConstIterator() : depth_(0) {}
+    ConstIterator(const ConstIterator &other);
+    ConstIterator &operator=(const ConstIterator &other);
+
+    const_reference operator*() const;
+    const value_type *operator->() const;
+    ConstIterator &operator++();
+    ConstIterator operator++(int);
+    bool operator==(const ConstIterator &other) const;
+    bool operator!=(const ConstIterator &other) const;
+
+   private:
+    friend class Snapshot;
+    /* a red-black tree is at most twice as high as log2 of its size */
+    static constexpr size_type kMaxDepth =
+        2 * std::numeric_limits<size_type>::digits;
+
+    const Node *path_[kMaxDepth]; /* nodes still to visit, top is current */
+    size_type depth_;
+
+    void pushLeft(const Node *node);
+  };
+
+  /* Immutable version of the tree */
+  class Snapshot {
+   public:
+    Snapshot() : root_(nullptr), alloc_() {}
+    Snapshot(const Snapshot &other);
+    Snapshot(Snapshot &&other) noexcept;
+    Snapshot &operator=(const Snapshot &other);
+    Snapshot &operator=(Snapshot &&other) noexcept;
+    ~Snapshot();
+
+    bool empty() const { return root_ == nullptr; }
+    size_type size() const { return root_ ? root_->size : 0; }
+    bool contains(const key_type &key) const;
+
+    const_iterator begin() const;
+    const_iterator end() const { return const_iterator(); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+    const_iterator find(const key_type &key) const;
+    const_iterator lower_bound(const key_type &key) const; /* key >= key */
+    const_iterator upper_bound(const key_type &key) const; /* key > key */
+
+   private:
+    friend class PersistentRBTree;
+
+    Snapshot(Node *root, const node_allocator &alloc)
+        : root_(root), alloc_(alloc) {}
+
+    Node *root_; /* owned reference */
+    node_allocator alloc_;
+  };
+
+  PersistentRBTree();
+  explicit PersistentRBTree(const allocator_type &alloc);
+  /* Copies share the other tree's current version, O(1) */
+  PersistentRBTree(const PersistentRBTree &other);
+  PersistentRBTree(PersistentRBTree &&other) noexcept;
+  PersistentRBTree &operator=(const PersistentRBTree &other);
+  PersistentRBTree &operator=(PersistentRBTree &&other) noexcept;
+  ~PersistentRBTree() = default;
+
+  allocator_type get_allocator() const;
+
+  /* Current version, O(1); safe to call while the writer is updating */
+  snapshot_type snapshot() const;
+
+  /* Writer side. Iterators into the current version are invalidated by
+   * the next write unless a snapshot keeps that version alive. */
+  /* false if the key is already present */
+  bool insert(const value_type &value);
+  bool insert(value_type &&value);
+  /* Insert, or replace the element with the same key; true if inserted */
+  bool insert_or_assign(const value_type &value);
+  /* false if the key is not present */
+  bool erase(const key_type &key);
+  void clear();
+
+  /* Reads of the current version, for the writer thread */
+  bool empty() const { return current_.empty(); }
+  size_type size() const { return current_.size(); }
+  size_type max_size() const;
+  bool contains(const key_type &key) const { return current_.contains(key); }
+  const_iterator begin() const { return current_.begin(); }
+  const_iterator end() const { return current_.end(); }
+  const_iterator cbegin() const { return current_.begin(); }
+  const_iterator cend() const { return current_.end(); }
+  const_iterator find(const key_type &key) const { return current_.find(key); }
+  const_iterator lower_bound(const key_type &key) const {
+    return current_.lower_bound(key);
+  }
+  const_iterator upper_bound(const key_type &key) const {
+    return current_.upper_bound(key);
+  }
+
+ private:
+  /* Join/split on owned references, as in RBTree. A node is changed in
+   * place only while the caller holds its sole reference, every other
+   * node is copied first, so published versions are never modified.
+   * The functions consume the references they are given even when they
+   * throw, so a write that fails halfway leaks nothing. */
+  struct Subtree {
+    Node *root; /* black */
+    size_type bh;
+  };
+  struct SplitResult {
+    Subtree left;
+    Node *match;
+    Subtree right;
+  };
+
+  /* An owned reference dropped on unwind unless take() claims it */
+  class Hold {
+   public:
+    Hold(node_allocator &alloc, Node *node) : alloc_(alloc), node_(node) {}
+    Hold(const Hold &) = delete;
+    Hold &operator=(const Hold &) = delete;
+    ~Hold() { release(alloc_, node_); }
+
+    Node *get() const { return node_; }
+    Node *take() { return std::exchange(node_, nullptr); }
+
+   private:
+    node_allocator &alloc_;
+    Node *node_;
+  };
+
+  Snapshot current_;
+  mutable std::atomic_flag lock_ = ATOMIC_FLAG_INIT;
+
+  void lock() const;
+  void unlock() const;
+  /* Make root the current version and drop the previous one */
+  void publish(Node *root) noexcept;
+  /* Trade the current version and its allocator for version's */
+  void exchange(Snapshot &version) noexcept;
+  Subtree retainCurrent() const;
+  bool insertNode(Node *node, bool assign);
+
+  template <class... Args>
+  static Node *createNode(node_allocator &alloc, Args &&...args);
+  static Node *retain(Node *node) noexcept;
+  static void release(node_allocator &alloc, Node *node) noexcept;
+  static Node *unshare(node_allocator &alloc, Node *node);
+  static Subtree child(node_allocator &alloc, Node *node,
+                       size_type parent_bh);
+  static Node *link(Node *left, Node *node, Node *right);
+  static Node *rotateLeft(Node *x);
+  static Node *rotateRight(Node *y);
+  static Node *joinRight(node_allocator &alloc, Node *left,
+                         size_type left_bh, Node *node, Subtree right);
+  static Node *joinLeft(node_allocator &alloc, Subtree left, Node *node,
+                        Node *right, size_type right_bh);
+  static Subtree join(node_allocator &alloc, Subtree left, Node *node,
+                      Subtree right);
+  static Subtree join2(node_allocator &alloc, Subtree left, Subtree right);
+  static std::pair<Subtree, Node *> splitLast(node_allocator &alloc,
+                                              Subtree tree);
+  static SplitResult splitAt(node_allocator &alloc, Subtree tree,
+                             const K &key);
+  static const K &getKey(const Node *node);
+};
+}  // namespace s21
+
+#include "s21_persistent_rbtree.tpp"
+
+#endif  // S21_PERSISTENT_RBTREE_H_
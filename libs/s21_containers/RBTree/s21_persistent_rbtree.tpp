@@ -0,0 +1,584 @@
+#include "s21_persistent_rbtree.h"
+
+namespace s21 {
+
+/* ITERATOR */
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+PersistentRBTree<K, V, KeyOfValue, Allocator>::ConstIterator::ConstIterator(
+    const ConstIterator &other)
+    : depth_(other.depth_) {
+  for (size_type i = 0; i < depth_; ++i) path_[i] = other.path_[i];
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename PersistentRBTree<K, V, KeyOfValue, Allocator>::ConstIterator &
+PersistentRBTree<K, V, KeyOfValue, Allocator>::ConstIterator::operator=(
+    const ConstIterator &other) {
+  depth_ = other.depth_;
+  for (size_type i = 0; i < depth_; ++i) path_[i] = other.path_[i];
+  return *this;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename PersistentRBTree<K, V, KeyOfValue, Allocator>::const_reference
+PersistentRBTree<K, V, KeyOfValue, Allocator>::ConstIterator::operator*()
+    const {
+  if (!depth_) throw std::logic_error("Dereferencing end iterator");
+  return path_[depth_ - 1]->value;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+const typename PersistentRBTree<K, V, KeyOfValue, Allocator>::value_type *
+PersistentRBTree<K, V, KeyOfValue, Allocator>::ConstIterator::operator->()
+    const {
+  return &**this;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename PersistentRBTree<K, V, KeyOfValue, Allocator>::ConstIterator &
+PersistentRBTree<K, V, KeyOfValue, Allocator>::ConstIterator::operator++() {
+  if (depth_) pushLeft(path_[--depth_]->right);
+  return *this;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename PersistentRBTree<K, V, KeyOfValue, Allocator>::ConstIterator
+PersistentRBTree<K, V, KeyOfValue, Allocator>::ConstIterator::operator++(int) {
+  ConstIterator tmp(*this);
+  ++*this;
+  return tmp;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+bool PersistentRBTree<K, V, KeyOfValue, Allocator>::ConstIterator::operator==(
+    const ConstIterator &other) const {
+  if (!depth_ || !other.depth_) return depth_ == other.depth_;
+  return path_[depth_ - 1] == other.path_[other.depth_ - 1];
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+bool PersistentRBTree<K, V, KeyOfValue, Allocator>::ConstIterator::operator!=(
+    const ConstIterator &other) const {
+  return !(*this == other);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void PersistentRBTree<K, V, KeyOfValue, Allocator>::ConstIterator::pushLeft(
+    const Node *node) {
+  for (; node; node = node->left) path_[depth_++] = node;
+}
+
+/* SNAPSHOT */
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+PersistentRBTree<K, V, KeyOfValue, Allocator>::Snapshot::Snapshot(
+    const Snapshot &other)
+    : root_(retain(other.root_)), alloc_(other.alloc_) {}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+PersistentRBTree<K, V, KeyOfValue, Allocator>::Snapshot::Snapshot(
+    Snapshot &&other) noexcept
+    : root_(other.root_), alloc_(other.alloc_) {
+  other.root_ = nullptr;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename PersistentRBTree<K, V, KeyOfValue, Allocator>::Snapshot &
+PersistentRBTree<K, V, KeyOfValue, Allocator>::Snapshot::operator=(
+    const Snapshot &other) {
+  Node *old = root_;
+  root_ = retain(other.root_);
+  release(alloc_, old);
+  alloc_ = other.alloc_;
+  return *this;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename PersistentRBTree<K, V, KeyOfValue, Allocator>::Snapshot &
+PersistentRBTree<K, V, KeyOfValue, Allocator>::Snapshot::operator=(
+    Snapshot &&other) noexcept {
+  if (this != &other) {
+    release(alloc_, root_);
+    root_ = other.root_;
+    alloc_ = other.alloc_;
+    other.root_ = nullptr;
+  }
+  return *this;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+PersistentRBTree<K, V, KeyOfValue, Allocator>::Snapshot::~Snapshot() {
+  release(alloc_, root_);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+bool PersistentRBTree<K, V, KeyOfValue, Allocator>::Snapshot::contains(
+    const key_type &key) const {
+  for (const Node *node = root_; node;) {
+    if (key < getKey(node)) {
+      node = node->left;
+    } else if (getKey(node) < key) {
+      node = node->right;
+    } else {
+      return true;
+    }
+  }
+  return false;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename PersistentRBTree<K, V, KeyOfValue, Allocator>::const_iterator
+PersistentRBTree<K, V, KeyOfValue, Allocator>::Snapshot::begin() const {
+  const_iterator it;
+  it.pushLeft(root_);
+  return it;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename PersistentRBTree<K, V, KeyOfValue, Allocator>::const_iterator
+PersistentRBTree<K, V, KeyOfValue, Allocator>::Snapshot::find(
+    const key_type &key) const {
+  const_iterator it = lower_bound(key);
+  if (it.depth_ && key < getKey(it.path_[it.depth_ - 1])) return end();
+  return it;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename PersistentRBTree<K, V, KeyOfValue, Allocator>::const_iterator
+PersistentRBTree<K, V, KeyOfValue, Allocator>::Snapshot::lower_bound(
+    const key_type &key) const {
+  /* only the nodes we turn left at are still to be visited */
+  const_iterator it;
+  for (const Node *node = root_; node;) {
+    if (getKey(node) < key) {
+      node = node->right;
+    } else {
+      it.path_[it.depth_++] = node;
+      node = node->left;
+    }
+  }
+  return it;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename PersistentRBTree<K, V, KeyOfValue, Allocator>::const_iterator
+PersistentRBTree<K, V, KeyOfValue, Allocator>::Snapshot::upper_bound(
+    const key_type &key) const {
+  const_iterator it;
+  for (const Node *node = root_; node;) {
+    if (key < getKey(node)) {
+      it.path_[it.depth_++] = node;
+      node = node->left;
+    } else {
+      node = node->right;
+    }
+  }
+  return it;
+}
+
+/* CONSTRUCTORS */
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+PersistentRBTree<K, V, KeyOfValue, Allocator>::PersistentRBTree()
+    : current_() {}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+PersistentRBTree<K, V, KeyOfValue, Allocator>::PersistentRBTree(
+    const allocator_type &alloc)
+    : current_(nullptr, node_allocator(alloc)) {}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+PersistentRBTree<K, V, KeyOfValue, Allocator>::PersistentRBTree(
+    const PersistentRBTree &other)
+    : current_(other.current_) {}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+PersistentRBTree<K, V, KeyOfValue, Allocator>::PersistentRBTree(
+    PersistentRBTree &&other) noexcept
+    : current_(std::move(other.current_)) {}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+PersistentRBTree<K, V, KeyOfValue, Allocator> &
+PersistentRBTree<K, V, KeyOfValue, Allocator>::operator=(
+    const PersistentRBTree &other) {
+  if (this != &other) {
+    /* the old version leaves with the allocator that built it */
+    Snapshot version = other.snapshot();
+    exchange(version);
+  }
+  return *this;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+PersistentRBTree<K, V, KeyOfValue, Allocator> &
+PersistentRBTree<K, V, KeyOfValue, Allocator>::operator=(
+    PersistentRBTree &&other) noexcept {
+  if (this != &other) {
+    Snapshot version(nullptr, other.current_.alloc_);
+    other.exchange(version);
+    exchange(version);
+  }
+  return *this;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename PersistentRBTree<K, V, KeyOfValue, Allocator>::allocator_type
+PersistentRBTree<K, V, KeyOfValue, Allocator>::get_allocator() const {
+  return allocator_type(current_.alloc_);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename PersistentRBTree<K, V, KeyOfValue, Allocator>::size_type
+PersistentRBTree<K, V, KeyOfValue, Allocator>::max_size() const {
+  return std::numeric_limits<size_type>::max() / sizeof(Node);
+}
+
+/* PUBLISHING */
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void PersistentRBTree<K, V, KeyOfValue, Allocator>::lock() const {
+  /* held for a few instructions; yield in case the holder was preempted */
+  while (lock_.test_and_set(std::memory_order_acquire)) {
+    std::this_thread::yield();
+  }
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void PersistentRBTree<K, V, KeyOfValue, Allocator>::unlock() const {
+  lock_.clear(std::memory_order_release);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename PersistentRBTree<K, V, KeyOfValue, Allocator>::snapshot_type
+PersistentRBTree<K, V, KeyOfValue, Allocator>::snapshot() const {
+  lock();
+  Snapshot version(retain(current_.root_), current_.alloc_);
+  unlock();
+  return version;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void PersistentRBTree<K, V, KeyOfValue, Allocator>::publish(
+    Node *root) noexcept {
+  lock();
+  std::swap(current_.root_, root);
+  unlock();
+  /* readers that took the old version keep it alive */
+  release(current_.alloc_, root);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void PersistentRBTree<K, V, KeyOfValue, Allocator>::exchange(
+    Snapshot &version) noexcept {
+  lock();
+  std::swap(current_.root_, version.root_);
+  std::swap(current_.alloc_, version.alloc_);
+  unlock();
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename PersistentRBTree<K, V, KeyOfValue, Allocator>::Subtree
+PersistentRBTree<K, V, KeyOfValue, Allocator>::retainCurrent() const {
+  /* only the writer replaces the root, so it can be read unlocked */
+  Subtree tree{retain(current_.root_), 0};
+  for (const Node *node = tree.root; node; node = node->left) {
+    if (node->color == BLACK) ++tree.bh;
+  }
+  return tree;
+}
+
+/* WRITES */
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+bool PersistentRBTree<K, V, KeyOfValue, Allocator>::insert(
+    const value_type &value) {
+  if (contains(KeyOfValue()(value))) return false;
+  return insertNode(createNode(current_.alloc_, value), false);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+bool PersistentRBTree<K, V, KeyOfValue, Allocator>::insert(value_type &&value) {
+  if (contains(KeyOfValue()(value))) return false;
+  return insertNode(createNode(current_.alloc_, std::move(value)), false);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+bool PersistentRBTree<K, V, KeyOfValue, Allocator>::insert_or_assign(
+    const value_type &value) {
+  return insertNode(createNode(current_.alloc_, value), true);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+bool PersistentRBTree<K, V, KeyOfValue, Allocator>::insertNode(Node *node,
+                                                               bool assign) {
+  node_allocator &alloc = current_.alloc_;
+  Hold held(alloc, node);
+  SplitResult parts = splitAt(alloc, retainCurrent(), getKey(node));
+  node = held.take();
+  if (parts.match && !assign) {
+    release(alloc, node);
+    node = parts.match;
+  } else {
+    release(alloc, parts.match);
+  }
+  publish(join(alloc, parts.left, node, parts.right).root);
+  return !parts.match;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+bool PersistentRBTree<K, V, KeyOfValue, Allocator>::erase(const key_type &key) {
+  if (!contains(key)) return false;
+  node_allocator &alloc = current_.alloc_;
+  SplitResult parts = splitAt(alloc, retainCurrent(), key);
+  release(alloc, parts.match);
+  publish(join2(alloc, parts.left, parts.right).root);
+  return true;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void PersistentRBTree<K, V, KeyOfValue, Allocator>::clear() {
+  publish(nullptr);
+}
+
+/* NODES */
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+template <class... Args>
+typename PersistentRBTree<K, V, KeyOfValue, Allocator>::Node *
+PersistentRBTree<K, V, KeyOfValue, Allocator>::createNode(node_allocator &alloc,
+                                                          Args &&...args) {
+  Node *node = node_traits::allocate(alloc, 1);
+  try {
+    node_traits::construct(alloc, node, std::forward<Args>(args)...);
+  } catch (...) {
+    node_traits::deallocate(alloc, node, 1);
+    throw;
+  }
+  return node;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename PersistentRBTree<K, V, KeyOfValue, Allocator>::Node *
+PersistentRBTree<K, V, KeyOfValue, Allocator>::retain(Node *node) noexcept {
+  if (node) node->refs.fetch_add(1, std::memory_order_relaxed);
+  return node;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void PersistentRBTree<K, V, KeyOfValue, Allocator>::release(
+    node_allocator &alloc, Node *node) noexcept {
+  if (node && node->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    release(alloc, node->left);
+    release(alloc, node->right);
+    node_traits::destroy(alloc, node);
+    node_traits::deallocate(alloc, node, 1);
+  }
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename PersistentRBTree<K, V, KeyOfValue, Allocator>::Node *
+PersistentRBTree<K, V, KeyOfValue, Allocator>::unshare(node_allocator &alloc,
+                                                       Node *node) {
+  if (node->refs.load(std::memory_order_acquire) == 1) return node;
+  Node *copy;
+  try {
+    copy = createNode(alloc, node->value);
+  } catch (...) {
+    release(alloc, node);
+    throw;
+  }
+  copy->left = retain(node->left);
+  copy->right = retain(node->right);
+  copy->size = node->size;
+  copy->color = node->color;
+  release(alloc, node);
+  return copy;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename PersistentRBTree<K, V, KeyOfValue, Allocator>::Subtree
+PersistentRBTree<K, V, KeyOfValue, Allocator>::child(node_allocator &alloc,
+                                                     Node *node,
+                                                     size_type parent_bh) {
+  Subtree tree{node, parent_bh - 1};
+  if (node && node->color == RED) {
+    tree.root = unshare(alloc, node);
+    tree.root->color = BLACK;
+    ++tree.bh;
+  }
+  return tree;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename PersistentRBTree<K, V, KeyOfValue, Allocator>::Node *
+PersistentRBTree<K, V, KeyOfValue, Allocator>::link(Node *left, Node *node,
+                                                    Node *right) {
+  node->left = left;
+  node->right = right;
+  node->size = (left ? left->size : 0) + (right ? right->size : 0) + 1;
+  return node;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename PersistentRBTree<K, V, KeyOfValue, Allocator>::Node *
+PersistentRBTree<K, V, KeyOfValue, Allocator>::rotateLeft(Node *x) {
+  Node *y = x->right;
+  link(x->left, x, y->left);
+  return link(x, y, y->right);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename PersistentRBTree<K, V, KeyOfValue, Allocator>::Node *
+PersistentRBTree<K, V, KeyOfValue, Allocator>::rotateRight(Node *y) {
+  Node *x = y->left;
+  link(x->right, y, y->right);
+  return link(x->left, x, y);
+}
+
+/* JOIN AND SPLIT */
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename PersistentRBTree<K, V, KeyOfValue, Allocator>::Node *
+PersistentRBTree<K, V, KeyOfValue, Allocator>::joinRight(node_allocator &alloc,
+                                                         Node *left,
+                                                         size_type left_bh,
+                                                         Node *node,
+                                                         Subtree right) {
+  if (left_bh == right.bh && (!left || left->color == BLACK)) {
+    node->color = RED;
+    return link(left, node, right.root);
+  }
+
+  Hold held_node(alloc, node), held_right(alloc, right.root);
+  Hold held_left(alloc, unshare(alloc, left));
+  left = held_left.get();
+  bool black = left->color == BLACK;
+  Node *sub = joinRight(alloc, std::exchange(left->right, nullptr),
+                        left_bh - black, held_node.take(),
+                        {held_right.take(), right.bh});
+  held_left.take();
+  link(left->left, left, sub);
+  if (black && sub->color == RED && sub->right &&
+      sub->right->color == RED) {
+    sub->right->color = BLACK; /* created by this join, not shared */
+    return rotateLeft(left);
+  }
+  return left;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename PersistentRBTree<K, V, KeyOfValue, Allocator>::Node *
+PersistentRBTree<K, V, KeyOfValue, Allocator>::joinLeft(node_allocator &alloc,
+                                                        Subtree left,
+                                                        Node *node, Node *right,
+                                                        size_type right_bh) {
+  if (right_bh == left.bh && (!right || right->color == BLACK)) {
+    node->color = RED;
+    return link(left.root, node, right);
+  }
+
+  Hold held_left(alloc, left.root), held_node(alloc, node);
+  Hold held_right(alloc, unshare(alloc, right));
+  right = held_right.get();
+  bool black = right->color == BLACK;
+  Node *sub = joinLeft(alloc, {held_left.take(), left.bh}, held_node.take(),
+                       std::exchange(right->left, nullptr), right_bh - black);
+  held_right.take();
+  link(sub, right, right->right);
+  if (black && sub->color == RED && sub->left && sub->left->color == RED) {
+    sub->left->color = BLACK;
+    return rotateRight(right);
+  }
+  return right;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename PersistentRBTree<K, V, KeyOfValue, Allocator>::Subtree
+PersistentRBTree<K, V, KeyOfValue, Allocator>::join(node_allocator &alloc,
+                                                    Subtree left, Node *node,
+                                                    Subtree right) {
+  Subtree tree;
+  if (left.bh > right.bh) {
+    tree = {joinRight(alloc, left.root, left.bh, node, right), left.bh};
+  } else if (left.bh < right.bh) {
+    tree = {joinLeft(alloc, left, node, right.root, right.bh), right.bh};
+  } else {
+    node->color = BLACK;
+    return {link(left.root, node, right.root), left.bh + 1};
+  }
+  if (tree.root->color == RED) {
+    tree.root->color = BLACK;
+    ++tree.bh;
+  }
+  return tree;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename PersistentRBTree<K, V, KeyOfValue, Allocator>::Subtree
+PersistentRBTree<K, V, KeyOfValue, Allocator>::join2(node_allocator &alloc,
+                                                     Subtree left,
+                                                     Subtree right) {
+  if (!left.root) return right;
+  if (!right.root) return left;
+  Hold held_right(alloc, right.root);
+  std::pair<Subtree, Node *> last = splitLast(alloc, left);
+  return join(alloc, last.first, last.second, {held_right.take(), right.bh});
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+std::pair<typename PersistentRBTree<K, V, KeyOfValue, Allocator>::Subtree,
+          typename PersistentRBTree<K, V, KeyOfValue, Allocator>::Node *>
+PersistentRBTree<K, V, KeyOfValue, Allocator>::splitLast(node_allocator &alloc,
+                                                         Subtree tree) {
+  Hold root(alloc, unshare(alloc, tree.root));
+  Hold right(alloc, std::exchange(root.get()->right, nullptr));
+  Subtree left =
+      child(alloc, std::exchange(root.get()->left, nullptr), tree.bh);
+  if (!right.get()) return std::make_pair(left, root.take());
+
+  Hold held_left(alloc, left.root);
+  std::pair<Subtree, Node *> last =
+      splitLast(alloc, child(alloc, right.take(), tree.bh));
+  Hold held_last(alloc, last.second);
+  Subtree rest = join(alloc, {held_left.take(), left.bh}, root.take(),
+                      last.first);
+  return std::make_pair(rest, held_last.take());
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename PersistentRBTree<K, V, KeyOfValue, Allocator>::SplitResult
+PersistentRBTree<K, V, KeyOfValue, Allocator>::splitAt(node_allocator &alloc,
+                                                       Subtree tree,
+                                                       const K &key) {
+  if (!tree.root) return {tree, nullptr, tree};
+
+  Hold root(alloc, unshare(alloc, tree.root));
+  Hold right_child(alloc, std::exchange(root.get()->right, nullptr));
+  Subtree left =
+      child(alloc, std::exchange(root.get()->left, nullptr), tree.bh);
+  Hold held_left(alloc, left.root);
+  Subtree right = child(alloc, right_child.take(), tree.bh);
+  Hold held_right(alloc, right.root);
+
+  if (key < getKey(root.get())) {
+    SplitResult res = splitAt(alloc, {held_left.take(), left.bh}, key);
+    Hold res_left(alloc, res.left.root), res_match(alloc, res.match);
+    res.right = join(alloc, res.right, root.take(),
+                     {held_right.take(), right.bh});
+    res_left.take();
+    res_match.take();
+    return res;
+  }
+  if (getKey(root.get()) < key) {
+    SplitResult res = splitAt(alloc, {held_right.take(), right.bh}, key);
+    Hold res_match(alloc, res.match), res_right(alloc, res.right.root);
+    res.left = join(alloc, {held_left.take(), left.bh}, root.take(),
+                    res.left);
+    res_match.take();
+    res_right.take();
+    return res;
+  }
+  return {{held_left.take(), left.bh}, root.take(),
+          {held_right.take(), right.bh}};
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+const K &
+PersistentRBTree<K, V, KeyOfValue, Allocator>::getKey(const Node *node) {
+  return KeyOfValue()(node->value);
+}
+}  // namespace s21
@@ -2,28 +2,81 @@
 #define S21_RBTREE_H_
 
 #include <cstddef>
+#include <cstdint>
+#include <exception>
 #include <iostream>
 #include <limits>
+#include <memory>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
 
 namespace s21 {
 enum Color { RED, BLACK };
-template <typename K, typename V>
+
+/* Key extraction policies: which part of the stored value is the key */
+template <typename V>
+struct SetKeyOfValue {
+  const V &operator()(const V &value) const { return value; }
+};
+
+template <typename K, typename T>
+struct MapKeyOfValue {
+  const K &operator()(const std::pair<const K, T> &value) const {
+    return value.first;
+  }
+};
+
+/* Lazy view of the elements between two iterators of an ordered container:
+ * nothing is copied, it is valid as long as both ends are */
+template <typename Iter>
+class range_view {
+ public:
+  range_view(Iter first, Iter last) : first_(first), last_(last) {}
+
+  Iter begin() const { return first_; }
+  Iter end() const { return last_; }
+  bool empty() const { return first_ == last_; }
+
+ private:
+  Iter first_;
+  Iter last_;
+};
+
+template <typename K, typename V, typename KeyOfValue,
+          typename Allocator = std::allocator<V>>
 class RBTree {
  protected:
-  struct Node {
-    K key;
+  /* Links of a node. The tree hangs off a header that is its own NodeBase:
+   * header.parent is the root, header.left / header.right the leftmost and
+   * rightmost nodes, and the root's parent is the header. The header is
+   * the end() position and the only link with size 0. */
+  struct NodeBase {
+    std::uintptr_t parent_color; /* parent pointer, color in the low bit */
+    NodeBase *left, *right;
+    size_t size; /* number of nodes in the subtree rooted here */
+
+    explicit NodeBase(size_t count = 1)
+        : parent_color(RED), left(nullptr), right(nullptr), size(count) {}
+
+    NodeBase *parent() const {
+      return reinterpret_cast<NodeBase *>(parent_color & ~std::uintptr_t(1));
+    }
+    void setParent(NodeBase *p) {
+      parent_color = reinterpret_cast<std::uintptr_t>(p) | (parent_color & 1);
+    }
+    Color color() const { return Color(parent_color & 1); }
+    void setColor(Color c) {
+      parent_color = (parent_color & ~std::uintptr_t(1)) | c;
+    }
+  };
+
+  struct Node : NodeBase {
     V value;
-    std::pair<const K, V> pair; /* for map */
-    Color color;
-    Node *parent, *left, *right;
-    Node(const K &k, const V &v)
-        : key(k),
-          value(v),
-          pair(std::make_pair(k, v)),
-          color(RED),
-          parent(nullptr),
-          left(nullptr),
-          right(nullptr){};
+
+    template <class... Args>
+    explicit Node(Args &&...args) : value(std::forward<Args>(args)...){};
   };
 
  public:
@@ -37,44 +90,95 @@ class RBTree {
   using iterator = Iterator;
   using const_iterator = ConstIterator;
   using size_type = size_t;
+  using allocator_type = Allocator;
 
   RBTree();
+  explicit RBTree(const allocator_type &alloc);
   RBTree(const RBTree &other);
   RBTree(RBTree &&other) noexcept;
   RBTree &operator=(const RBTree &other);
-  RBTree &operator=(RBTree &&other) noexcept;
+  RBTree &operator=(RBTree &&other) noexcept(
+      node_traits::propagate_on_container_move_assignment::value ||
+      node_traits::is_always_equal::value);
 
   ~RBTree();
   void clear();
+  allocator_type get_allocator() const;
 
   reference search(const key_type &key);
-  std::pair<iterator, bool> insert(const key_type &key, const_reference val);
-  std::pair<iterator, bool> insert_or_assign(const key_type &key,
-                                             const_reference val);
+  std::pair<iterator, bool> insert(const_reference value);
+  std::pair<iterator, bool> insert(value_type &&value);
+  /* Build the value from args, keep it only if its key is not present */
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args &&...args);
+  template <class... Args>
+  iterator emplace_hint(iterator hint, Args &&...args);
+  /* Build the value from args only if key is not present */
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args);
+  template <class... Args>
+  iterator try_emplace_hint(iterator hint, const key_type &key,
+                            Args &&...args);
+  /* Replace the contents with [first, last). Sorted input is linked into a
+   * balanced tree in O(n), duplicates are skipped (the first one wins);
+   * from the first out-of-order element on the rest is inserted one by
+   * one, so any input gives the same result as inserting it. */
+  template <class InputIt>
+  void assign_sorted(InputIt first, InputIt last);
   void remove(const key_type &key);
   void erase(iterator pos);
   void swap(RBTree &other) noexcept;
+
+  /* Set algebra by join/split: nodes are relinked, never copied, in
+   * O(m log(n / m + 1)) for sizes m <= n. */
+  /* Move in the elements of other whose keys are missing here, the rest
+   * stays in other */
   void merge(RBTree &other);
+  /* merge(), then drop what is left in other */
+  void set_union(RBTree &other);
+  /* Keep only the elements whose keys are (not) in other */
+  void set_intersection(const RBTree &other);
+  void set_difference(const RBTree &other);
+  /* Move the elements with keys >= key into the returned tree, O(log n) */
+  RBTree split(const key_type &key);
   bool contains(const key_type &key) const;
   bool empty() const;
   size_type size() const;
   size_type max_size() const;
 
+  /* Order statistics, O(log n) */
+  iterator nth_element(size_type k); /* k-th smallest, 0-based */
+  const_iterator nth_element(size_type k) const;
+  size_type rank(const key_type &key) const; /* keys less than key */
+  size_type count_range(const key_type &lo,
+                        const key_type &hi) const; /* keys in [lo, hi) */
+
   iterator begin();
   iterator end();
   const_iterator cbegin() const;
   const_iterator cend() const;
   iterator find(const key_type &key);
+
+  /* Bounded queries, one root-to-leaf descent each */
+  iterator lower_bound(const key_type &key); /* first key >= key */
+  const_iterator lower_bound(const key_type &key) const;
+  iterator upper_bound(const key_type &key); /* first key > key */
+  const_iterator upper_bound(const key_type &key) const;
+  std::pair<iterator, iterator> equal_range(const key_type &key);
+  std::pair<const_iterator, const_iterator> equal_range(
+      const key_type &key) const;
+  /* Elements with keys in [lo, hi) */
+  range_view<iterator> range(const key_type &lo, const key_type &hi);
+  range_view<const_iterator> range(const key_type &lo,
+                                   const key_type &hi) const;
+
   class Iterator {
    protected:
-    Node *current_;
-    Node *prev_;
+    NodeBase *current_;
 
    public:
     Iterator();
-    Iterator(Node *node);
-    Iterator(const Iterator &other);
-    Iterator &operator=(const Iterator &other);
+    Iterator(NodeBase *node);
     iterator &operator++();
     iterator operator++(int);
     iterator &operator--();
@@ -83,58 +187,150 @@ class RBTree {
     value_type *operator->();
     bool operator==(const iterator &other) const;
     bool operator!=(const iterator &other) const;
-    Node *successor(Node *node);
-    Node *predecessor(Node *node);
+    /* The element node, nullptr at end() */
     Node *getNode() const;
   };
 
   class ConstIterator : public Iterator {
    public:
     ConstIterator() : Iterator(){};
-    ConstIterator(Node *node) : Iterator(node){};
-    const_reference operator*() const { return this->current_->value; };
+    ConstIterator(NodeBase *node) : Iterator(node){};
+    const_reference operator*() const {
+      return static_cast<Node *>(this->current_)->value;
+    };
   };
 
  private:
-  Node *root_;
+  using node_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  NodeBase header_;
+  size_type size_;
+  node_allocator alloc_;
+
+  /* Attach point for a key: node is set when the key is already present,
+   * otherwise the new node goes to the left or right of parent */
+  struct InsertPos {
+    Node *node;
+    NodeBase *parent;
+    bool left;
+  };
 
   /* Red Black Tree struct fixers and helpers */
-  void fixInsert(Node *z);
-  void fixDelete(Node *x, Node *x_parent);
-
-  Node *fixDeleteCaseLeft(Node *x, Node *x_parent);
-  Node *fixDeleteCaseRight(Node *x, Node *x_parent);
-  void recolorForLeftRotate(Node *x_parent, Node *w);
-  void recolorForRightRotate(Node *x_parent, Node *w);
-  Node *adjustBlackNodeLeft(Node *x, Node *x_parent, Node *w);
-  Node *adjustBlackNodeRight(Node *x, Node *x_parent, Node *w);
-  Node *rotateAtBlackNodeLeft(Node *w, Node *x_parent);
-  Node *rotateAtBlackNodeRight(Node *w, Node *x_parent);
-  void leftRotate(Node *x);
-  void rightRotate(Node *y);
+  void fixInsert(NodeBase *z);
+  void fixDelete(NodeBase *x, NodeBase *x_parent);
+
+  NodeBase *fixDeleteCaseLeft(NodeBase *x, NodeBase *x_parent);
+  NodeBase *fixDeleteCaseRight(NodeBase *x, NodeBase *x_parent);
+  void recolorForLeftRotate(NodeBase *x_parent, NodeBase *w);
+  void recolorForRightRotate(NodeBase *x_parent, NodeBase *w);
+  NodeBase *adjustBlackNodeLeft(NodeBase *x, NodeBase *x_parent,
+                                NodeBase *w);
+  NodeBase *adjustBlackNodeRight(NodeBase *x, NodeBase *x_parent,
+                                 NodeBase *w);
+  NodeBase *rotateAtBlackNodeLeft(NodeBase *w, NodeBase *x_parent);
+  NodeBase *rotateAtBlackNodeRight(NodeBase *w, NodeBase *x_parent);
+  void leftRotate(NodeBase *x);
+  void rightRotate(NodeBase *y);
+
+  /* Node memory */
+  template <class... Args>
+  Node *createNode(Args &&...args);
+  void destroyNode(NodeBase *node);
 
   /* Insert and Deletion */
-  void insertNode(Node *z);
-  Node *deleteNode(Node *z);
-  void clearNode(Node *node);
-  void transplant(Node *u, Node *v);
+  InsertPos findInsertPos(const K &key) const;
+  InsertPos findInsertPos(Node *hint, const K &key) const;
+  void insertNode(Node *z, const InsertPos &pos);
+  void deleteNode(NodeBase *z);
+  /* Free a detached subtree without recursion */
+  void clearNode(NodeBase *node);
+  void transplant(NodeBase *u, NodeBase *v);
+
+  /* Header: take over a detached tree, or become empty when root is null */
+  void resetHeader(NodeBase *root, NodeBase *leftmost, NodeBase *rightmost);
+  NodeBase *headerNode() const;
 
   /* Helpers */
-  Node *search(Node *node, const K &key) const;
-  Node *minimum(Node *node) const;
-  Node *maximum(Node *node) const;
+  Node *search(NodeBase *node, const K &key) const;
+  /* First node with key >= key (upper: > key), the header if none */
+  NodeBase *lowerBound(const K &key) const;
+  NodeBase *upperBound(const K &key) const;
+  /* k-th node in key order, the header if k >= size */
+  NodeBase *nthNode(size_type k) const;
+  static NodeBase *minimum(NodeBase *node);
+  static NodeBase *maximum(NodeBase *node);
+  /* In-order neighbours; the header sits past the last node */
+  static NodeBase *increment(NodeBase *node);
+  static NodeBase *decrement(NodeBase *node);
+
+  /* Shape a chain of n nodes linked through right into a balanced
+   * subtree. Only the nodes at red_depth, the last and incomplete level,
+   * are red, so every path has the same number of black nodes. */
+  NodeBase *buildBalanced(NodeBase *&chain, size_type n, size_type depth,
+                          size_type red_depth);
+  static size_type redDepth(size_type n);
+
+  /* Join-based algebra works on detached subtrees. Their roots are always
+   * black and bh counts the black nodes on every root-to-leaf path. */
+  struct Subtree {
+    NodeBase *root;
+    size_type bh;
+  };
+  struct SplitResult {
+    Subtree left;
+    NodeBase *match; /* node with the split key, if any */
+    Subtree right;
+  };
+  /* Nodes dropped by a merge, chained in key order through right */
+  struct Chain {
+    NodeBase *head;
+    NodeBase *tail;
+    size_type size;
+  };
+
+  Subtree detachAll();
+  void attach(Subtree tree);
+  static Subtree child(NodeBase *node, size_type parent_bh);
+  static NodeBase *link(NodeBase *left, NodeBase *node, NodeBase *right);
+  static NodeBase *rotateLeftDetached(NodeBase *x);
+  static NodeBase *rotateRightDetached(NodeBase *y);
+  static NodeBase *joinRight(NodeBase *left, size_type left_bh,
+                             NodeBase *node, Subtree right);
+  static NodeBase *joinLeft(Subtree left, NodeBase *node, NodeBase *right,
+                            size_type right_bh);
+  static Subtree join(Subtree left, NodeBase *node, Subtree right);
+  static Subtree join2(Subtree left, Subtree right);
+  static std::pair<Subtree, NodeBase *> splitLast(Subtree tree);
+  static SplitResult splitAt(Subtree tree, const K &key);
+  static void append(Chain &chain, NodeBase *node);
+  /* a and b united; on equal keys a's node stays and b's goes to dropped */
+  static Subtree unite(Subtree a, Subtree b, Chain &dropped);
+  Subtree intersect(Subtree a, const NodeBase *b);
+  Subtree subtract(Subtree a, const NodeBase *b);
+
+  /* Copies walk the links instead of recursing. Trees with stateless
+   * allocators copy subtrees of at least kParallelCopyThreshold nodes on
+   * separate threads, up to one per hardware thread. */
+  static constexpr size_type kParallelCopyThreshold = size_type(1) << 15;
 
-  size_type countNodes(Node *node) const;
-  Node *copyTree(Node *node, Node *parent);
+  Node *cloneNode(const NodeBase *node, NodeBase *parent);
+  NodeBase *copyTree(const NodeBase *node, NodeBase *parent);
+  NodeBase *copyTreeParallel(const NodeBase *node, NodeBase *parent,
+                             unsigned threads);
+  void copyFrom(const RBTree &other);
 
   Node *getRoot() const;
   const Node *cgetRoot() const;
-  void setRoot(Node *root) noexcept;
-  Color getColor(Node *node) const;
-  void setColor(Node *node, Color color);
+  void setRoot(NodeBase *root) noexcept;
+  static Color getColor(NodeBase *node);
+  void setColor(NodeBase *node, Color color);
+  static size_type getSize(const NodeBase *node);
+  static const K &getKey(const NodeBase *node);
 };
 }  // namespace s21
 
 #include "s21_rbtree.tpp"
 
-#endif  // S21_RBTREE_H_
\ No newline at end of file
+#endif  // S21_RBTREE_H_
@@ -3,213 +3,372 @@
 namespace s21 {
 
 /* CONSTRUCTORS */
-template <typename K, typename V>
-RBTree<K, V>::RBTree() : root_(nullptr) {}
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+RBTree<K, V, KeyOfValue, Allocator>::RBTree()
+    : header_(0), size_(0), alloc_() {
+  resetHeader(nullptr, nullptr, nullptr);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+RBTree<K, V, KeyOfValue, Allocator>::RBTree(const allocator_type &alloc)
+    : header_(0), size_(0), alloc_(alloc) {
+  resetHeader(nullptr, nullptr, nullptr);
+}
 
-template <typename K, typename V>
-RBTree<K, V>::RBTree(const RBTree &other) {
-  root_ = copyTree(other.root_, nullptr);
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+RBTree<K, V, KeyOfValue, Allocator>::RBTree(const RBTree &other)
+    : header_(0),
+      size_(0),
+      alloc_(node_traits::select_on_container_copy_construction(other.alloc_)) {
+  resetHeader(nullptr, nullptr, nullptr);
+  copyFrom(other);
 }
 
-template <typename K, typename V>
-RBTree<K, V>::RBTree(RBTree &&other) noexcept {
-  root_ = other.root_;
-  other.root_ = nullptr;
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+RBTree<K, V, KeyOfValue, Allocator>::RBTree(RBTree &&other) noexcept
+    : header_(0), size_(other.size_), alloc_(other.alloc_) {
+  resetHeader(other.header_.parent(), other.header_.left,
+              other.header_.right);
+  other.resetHeader(nullptr, nullptr, nullptr);
+  other.size_ = 0;
 }
 
-template <typename K, typename V>
-RBTree<K, V> &RBTree<K, V>::operator=(const RBTree &other) {
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+RBTree<K, V, KeyOfValue, Allocator> &
+RBTree<K, V, KeyOfValue, Allocator>::operator=(const RBTree &other) {
   if (this != &other) {
     clear();
-    root_ = copyTree(other.root_, nullptr);
+    if (node_traits::propagate_on_container_copy_assignment::value) {
+      alloc_ = other.alloc_;
+    }
+    copyFrom(other);
   }
   return *this;
 }
 
-template <typename K, typename V>
-RBTree<K, V> &RBTree<K, V>::operator=(RBTree &&other) noexcept {
-  if (this != &other) {
-    clear();
-    root_ = other.getRoot();
-    other.root_ = nullptr;
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+RBTree<K, V, KeyOfValue, Allocator> &
+RBTree<K, V, KeyOfValue, Allocator>::operator=(RBTree &&other) noexcept(
+    node_traits::propagate_on_container_move_assignment::value ||
+    node_traits::is_always_equal::value) {
+  constexpr bool propagate =
+      node_traits::propagate_on_container_move_assignment::value;
+  if (this == &other) return *this;
+  if constexpr (!propagate && !node_traits::is_always_equal::value) {
+    if (alloc_ != other.alloc_) {
+      /* nodes cannot change owners, move the values into our own memory */
+      RBTree tmp(alloc_);
+      for (iterator it = other.begin(); it != other.end(); ++it) {
+        tmp.emplace_hint(tmp.end(),
+                         std::move_if_noexcept(it.getNode()->value));
+      }
+      other.clear();
+      swap(tmp);
+      return *this;
+    }
   }
+  clear();
+  if constexpr (propagate) alloc_ = other.alloc_;
+  resetHeader(other.header_.parent(), other.header_.left,
+              other.header_.right);
+  size_ = other.size_;
+  other.resetHeader(nullptr, nullptr, nullptr);
+  other.size_ = 0;
   return *this;
 }
 
 /* DESTRUCTOR AND CLEARING METHODS */
-template <typename K, typename V>
-RBTree<K, V>::~RBTree() {
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+RBTree<K, V, KeyOfValue, Allocator>::~RBTree() {
   clear();
 }
 
-template <typename K, typename V>
-void RBTree<K, V>::clear() {
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void RBTree<K, V, KeyOfValue, Allocator>::clear() {
   clearNode(getRoot());
-  root_ = nullptr;
+  resetHeader(nullptr, nullptr, nullptr);
+  size_ = 0;
 }
 
-template <typename K, typename V>
-void RBTree<K, V>::clearNode(Node *node) {
-  if (node) {
-    clearNode(node->left);
-    clearNode(node->right);
-    delete node;
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::allocator_type
+RBTree<K, V, KeyOfValue, Allocator>::get_allocator() const {
+  return allocator_type(alloc_);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void RBTree<K, V, KeyOfValue, Allocator>::clearNode(NodeBase *node) {
+  while (node) {
+    NodeBase *left = node->left;
+    if (left) {
+      /* rotate right until the top has no left child */
+      node->left = left->right;
+      left->right = node;
+      node = left;
+    } else {
+      NodeBase *right = node->right;
+      destroyNode(node);
+      node = right;
+    }
   }
 }
 
+/* HEADER */
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void RBTree<K, V, KeyOfValue, Allocator>::resetHeader(NodeBase *root,
+                                                      NodeBase *leftmost,
+                                                      NodeBase *rightmost) {
+  header_.setParent(root);
+  if (root) {
+    root->setParent(&header_);
+    header_.left = leftmost;
+    header_.right = rightmost;
+  } else {
+    header_.left = header_.right = &header_;
+  }
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::NodeBase *
+RBTree<K, V, KeyOfValue, Allocator>::headerNode() const {
+  /* iterators to a const tree still hold a mutable link */
+  return const_cast<NodeBase *>(&header_);
+}
+
+/* NODE MEMORY */
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+template <class... Args>
+typename RBTree<K, V, KeyOfValue, Allocator>::Node *
+RBTree<K, V, KeyOfValue, Allocator>::createNode(Args &&...args) {
+  Node *node = node_traits::allocate(alloc_, 1);
+  try {
+    node_traits::construct(alloc_, node, std::forward<Args>(args)...);
+  } catch (...) {
+    node_traits::deallocate(alloc_, node, 1);
+    throw;
+  }
+  return node;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void RBTree<K, V, KeyOfValue, Allocator>::destroyNode(NodeBase *node) {
+  Node *n = static_cast<Node *>(node);
+  node_traits::destroy(alloc_, n);
+  node_traits::deallocate(alloc_, n, 1);
+}
+
 /* RBTREE STRUCT FIXERS AND HELPERS */
-template <typename K, typename V>
-void RBTree<K, V>::leftRotate(Node *x) {
-  Node *y = x->right;
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void RBTree<K, V, KeyOfValue, Allocator>::leftRotate(NodeBase *x) {
+  NodeBase *y = x->right;
   x->right = y->left;
 
   if (y->left) {
-    y->left->parent = x;
+    y->left->setParent(x);
   }
 
-  y->parent = x->parent;
+  y->setParent(x->parent());
 
-  if (!x->parent) {
-    root_ = y;
-  } else if (x == x->parent->left) {
-    x->parent->left = y;
+  if (x == getRoot()) {
+    setRoot(y);
+  } else if (x == x->parent()->left) {
+    x->parent()->left = y;
   } else {
-    x->parent->right = y;
+    x->parent()->right = y;
   }
 
   y->left = x;
-  x->parent = y;
+  x->setParent(y);
+
+  y->size = x->size;
+  x->size = getSize(x->left) + getSize(x->right) + 1;
 }
 
-template <typename K, typename V>
-void RBTree<K, V>::rightRotate(Node *y) {
-  Node *x = y->left;
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void RBTree<K, V, KeyOfValue, Allocator>::rightRotate(NodeBase *y) {
+  NodeBase *x = y->left;
   y->left = x->right;
 
   if (x->right != nullptr) {
-    x->right->parent = y;
+    x->right->setParent(y);
   }
 
-  x->parent = y->parent;
+  x->setParent(y->parent());
 
-  if (y->parent == nullptr) {
-    root_ = x;
-  } else if (y == y->parent->right) {
-    y->parent->right = x;
+  if (y == getRoot()) {
+    setRoot(x);
+  } else if (y == y->parent()->right) {
+    y->parent()->right = x;
   } else {
-    y->parent->left = x;
+    y->parent()->left = x;
   }
 
   x->right = y;
-  y->parent = x;
-}
-
-template <typename K, typename V>
-void RBTree<K, V>::fixInsert(Node *z) {
-  Node *y = nullptr;
+  y->setParent(x);
 
-  while (z != getRoot() && z->parent && z->parent->color == RED) {
-    bool leftSide = false;
-
-    if (z->parent && z->parent->parent) {
-      leftSide = z->parent == z->parent->parent->left;
-      y = leftSide ? z->parent->parent->right : z->parent->parent->left;
-    }
+  x->size = y->size;
+  y->size = getSize(y->left) + getSize(y->right) + 1;
+}
 
-    if (y && y->color == RED) {
-      z->parent->color = BLACK;
-      y->color = BLACK;
-      z->parent->parent->color = RED;
-      z = z->parent->parent;
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void RBTree<K, V, KeyOfValue, Allocator>::fixInsert(NodeBase *z) {
+  /* a red parent is never the root, so the grandparent is a real node */
+  while (z != getRoot() && z->parent()->color() == RED) {
+    NodeBase *parent = z->parent();
+    NodeBase *grandparent = parent->parent();
+    bool leftSide = parent == grandparent->left;
+    NodeBase *y = leftSide ? grandparent->right : grandparent->left;
+
+    if (y && y->color() == RED) {
+      parent->setColor(BLACK);
+      y->setColor(BLACK);
+      grandparent->setColor(RED);
+      z = grandparent;
     } else {
-      if ((leftSide && z == z->parent->right) ||
-          (!leftSide && z == z->parent->left)) {
-        z = z->parent;
+      if ((leftSide && z == parent->right) ||
+          (!leftSide && z == parent->left)) {
+        z = parent;
         leftSide ? leftRotate(z) : rightRotate(z);
       }
-      if (z->parent) z->parent->color = BLACK;
-      if (z->parent->parent) {
-        z->parent->parent->color = RED;
-        leftSide ? rightRotate(z->parent->parent)
-                 : leftRotate(z->parent->parent);
-      }
+      z->parent()->setColor(BLACK);
+      grandparent->setColor(RED);
+      leftSide ? rightRotate(grandparent) : leftRotate(grandparent);
     }
-    root_->color = BLACK;
   }
+  getRoot()->setColor(BLACK);
 }
 
 /* INSERTION AND DELETION LOGIC + HELPERS */
-template <typename K, typename V>
-void RBTree<K, V>::insertNode(Node *z) {
-  Node *y = nullptr;
-  Node *x = getRoot();
-
-  while (x != nullptr) {
-    y = x;
-    if (z->key < x->key) {
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::InsertPos
+RBTree<K, V, KeyOfValue, Allocator>::findInsertPos(const K &key) const {
+  InsertPos pos{nullptr, nullptr, true};
+  NodeBase *x = getRoot();
+  NodeBase *candidate = nullptr; /* last node with key(candidate) <= key */
+
+  while (x) {
+    pos.parent = x;
+    pos.left = key < getKey(x);
+    if (pos.left) {
       x = x->left;
     } else {
+      candidate = x;
       x = x->right;
     }
   }
 
-  z->parent = y;
+  if (candidate && !(getKey(candidate) < key)) {
+    pos.node = static_cast<Node *>(candidate);
+  }
+  return pos;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::InsertPos
+RBTree<K, V, KeyOfValue, Allocator>::findInsertPos(Node *hint,
+                                                   const K &key) const {
+  if (!getRoot()) return findInsertPos(key);
+
+  if (!hint) {
+    NodeBase *last = header_.right;
+    if (getKey(last) < key) return InsertPos{nullptr, last, false};
+  } else if (key < getKey(hint)) {
+    if (hint == header_.left) return InsertPos{nullptr, hint, true};
+    NodeBase *prev = decrement(hint);
+    if (getKey(prev) < key) {
+      return hint->left ? InsertPos{nullptr, prev, false}
+                        : InsertPos{nullptr, hint, true};
+    }
+  } else if (!(getKey(hint) < key)) {
+    return InsertPos{hint, nullptr, true};
+  }
+
+  return findInsertPos(key);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void RBTree<K, V, KeyOfValue, Allocator>::insertNode(Node *z,
+                                                     const InsertPos &pos) {
+  NodeBase *y = pos.parent;
+
   if (!y) {
-    root_ = z;
-  } else if (z->key < y->key) {
+    resetHeader(z, z, z);
+  } else if (pos.left) {
+    z->setParent(y);
     y->left = z;
+    if (y == header_.left) header_.left = z;
   } else {
+    z->setParent(y);
     y->right = z;
+    if (y == header_.right) header_.right = z;
+  }
+
+  for (NodeBase *p = y; p && p != &header_; p = p->parent()) {
+    ++p->size;
   }
+  ++size_;
 
-  z->color = RED;
+  z->setColor(RED);
+  fixInsert(z);
 }
 
-template <typename K, typename V>
-typename RBTree<K, V>::Node *RBTree<K, V>::deleteNode(Node *z) {
-  if (!z) return nullptr;
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void RBTree<K, V, KeyOfValue, Allocator>::deleteNode(NodeBase *z) {
+  NodeBase *y = z;
+  NodeBase *x = nullptr;
+  NodeBase *x_parent = nullptr;
+  Color yOriginalColor = y->color();
+
+  /* the cached ends move to the in-order neighbours, or to the header */
+  if (z == header_.left) header_.left = increment(z);
+  if (z == header_.right) {
+    header_.right = size_ == 1 ? &header_ : decrement(z);
+  }
 
-  Node *y = z;
-  Node *x = nullptr;
-  Node *x_parent = nullptr;
-  Color yOriginalColor = y->color;
+  /* the node spliced out of its position is z itself or its successor */
+  NodeBase *spliced = (z->left && z->right) ? minimum(z->right) : z;
+  for (NodeBase *p = spliced->parent(); p != &header_; p = p->parent()) {
+    --p->size;
+  }
+  --size_;
 
   if (!z->left) {
     x = z->right;  // x could be nullptr if z has no children
     transplant(z, z->right);
-    x_parent = z->parent;
+    x_parent = z->parent();
   } else if (!z->right) {
     x = z->left;  // x could be nullptr if z has no children
     transplant(z, z->left);
-    x_parent = z->parent;
+    x_parent = z->parent();
   } else {
     y = minimum(z->right);
-    yOriginalColor = y->color;
+    yOriginalColor = y->color();
     x = y->right;  // x might be nullptr if y has no children
-    x_parent = y->parent;
-    if (y->parent == z) {
+    x_parent = y->parent();
+    if (y->parent() == z) {
       x_parent = y;  // x's parent is y if y is a child of z
     } else {
       transplant(y, y->right);
       y->right = z->right;
-      y->right->parent = y;
+      y->right->setParent(y);
     }
     transplant(z, y);
     y->left = z->left;
-    y->left->parent = y;
-    y->color = z->color;
+    y->left->setParent(y);
+    y->setColor(z->color());
+    y->size = z->size;
   }
 
   if (yOriginalColor == BLACK) {
     fixDelete(x, x_parent);
   }
 
-  delete z;
-  return nullptr;
+  destroyNode(z);
 }
 
-template <typename K, typename V>
-void RBTree<K, V>::fixDelete(Node *x, Node *x_parent) {
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void RBTree<K, V, KeyOfValue, Allocator>::fixDelete(NodeBase *x,
+                                                    NodeBase *x_parent) {
   while (x != getRoot() && (x == nullptr || getColor(x) == BLACK)) {
     if (x == x_parent->left || (x == nullptr && x_parent->left == nullptr)) {
       x = fixDeleteCaseLeft(x, x_parent);
@@ -217,14 +376,16 @@ void RBTree<K, V>::fixDelete(Node *x, Node *x_parent) {
       x = fixDeleteCaseRight(x, x_parent);
     }
     if (x == getRoot()) break;
+    x_parent = x->parent();
   }
   if (x) setColor(x, BLACK);
 }
 
-template <typename K, typename V>
-typename RBTree<K, V>::Node *RBTree<K, V>::fixDeleteCaseLeft(Node *x,
-                                                             Node *x_parent) {
-  Node *w = x_parent->right;
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::NodeBase *
+RBTree<K, V, KeyOfValue, Allocator>::fixDeleteCaseLeft(NodeBase *x,
+                                                       NodeBase *x_parent) {
+  NodeBase *w = x_parent->right;
   if (getColor(w) == RED) {
     recolorForLeftRotate(x_parent, w);
     w = x_parent->right;
@@ -232,10 +393,11 @@ typename RBTree<K, V>::Node *RBTree<K, V>::fixDeleteCaseLeft(Node *x,
   return adjustBlackNodeLeft(x, x_parent, w);
 }
 
-template <typename K, typename V>
-typename RBTree<K, V>::Node *RBTree<K, V>::fixDeleteCaseRight(Node *x,
-                                                              Node *x_parent) {
-  Node *w = x_parent->left;
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::NodeBase *
+RBTree<K, V, KeyOfValue, Allocator>::fixDeleteCaseRight(NodeBase *x,
+                                                        NodeBase *x_parent) {
+  NodeBase *w = x_parent->left;
   if (getColor(w) == RED) {
     recolorForRightRotate(x_parent, w);
     w = x_parent->left;
@@ -243,51 +405,54 @@ typename RBTree<K, V>::Node *RBTree<K, V>::fixDeleteCaseRight(Node *x,
   return adjustBlackNodeRight(x, x_parent, w);
 }
 
-template <typename K, typename V>
-void RBTree<K, V>::recolorForLeftRotate(Node *x_parent, Node *w) {
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void RBTree<K, V, KeyOfValue, Allocator>::recolorForLeftRotate(
+    NodeBase *x_parent, NodeBase *w) {
   setColor(w, BLACK);
   setColor(x_parent, RED);
   leftRotate(x_parent);
 }
 
-template <typename K, typename V>
-void RBTree<K, V>::recolorForRightRotate(Node *x_parent, Node *w) {
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void RBTree<K, V, KeyOfValue, Allocator>::recolorForRightRotate(
+    NodeBase *x_parent, NodeBase *w) {
   setColor(w, BLACK);
   setColor(x_parent, RED);
   rightRotate(x_parent);
 }
 
-template <typename K, typename V>
-typename RBTree<K, V>::Node *RBTree<K, V>::adjustBlackNodeLeft(Node *x,
-                                                               Node *x_parent,
-                                                               Node *w) {
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::NodeBase *
+RBTree<K, V, KeyOfValue, Allocator>::adjustBlackNodeLeft(NodeBase *x,
+                                                         NodeBase *x_parent,
+                                                         NodeBase *w) {
   if (getColor(w->left) == BLACK && getColor(w->right) == BLACK) {
     setColor(w, RED);
     x = x_parent;
-    x_parent = x_parent->parent;
   } else {
     x = rotateAtBlackNodeLeft(w, x_parent);
   }
   return x;
 }
 
-template <typename K, typename V>
-typename RBTree<K, V>::Node *RBTree<K, V>::adjustBlackNodeRight(Node *x,
-                                                                Node *x_parent,
-                                                                Node *w) {
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::NodeBase *
+RBTree<K, V, KeyOfValue, Allocator>::adjustBlackNodeRight(NodeBase *x,
+                                                          NodeBase *x_parent,
+                                                          NodeBase *w) {
   if (getColor(w->right) == BLACK && getColor(w->left) == BLACK) {
     setColor(w, RED);
     x = x_parent;
-    x_parent = x_parent->parent;
   } else {
     x = rotateAtBlackNodeRight(w, x_parent);
   }
   return x;
 }
 
-template <typename K, typename V>
-typename RBTree<K, V>::Node *RBTree<K, V>::rotateAtBlackNodeLeft(
-    Node *w, Node *x_parent) {
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::NodeBase *
+RBTree<K, V, KeyOfValue, Allocator>::rotateAtBlackNodeLeft(
+    NodeBase *w, NodeBase *x_parent) {
   if (getColor(w->right) == BLACK) {
     setColor(w->left, BLACK);
     setColor(w, RED);
@@ -301,9 +466,10 @@ typename RBTree<K, V>::Node *RBTree<K, V>::rotateAtBlackNodeLeft(
   return getRoot();
 }
 
-template <typename K, typename V>
-typename RBTree<K, V>::Node *RBTree<K, V>::rotateAtBlackNodeRight(
-    Node *w, Node *x_parent) {
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::NodeBase *
+RBTree<K, V, KeyOfValue, Allocator>::rotateAtBlackNodeRight(
+    NodeBase *w, NodeBase *x_parent) {
   if (getColor(w->left) == BLACK) {
     setColor(w->right, BLACK);
     setColor(w, RED);
@@ -317,258 +483,695 @@ typename RBTree<K, V>::Node *RBTree<K, V>::rotateAtBlackNodeRight(
   return getRoot();
 }
 
-template <typename K, typename V>
-void RBTree<K, V>::transplant(Node *u, Node *v) {
-  if (!u->parent) {
-    root_ = v;
-  } else if (u == u->parent->left) {
-    u->parent->left = v;
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void RBTree<K, V, KeyOfValue, Allocator>::transplant(NodeBase *u,
+                                                     NodeBase *v) {
+  if (u == getRoot()) {
+    setRoot(v);
+  } else if (u == u->parent()->left) {
+    u->parent()->left = v;
   } else {
-    u->parent->right = v;
+    u->parent()->right = v;
   }
 
-  if (v) v->parent = u->parent;
+  if (v) v->setParent(u->parent());
 }
 
-template <typename K, typename V>
-typename RBTree<K, V>::Node *RBTree<K, V>::minimum(Node *node) const {
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::NodeBase *
+RBTree<K, V, KeyOfValue, Allocator>::minimum(NodeBase *node) {
   while (node->left) {
     node = node->left;
   }
   return node;
 }
 
-template <typename K, typename V>
-typename RBTree<K, V>::Node *RBTree<K, V>::maximum(Node *node) const {
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::NodeBase *
+RBTree<K, V, KeyOfValue, Allocator>::maximum(NodeBase *node) {
   while (node->right) {
     node = node->right;
   }
   return node;
 }
 
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::NodeBase *
+RBTree<K, V, KeyOfValue, Allocator>::increment(NodeBase *node) {
+  if (node->right) return minimum(node->right);
+
+  NodeBase *p = node->parent();
+  while (node == p->right) {
+    node = p;
+    p = p->parent();
+  }
+  /* climbing from the rightmost node ends at the header, whose right link
+   * is that node (or the root itself when it has no right subtree) */
+  return node->right != p ? p : node;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::NodeBase *
+RBTree<K, V, KeyOfValue, Allocator>::decrement(NodeBase *node) {
+  if (node->size == 0) return node->right; /* end() to the rightmost */
+  if (node->left) return maximum(node->left);
+
+  NodeBase *p = node->parent();
+  while (node == p->left) {
+    node = p;
+    p = p->parent();
+  }
+  return p;
+}
+
 /* SEARCH LOGIC */
-template <typename K, typename V>
-typename RBTree<K, V>::Node *RBTree<K, V>::search(Node *node,
-                                                  const K &key) const {
-  while (node && key != node->key) {
-    node = (key < node->key) ? node->left : node->right;
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::Node *
+RBTree<K, V, KeyOfValue, Allocator>::search(NodeBase *node,
+                                            const K &key) const {
+  while (node && key != getKey(node)) {
+    node = (key < getKey(node)) ? node->left : node->right;
   }
-  return node;
+  return static_cast<Node *>(node);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::NodeBase *
+RBTree<K, V, KeyOfValue, Allocator>::lowerBound(const K &key) const {
+  NodeBase *node = getRoot();
+  NodeBase *res = headerNode();
+  while (node) {
+    if (getKey(node) < key) {
+      node = node->right;
+    } else {
+      res = node;
+      node = node->left;
+    }
+  }
+  return res;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::NodeBase *
+RBTree<K, V, KeyOfValue, Allocator>::upperBound(const K &key) const {
+  NodeBase *node = getRoot();
+  NodeBase *res = headerNode();
+  while (node) {
+    if (key < getKey(node)) {
+      res = node;
+      node = node->left;
+    } else {
+      node = node->right;
+    }
+  }
+  return res;
 }
 
 /* ACCESSORS AND MUTATORS */
-template <typename K, typename V>
-typename RBTree<K, V>::Node const *RBTree<K, V>::cgetRoot() const {
-  return root_;
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::Node const *
+RBTree<K, V, KeyOfValue, Allocator>::cgetRoot() const {
+  return getRoot();
+}
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::Node *
+RBTree<K, V, KeyOfValue, Allocator>::getRoot() const {
+  return static_cast<Node *>(header_.parent());
 }
-template <typename K, typename V>
-typename RBTree<K, V>::Node *RBTree<K, V>::getRoot() const {
-  return root_;
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void RBTree<K, V, KeyOfValue, Allocator>::setRoot(NodeBase *root) noexcept {
+  header_.setParent(root);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+Color RBTree<K, V, KeyOfValue, Allocator>::getColor(NodeBase *node) {
+  return node ? node->color() : BLACK;
 }
 
-template <typename K, typename V>
-void RBTree<K, V>::setRoot(Node *root) noexcept {
-  root_ = root;
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void RBTree<K, V, KeyOfValue, Allocator>::setColor(NodeBase *node,
+                                                   Color color) {
+  if (node) node->setColor(color);
 }
 
-template <typename K, typename V>
-Color RBTree<K, V>::getColor(Node *node) const {
-  return node ? node->color : BLACK;
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::size_type
+RBTree<K, V, KeyOfValue, Allocator>::getSize(const NodeBase *node) {
+  return node ? node->size : 0;
 }
 
-template <typename K, typename V>
-void RBTree<K, V>::setColor(Node *node, Color color) {
-  if (node) node->color = color;
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+const K &RBTree<K, V, KeyOfValue, Allocator>::getKey(const NodeBase *node) {
+  return KeyOfValue()(static_cast<const Node *>(node)->value);
 }
 
 /* ITERATOR */
-template <typename K, typename V>
-typename RBTree<K, V>::Iterator RBTree<K, V>::begin() {
-  return iterator(minimum(getRoot()));
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::Iterator
+RBTree<K, V, KeyOfValue, Allocator>::begin() {
+  return iterator(header_.left);
 }
 
-template <typename K, typename V>
-typename RBTree<K, V>::Iterator RBTree<K, V>::end() {
-  return iterator(nullptr);
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::Iterator
+RBTree<K, V, KeyOfValue, Allocator>::end() {
+  return iterator(&header_);
 }
 
-template <typename K, typename V>
-typename RBTree<K, V>::ConstIterator RBTree<K, V>::cbegin() const {
-  return const_iterator(minimum(getRoot()));
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::ConstIterator
+RBTree<K, V, KeyOfValue, Allocator>::cbegin() const {
+  return const_iterator(header_.left);
 }
 
-template <typename K, typename V>
-typename RBTree<K, V>::ConstIterator RBTree<K, V>::cend() const {
-  return const_iterator(nullptr);
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::ConstIterator
+RBTree<K, V, KeyOfValue, Allocator>::cend() const {
+  return const_iterator(headerNode());
 }
 
-template <typename K, typename V>
-typename RBTree<K, V>::Iterator RBTree<K, V>::find(const key_type &key) {
-  return iterator(search(getRoot(), key));
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::Iterator
+RBTree<K, V, KeyOfValue, Allocator>::find(const key_type &key) {
+  Node *node = search(getRoot(), key);
+  return node ? iterator(node) : end();
 }
 
-/* ITERATOR CLASS */
-template <typename K, typename V>
-RBTree<K, V>::Iterator::Iterator() : current_(nullptr), prev_(nullptr) {}
+/* BOUNDED QUERIES */
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::Iterator
+RBTree<K, V, KeyOfValue, Allocator>::lower_bound(const key_type &key) {
+  return iterator(lowerBound(key));
+}
 
-template <typename K, typename V>
-RBTree<K, V>::Iterator::Iterator(Node *node) : current_(node) {
-  if (current_) {
-    prev_ = predecessor(current_);
-  }
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::ConstIterator
+RBTree<K, V, KeyOfValue, Allocator>::lower_bound(const key_type &key) const {
+  return const_iterator(lowerBound(key));
 }
 
-template <typename K, typename V>
-RBTree<K, V>::Iterator::Iterator(const Iterator &other)
-    : current_(other.current_), prev_(other.prev_) {}
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::Iterator
+RBTree<K, V, KeyOfValue, Allocator>::upper_bound(const key_type &key) {
+  return iterator(upperBound(key));
+}
 
-template <typename K, typename V>
-typename RBTree<K, V>::iterator &RBTree<K, V>::Iterator::operator++() {
-  if (current_) {
-    prev_ = current_;
-    current_ = successor(current_);
-  }
-  return *this;
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::ConstIterator
+RBTree<K, V, KeyOfValue, Allocator>::upper_bound(const key_type &key) const {
+  return const_iterator(upperBound(key));
 }
 
-template <typename K, typename V>
-typename RBTree<K, V>::Iterator &RBTree<K, V>::Iterator::operator=(
-    const Iterator &other) {
-  if (this != &other) {
-    this->current_ = other.current_;
-    this->prev_ = other.prev_;
-  }
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+std::pair<typename RBTree<K, V, KeyOfValue, Allocator>::iterator,
+          typename RBTree<K, V, KeyOfValue, Allocator>::iterator>
+RBTree<K, V, KeyOfValue, Allocator>::equal_range(const key_type &key) {
+  auto res = static_cast<const RBTree *>(this)->equal_range(key);
+  return {iterator(res.first), iterator(res.second)};
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+std::pair<typename RBTree<K, V, KeyOfValue, Allocator>::const_iterator,
+          typename RBTree<K, V, KeyOfValue, Allocator>::const_iterator>
+RBTree<K, V, KeyOfValue, Allocator>::equal_range(const key_type &key) const {
+  /* keys are unique: the range is empty or the lower bound alone */
+  NodeBase *first = lowerBound(key);
+  NodeBase *last = first;
+  if (first != &header_ && !(key < getKey(first))) last = increment(first);
+  return {const_iterator(first), const_iterator(last)};
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+range_view<typename RBTree<K, V, KeyOfValue, Allocator>::iterator>
+RBTree<K, V, KeyOfValue, Allocator>::range(const key_type &lo,
+                                           const key_type &hi) {
+  auto res = static_cast<const RBTree *>(this)->range(lo, hi);
+  return {iterator(res.begin()), iterator(res.end())};
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+range_view<typename RBTree<K, V, KeyOfValue, Allocator>::const_iterator>
+RBTree<K, V, KeyOfValue, Allocator>::range(const key_type &lo,
+                                           const key_type &hi) const {
+  NodeBase *first = lowerBound(lo);
+  NodeBase *last = lo < hi ? lowerBound(hi) : first;
+  return {const_iterator(first), const_iterator(last)};
+}
+
+/* ITERATOR CLASS */
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+RBTree<K, V, KeyOfValue, Allocator>::Iterator::Iterator() : current_(nullptr) {}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+RBTree<K, V, KeyOfValue, Allocator>::Iterator::Iterator(NodeBase *node)
+    : current_(node) {}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::iterator &
+RBTree<K, V, KeyOfValue, Allocator>::Iterator::operator++() {
+  if (current_ && current_->size) current_ = increment(current_);
   return *this;
 }
 
-template <typename K, typename V>
-typename RBTree<K, V>::iterator &RBTree<K, V>::Iterator::operator--() {
-  if (current_) {
-    Node *pred = predecessor(current_);
-    if (pred) {
-      current_ = pred;
-      prev_ = predecessor(current_);
-    }
-  } else {
-    current_ = prev_;
-  }
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::iterator &
+RBTree<K, V, KeyOfValue, Allocator>::Iterator::operator--() {
+  if (current_) current_ = decrement(current_);
   return *this;
 }
 
-template <typename K, typename V>
-typename RBTree<K, V>::iterator RBTree<K, V>::Iterator::operator++(int) {
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::iterator
+RBTree<K, V, KeyOfValue, Allocator>::Iterator::operator++(int) {
   Iterator tmp = *this;
   ++(*this);
   return tmp;
 }
 
-template <typename K, typename V>
-typename RBTree<K, V>::iterator RBTree<K, V>::Iterator::operator--(int) {
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::iterator
+RBTree<K, V, KeyOfValue, Allocator>::Iterator::operator--(int) {
   Iterator tmp = *this;
   --(*this);
   return tmp;
 }
 
-template <typename K, typename V>
-typename RBTree<K, V>::reference RBTree<K, V>::Iterator::operator*() {
-  if (!current_) {
-    throw std::logic_error("Dereferencing nullptr");
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::reference
+RBTree<K, V, KeyOfValue, Allocator>::Iterator::operator*() {
+  Node *node = getNode();
+  if (!node) {
+    throw std::logic_error("Dereferencing end iterator");
   }
-  return current_->value;
+  return node->value;
 }
 
-template <typename K, typename V>
-typename RBTree<K, V>::value_type *RBTree<K, V>::Iterator::operator->() {
-  if (!current_) {
-    throw std::logic_error("Dereferencing nullptr");
-  }
-  return &(current_->value);
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::value_type *
+RBTree<K, V, KeyOfValue, Allocator>::Iterator::operator->() {
+  return &**this;
 }
 
-template <typename K, typename V>
-bool RBTree<K, V>::Iterator::operator==(const iterator &other) const {
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+bool RBTree<K, V, KeyOfValue, Allocator>::Iterator::operator==(
+    const iterator &other) const {
   return current_ == other.current_;
 }
 
-template <typename K, typename V>
-bool RBTree<K, V>::Iterator::operator!=(const iterator &other) const {
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+bool RBTree<K, V, KeyOfValue, Allocator>::Iterator::operator!=(
+    const iterator &other) const {
   return current_ != other.current_;
 }
 
-/* ITERATOR HELPERS */
-template <typename K, typename V>
-typename RBTree<K, V>::Node *RBTree<K, V>::Iterator::successor(Node *node) {
-  if (!node) return nullptr;
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::Node *
+RBTree<K, V, KeyOfValue, Allocator>::Iterator::getNode() const {
+  return current_ && current_->size ? static_cast<Node *>(current_) : nullptr;
+}
 
-  Node *res;
+/* OTHER HELPERS */
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::Node *
+RBTree<K, V, KeyOfValue, Allocator>::cloneNode(const NodeBase *node,
+                                               NodeBase *parent) {
+  Node *copy = createNode(static_cast<const Node *>(node)->value);
+  copy->setParent(parent);
+  copy->setColor(node->color());
+  copy->size = node->size;
+  return copy;
+}
 
-  if (node->right) {
-    Node *succ = node->right;
-    while (succ->left) {
-      succ = succ->left;
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::NodeBase *
+RBTree<K, V, KeyOfValue, Allocator>::copyTree(const NodeBase *node,
+                                              NodeBase *parent) {
+  if (!node) return nullptr;
+  NodeBase *root = cloneNode(node, parent);
+  try {
+    /* pre-order walk, climbing back up through the parent links */
+    const NodeBase *from = node;
+    NodeBase *to = root;
+    while (true) {
+      if (from->left && !to->left) {
+        to->left = cloneNode(from->left, to);
+        from = from->left;
+        to = to->left;
+      } else if (from->right && !to->right) {
+        to->right = cloneNode(from->right, to);
+        from = from->right;
+        to = to->right;
+      } else if (from != node) {
+        from = from->parent();
+        to = to->parent();
+      } else {
+        break;
+      }
     }
-    res = succ;
+  } catch (...) {
+    clearNode(root);
+    throw;
+  }
+  return root;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::NodeBase *
+RBTree<K, V, KeyOfValue, Allocator>::copyTreeParallel(const NodeBase *node,
+                                                      NodeBase *parent,
+                                                      unsigned threads) {
+  if (threads < 2 || getSize(node) < kParallelCopyThreshold) {
+    return copyTree(node, parent);
+  }
+
+  Node *root = cloneNode(node, parent);
+  NodeBase *left = nullptr, *right = nullptr;
+  std::exception_ptr error;
+  std::thread worker;
+  try {
+    worker = std::thread([&] {
+      try {
+        left = copyTreeParallel(node->left, root, threads / 2);
+      } catch (...) {
+        error = std::current_exception();
+      }
+    });
+  } catch (const std::system_error &) {
+    destroyNode(root);
+    return copyTree(node, parent);
+  }
+
+  try {
+    right = copyTreeParallel(node->right, root, threads - threads / 2);
+  } catch (...) {
+    worker.join();
+    clearNode(left);
+    destroyNode(root);
+    throw;
+  }
+  worker.join();
+  if (error) {
+    clearNode(right);
+    destroyNode(root);
+    std::rethrow_exception(error);
+  }
+  root->left = left;
+  root->right = right;
+  return root;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void RBTree<K, V, KeyOfValue, Allocator>::copyFrom(const RBTree &other) {
+  unsigned threads = 1;
+  if (node_traits::is_always_equal::value &&
+      other.size_ >= kParallelCopyThreshold) {
+    threads = std::thread::hardware_concurrency();
+  }
+  NodeBase *root = copyTreeParallel(other.getRoot(), &header_, threads);
+  if (root) resetHeader(root, minimum(root), maximum(root));
+  size_ = other.size_;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::NodeBase *
+RBTree<K, V, KeyOfValue, Allocator>::buildBalanced(NodeBase *&chain,
+                                                   size_type n,
+                                                   size_type depth,
+                                                   size_type red_depth) {
+  if (n == 0) return nullptr;
+
+  size_type left_n = (n - 1) / 2;
+  NodeBase *left = buildBalanced(chain, left_n, depth + 1, red_depth);
+  NodeBase *node = chain;
+  chain = chain->right;
+
+  node->left = left;
+  if (left) left->setParent(node);
+  node->right = buildBalanced(chain, n - 1 - left_n, depth + 1, red_depth);
+  if (node->right) node->right->setParent(node);
+  node->size = n;
+  node->setColor(depth == red_depth ? RED : BLACK);
+  return node;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::size_type
+RBTree<K, V, KeyOfValue, Allocator>::redDepth(size_type n) {
+  size_type depth = 0; /* floor(log2(n + 1)) */
+  for (size_type k = n + 1; k > 1; k >>= 1) ++depth;
+  return depth;
+}
+
+/* JOIN AND SPLIT */
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::Subtree
+RBTree<K, V, KeyOfValue, Allocator>::detachAll() {
+  Subtree tree{header_.parent(), 0};
+  if (tree.root) {
+    tree.root->setParent(nullptr);
+    tree.root->setColor(BLACK);
+  }
+  for (NodeBase *node = tree.root; node; node = node->left) {
+    if (node->color() == BLACK) ++tree.bh;
+  }
+  resetHeader(nullptr, nullptr, nullptr);
+  size_ = 0;
+  return tree;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void RBTree<K, V, KeyOfValue, Allocator>::attach(Subtree tree) {
+  NodeBase *root = tree.root;
+  if (root) {
+    resetHeader(root, minimum(root), maximum(root));
   } else {
-    Node *p = node->parent;
-    while (p && node == p->right) {
-      node = p;
-      p = p->parent;
+    resetHeader(nullptr, nullptr, nullptr);
+  }
+  size_ = getSize(root);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::Subtree
+RBTree<K, V, KeyOfValue, Allocator>::child(NodeBase *node,
+                                           size_type parent_bh) {
+  /* the parent is a detached root, so it is black */
+  Subtree tree{node, parent_bh - 1};
+  if (node) {
+    node->setParent(nullptr);
+    if (node->color() == RED) {
+      node->setColor(BLACK);
+      ++tree.bh;
     }
-    res = p;
   }
+  return tree;
+}
 
-  return res;
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::NodeBase *
+RBTree<K, V, KeyOfValue, Allocator>::link(NodeBase *left, NodeBase *node,
+                                          NodeBase *right) {
+  node->left = left;
+  node->right = right;
+  if (left) left->setParent(node);
+  if (right) right->setParent(node);
+  node->size = getSize(left) + getSize(right) + 1;
+  return node;
 }
 
-template <typename K, typename V>
-typename RBTree<K, V>::Node *RBTree<K, V>::Iterator::predecessor(Node *node) {
-  if (!node) return nullptr;
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::NodeBase *
+RBTree<K, V, KeyOfValue, Allocator>::rotateLeftDetached(NodeBase *x) {
+  NodeBase *y = x->right;
+  link(x->left, x, y->left);
+  return link(x, y, y->right);
+}
 
-  Node *res;
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::NodeBase *
+RBTree<K, V, KeyOfValue, Allocator>::rotateRightDetached(NodeBase *y) {
+  NodeBase *x = y->left;
+  link(x->right, y, y->right);
+  return link(x->left, x, y);
+}
 
-  if (node->left) {
-    Node *pred = node->left;
-    while (pred->right) {
-      pred = pred->right;
-    }
-    res = pred;
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::NodeBase *
+RBTree<K, V, KeyOfValue, Allocator>::joinRight(NodeBase *left,
+                                               size_type left_bh,
+                                               NodeBase *node,
+                                               Subtree right) {
+  /* walk down the right spine of left to a black node as high as right */
+  if (left_bh == right.bh && (!left || left->color() == BLACK)) {
+    node->setColor(RED);
+    return link(left, node, right.root);
+  }
+
+  bool black = left->color() == BLACK;
+  NodeBase *sub = joinRight(left->right, left_bh - black, node, right);
+  link(left->left, left, sub);
+  if (black && sub->color() == RED && getColor(sub->right) == RED) {
+    sub->right->setColor(BLACK);
+    return rotateLeftDetached(left);
+  }
+  return left;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::NodeBase *
+RBTree<K, V, KeyOfValue, Allocator>::joinLeft(Subtree left, NodeBase *node,
+                                              NodeBase *right,
+                                              size_type right_bh) {
+  if (right_bh == left.bh && (!right || right->color() == BLACK)) {
+    node->setColor(RED);
+    return link(left.root, node, right);
+  }
+
+  bool black = right->color() == BLACK;
+  NodeBase *sub = joinLeft(left, node, right->left, right_bh - black);
+  link(sub, right, right->right);
+  if (black && sub->color() == RED && getColor(sub->left) == RED) {
+    sub->left->setColor(BLACK);
+    return rotateRightDetached(right);
+  }
+  return right;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::Subtree
+RBTree<K, V, KeyOfValue, Allocator>::join(Subtree left, NodeBase *node,
+                                          Subtree right) {
+  Subtree tree;
+  if (left.bh > right.bh) {
+    tree = {joinRight(left.root, left.bh, node, right), left.bh};
+  } else if (left.bh < right.bh) {
+    tree = {joinLeft(left, node, right.root, right.bh), right.bh};
   } else {
-    Node *p = node->parent;
-    while (p && node == p->left) {
-      node = p;
-      p = p->parent;
-    }
-    res = p;
+    node->setColor(BLACK);
+    return {link(left.root, node, right.root), left.bh + 1};
   }
+  if (tree.root->color() == RED) {
+    tree.root->setColor(BLACK);
+    ++tree.bh;
+  }
+  return tree;
+}
 
-  return res;
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::Subtree
+RBTree<K, V, KeyOfValue, Allocator>::join2(Subtree left, Subtree right) {
+  if (!left.root) return right;
+  if (!right.root) return left;
+  std::pair<Subtree, NodeBase *> last = splitLast(left);
+  return join(last.first, last.second, right);
 }
 
-template <typename K, typename V>
-typename RBTree<K, V>::Node *RBTree<K, V>::Iterator::getNode() const {
-  return current_;
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+std::pair<typename RBTree<K, V, KeyOfValue, Allocator>::Subtree,
+          typename RBTree<K, V, KeyOfValue, Allocator>::NodeBase *>
+RBTree<K, V, KeyOfValue, Allocator>::splitLast(Subtree tree) {
+  NodeBase *root = tree.root;
+  Subtree left = child(root->left, tree.bh);
+  if (!root->right) return std::make_pair(left, root);
+
+  std::pair<Subtree, NodeBase *> last =
+      splitLast(child(root->right, tree.bh));
+  return std::make_pair(join(left, root, last.first), last.second);
 }
 
-/* OTHER HELPERS */
-template <typename K, typename V>
-typename RBTree<K, V>::size_type RBTree<K, V>::countNodes(Node *node) const {
-  if (!node) return 0;
-  return 1 + countNodes(node->left) + countNodes(node->right);
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::SplitResult
+RBTree<K, V, KeyOfValue, Allocator>::splitAt(Subtree tree, const K &key) {
+  NodeBase *root = tree.root;
+  if (!root) return {tree, nullptr, tree};
+
+  Subtree left = child(root->left, tree.bh);
+  Subtree right = child(root->right, tree.bh);
+  if (key < getKey(root)) {
+    SplitResult res = splitAt(left, key);
+    res.right = join(res.right, root, right);
+    return res;
+  }
+  if (getKey(root) < key) {
+    SplitResult res = splitAt(right, key);
+    res.left = join(left, root, res.left);
+    return res;
+  }
+  root->left = root->right = nullptr;
+  return {left, root, right};
 }
 
-template <typename K, typename V>
-typename RBTree<K, V>::Node *RBTree<K, V>::copyTree(Node *node, Node *parent) {
-  if (!node) return nullptr;
-  Node *newNode = new Node(node->key, node->value);
-  newNode->parent = parent;
-  newNode->left = copyTree(node->left, newNode);
-  newNode->right = copyTree(node->right, newNode);
-  return newNode;
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void RBTree<K, V, KeyOfValue, Allocator>::append(Chain &chain, NodeBase *node) {
+  node->left = node->right = nullptr;
+  (chain.tail ? chain.tail->right : chain.head) = node;
+  chain.tail = node;
+  ++chain.size;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::Subtree
+RBTree<K, V, KeyOfValue, Allocator>::unite(Subtree a, Subtree b,
+                                           Chain &dropped) {
+  if (!a.root) return b;
+  if (!b.root) return a;
+
+  /* expose the smaller root and split the larger tree around its key */
+  bool a_exposed = a.root->size <= b.root->size;
+  Subtree exposed = a_exposed ? a : b;
+  NodeBase *root = exposed.root;
+  Subtree left = child(root->left, exposed.bh);
+  Subtree right = child(root->right, exposed.bh);
+  SplitResult parts = splitAt(a_exposed ? b : a, getKey(root));
+
+  /* left part first, so dropped nodes are chained in key order */
+  left = a_exposed ? unite(left, parts.left, dropped)
+                   : unite(parts.left, left, dropped);
+  NodeBase *middle = root;
+  if (parts.match) {
+    if (a_exposed) {
+      append(dropped, parts.match);
+    } else {
+      append(dropped, root);
+      middle = parts.match;
+    }
+  }
+  right = a_exposed ? unite(right, parts.right, dropped)
+                    : unite(parts.right, right, dropped);
+  return join(left, middle, right);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::Subtree
+RBTree<K, V, KeyOfValue, Allocator>::intersect(Subtree a, const NodeBase *b) {
+  if (!a.root) return a;
+  if (!b) {
+    clearNode(a.root);
+    return {nullptr, 0};
+  }
+
+  SplitResult parts = splitAt(a, getKey(b));
+  Subtree left = intersect(parts.left, b->left);
+  Subtree right = intersect(parts.right, b->right);
+  if (parts.match) return join(left, parts.match, right);
+  return join2(left, right);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::Subtree
+RBTree<K, V, KeyOfValue, Allocator>::subtract(Subtree a, const NodeBase *b) {
+  if (!a.root || !b) return a;
+
+  SplitResult parts = splitAt(a, getKey(b));
+  if (parts.match) destroyNode(parts.match);
+  Subtree left = subtract(parts.left, b->left);
+  return join2(left, subtract(parts.right, b->right));
 }
 
 /* PUBLIC METHODS */
-template <typename K, typename V>
-typename RBTree<K, V>::reference RBTree<K, V>::search(const key_type &key) {
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::reference
+RBTree<K, V, KeyOfValue, Allocator>::search(const key_type &key) {
   Node *node = search(getRoot(), key);
   if (!node) {
     throw std::out_of_range("RBTree::search(): Key not found");
@@ -576,84 +1179,287 @@ typename RBTree<K, V>::reference RBTree<K, V>::search(const key_type &key) {
   return node->value;
 }
 
-template <typename K, typename V>
-std::pair<typename RBTree<K, V>::iterator, bool> RBTree<K, V>::insert(
-    const key_type &key, const_reference val) {
-  std::pair<iterator, bool> res;
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+std::pair<typename RBTree<K, V, KeyOfValue, Allocator>::iterator, bool>
+RBTree<K, V, KeyOfValue, Allocator>::insert(const_reference value) {
+  return try_emplace(KeyOfValue()(value), value);
+}
 
-  if (!getRoot()) {
-    setRoot(new Node(key, val));
-    res = std::make_pair(iterator(getRoot()), true);
-  } else if (contains(key)) {
-    res = std::make_pair(iterator(search(getRoot(), key)), false);
-  } else {
-    Node *z = new Node(key, val);
-    insertNode(z);
-    fixInsert(z);
-    res = std::make_pair(iterator(z), true);
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+std::pair<typename RBTree<K, V, KeyOfValue, Allocator>::iterator, bool>
+RBTree<K, V, KeyOfValue, Allocator>::insert(value_type &&value) {
+  /* the key is only read during the descent, before value is moved from */
+  return try_emplace(KeyOfValue()(value), std::move(value));
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+template <class... Args>
+std::pair<typename RBTree<K, V, KeyOfValue, Allocator>::iterator, bool>
+RBTree<K, V, KeyOfValue, Allocator>::emplace(Args &&...args) {
+  Node *z = createNode(std::forward<Args>(args)...);
+  InsertPos pos = findInsertPos(getKey(z));
+  if (pos.node) {
+    destroyNode(z);
+    return std::make_pair(iterator(pos.node), false);
   }
 
-  return res;
+  insertNode(z, pos);
+  return std::make_pair(iterator(z), true);
 }
 
-template <typename K, typename V>
-std::pair<typename RBTree<K, V>::iterator, bool> RBTree<K, V>::insert_or_assign(
-    const key_type &key, const_reference val) {
-  Node *z = search(getRoot(), key);
-  if (z) deleteNode(z);
-  return insert(key, val);
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+template <class... Args>
+typename RBTree<K, V, KeyOfValue, Allocator>::iterator
+RBTree<K, V, KeyOfValue, Allocator>::emplace_hint(iterator hint,
+                                                  Args &&...args) {
+  Node *z = createNode(std::forward<Args>(args)...);
+  InsertPos pos = findInsertPos(hint.getNode(), getKey(z));
+  if (pos.node) {
+    destroyNode(z);
+    return iterator(pos.node);
+  }
+
+  insertNode(z, pos);
+  return iterator(z);
 }
 
-template <typename K, typename V>
-void RBTree<K, V>::remove(const key_type &key) {
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+template <class... Args>
+std::pair<typename RBTree<K, V, KeyOfValue, Allocator>::iterator, bool>
+RBTree<K, V, KeyOfValue, Allocator>::try_emplace(const key_type &key,
+                                                 Args &&...args) {
+  InsertPos pos = findInsertPos(key);
+  if (pos.node) return std::make_pair(iterator(pos.node), false);
+
+  Node *z = createNode(std::forward<Args>(args)...);
+  insertNode(z, pos);
+  return std::make_pair(iterator(z), true);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+template <class... Args>
+typename RBTree<K, V, KeyOfValue, Allocator>::iterator
+RBTree<K, V, KeyOfValue, Allocator>::try_emplace_hint(iterator hint,
+                                                      const key_type &key,
+                                                      Args &&...args) {
+  InsertPos pos = findInsertPos(hint.getNode(), key);
+  if (pos.node) return iterator(pos.node);
+
+  Node *z = createNode(std::forward<Args>(args)...);
+  insertNode(z, pos);
+  return iterator(z);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+template <class InputIt>
+void RBTree<K, V, KeyOfValue, Allocator>::assign_sorted(InputIt first,
+                                                        InputIt last) {
+  clear();
+
+  NodeBase *head = nullptr, *tail = nullptr;
+  Node *pending = nullptr; /* first element out of order, if any */
+  size_type n = 0;
+  try {
+    for (; first != last; ++first) {
+      Node *z = createNode(*first);
+      if (tail && !(getKey(tail) < getKey(z))) {
+        if (getKey(z) < getKey(tail)) {
+          pending = z;
+          ++first;
+          break;
+        }
+        destroyNode(z);
+        continue;
+      }
+      (tail ? tail->right : head) = z;
+      tail = z;
+      ++n;
+    }
+  } catch (...) {
+    while (head) {
+      NodeBase *next = head->right;
+      destroyNode(head);
+      head = next;
+    }
+    throw;
+  }
+
+  NodeBase *leftmost = head;
+  NodeBase *root = buildBalanced(head, n, 0, redDepth(n));
+  if (root) resetHeader(root, leftmost, tail);
+  size_ = n;
+
+  if (pending) {
+    InsertPos pos = findInsertPos(getKey(pending));
+    if (pos.node) {
+      destroyNode(pending);
+    } else {
+      insertNode(pending, pos);
+    }
+    for (; first != last; ++first) emplace(*first);
+  }
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void RBTree<K, V, KeyOfValue, Allocator>::remove(const key_type &key) {
   Node *z = search(getRoot(), key);
   if (z) deleteNode(z);
 }
 
-template <typename K, typename V>
-void RBTree<K, V>::erase(iterator pos) {
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void RBTree<K, V, KeyOfValue, Allocator>::erase(iterator pos) {
   Node *z = pos.getNode();
   if (z) deleteNode(z);
 }
 
-template <typename K, typename V>
-void RBTree<K, V>::swap(RBTree &other) noexcept {
-  std::swap(root_, other.root_);
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void RBTree<K, V, KeyOfValue, Allocator>::swap(RBTree &other) noexcept {
+  NodeBase *root = header_.parent();
+  NodeBase *leftmost = header_.left, *rightmost = header_.right;
+  resetHeader(other.header_.parent(), other.header_.left,
+              other.header_.right);
+  other.resetHeader(root, leftmost, rightmost);
+  std::swap(size_, other.size_);
+  if (node_traits::propagate_on_container_swap::value) {
+    std::swap(alloc_, other.alloc_);
+  }
 }
 
-template <typename K, typename V>
-void RBTree<K, V>::merge(RBTree &other) {
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void RBTree<K, V, KeyOfValue, Allocator>::merge(RBTree &other) {
   if (this == &other) {
     throw std::invalid_argument("RBTree::merge(): Cannot merge with itself");
   }
 
-  RBTree tmp = other;
+  if (alloc_ != other.alloc_) {
+    /* nodes cannot change owners, move the values one by one */
+    for (iterator it = other.begin(); it != other.end();) {
+      Node *node = (it++).getNode();
+      if (try_emplace(getKey(node), std::move(node->value)).second) {
+        other.deleteNode(node);
+      }
+    }
+    return;
+  }
+
+  Chain dropped{nullptr, nullptr, 0};
+  attach(unite(detachAll(), other.detachAll(), dropped));
 
-  for (auto it = tmp.begin(); it != tmp.end(); ++it) {
-    std::pair<iterator, bool> res =
-        insert(it.getNode()->key, it.getNode()->value);
-    if (res.second) other.remove(it.getNode()->key);
+  /* the duplicates go back to other, already in key order */
+  NodeBase *chain = dropped.head;
+  NodeBase *root =
+      buildBalanced(chain, dropped.size, 0, redDepth(dropped.size));
+  if (root) other.resetHeader(root, dropped.head, dropped.tail);
+  other.size_ = dropped.size;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void RBTree<K, V, KeyOfValue, Allocator>::set_union(RBTree &other) {
+  if (this == &other) return;
+  merge(other);
+  other.clear();
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void RBTree<K, V, KeyOfValue, Allocator>::set_intersection(
+    const RBTree &other) {
+  if (this == &other) return;
+  attach(intersect(detachAll(), other.getRoot()));
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+void RBTree<K, V, KeyOfValue, Allocator>::set_difference(const RBTree &other) {
+  if (this == &other) {
+    clear();
+    return;
   }
+  attach(subtract(detachAll(), other.getRoot()));
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+RBTree<K, V, KeyOfValue, Allocator>
+RBTree<K, V, KeyOfValue, Allocator>::split(const key_type &key) {
+  RBTree res(get_allocator());
+  SplitResult parts = splitAt(detachAll(), key);
+  Subtree right = parts.right;
+  if (parts.match) right = join({nullptr, 0}, parts.match, right);
+  attach(parts.left);
+  res.attach(right);
+  return res;
 }
 
-template <typename K, typename V>
-bool RBTree<K, V>::contains(const key_type &key) const {
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+bool RBTree<K, V, KeyOfValue, Allocator>::contains(const key_type &key) const {
   return search(getRoot(), key) != nullptr;
 }
 
-template <typename K, typename V>
-bool RBTree<K, V>::empty() const {
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+bool RBTree<K, V, KeyOfValue, Allocator>::empty() const {
   return getRoot() == nullptr;
 }
 
-template <typename K, typename V>
-size_t RBTree<K, V>::size() const {
-  return countNodes(getRoot());
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+size_t RBTree<K, V, KeyOfValue, Allocator>::size() const {
+  return size_;
 }
 
-template <typename K, typename V>
-size_t RBTree<K, V>::max_size() const {
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+size_t RBTree<K, V, KeyOfValue, Allocator>::max_size() const {
   return std::numeric_limits<size_t>::max() /
-         sizeof(typename RBTree<K, V>::Node);
+         sizeof(typename RBTree<K, V, KeyOfValue, Allocator>::Node);
+}
+
+/* ORDER STATISTICS */
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::Iterator
+RBTree<K, V, KeyOfValue, Allocator>::nth_element(size_type k) {
+  return iterator(nthNode(k));
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::ConstIterator
+RBTree<K, V, KeyOfValue, Allocator>::nth_element(size_type k) const {
+  return const_iterator(nthNode(k));
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::NodeBase *
+RBTree<K, V, KeyOfValue, Allocator>::nthNode(size_type k) const {
+  NodeBase *node = getRoot();
+  while (node) {
+    size_type left = getSize(node->left);
+    if (k < left) {
+      node = node->left;
+    } else if (k == left) {
+      return node;
+    } else {
+      k -= left + 1;
+      node = node->right;
+    }
+  }
+  return headerNode();
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::size_type
+RBTree<K, V, KeyOfValue, Allocator>::rank(const key_type &key) const {
+  size_type res = 0;
+  NodeBase *node = getRoot();
+  while (node) {
+    if (getKey(node) < key) {
+      res += getSize(node->left) + 1;
+      node = node->right;
+    } else {
+      node = node->left;
+    }
+  }
+  return res;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Allocator>
+typename RBTree<K, V, KeyOfValue, Allocator>::size_type
+RBTree<K, V, KeyOfValue, Allocator>::count_range(const key_type &lo,
+                                      const key_type &hi) const {
+  return lo < hi ? rank(hi) - rank(lo) : 0;
 }
-}  // namespace s21
\ No newline at end of file
+}  // namespace s21
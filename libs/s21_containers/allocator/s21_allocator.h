@@ -0,0 +1,124 @@
+#ifndef S21_ALLOCATOR_H_
+#define S21_ALLOCATOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+
+namespace s21 {
+
+/* Size-class free-list pool. Blocks up to kMaxBlock bytes are carved out of
+ * slabs and recycled through one free list per size class; larger or
+ * over-aligned requests go to the global heap. Slabs are returned to the
+ * heap only when the pool is destroyed. Not thread-safe. */
+class pool_resource {
+ public:
+  static constexpr std::size_t kAlignment = alignof(std::max_align_t);
+  static constexpr std::size_t kMaxBlock = 512;
+  static constexpr std::size_t kClasses = kMaxBlock / kAlignment;
+  static constexpr std::size_t kMinSlab = 4096;
+  static constexpr std::size_t kMaxSlab = std::size_t(1) << 20;
+
+  pool_resource() = default;
+  pool_resource(const pool_resource &) = delete;
+  pool_resource &operator=(const pool_resource &) = delete;
+  ~pool_resource();
+
+  void *allocate(std::size_t bytes, std::size_t alignment);
+  void deallocate(void *ptr, std::size_t bytes, std::size_t alignment) noexcept;
+  void release() noexcept;
+
+ private:
+  struct FreeBlock {
+    FreeBlock *next;
+  };
+  struct Slab {
+    Slab *next;
+  };
+
+  FreeBlock *free_[kClasses] = {};
+  Slab *slabs_ = nullptr;
+  std::size_t slab_size_ = kMinSlab;
+
+  void refill(std::size_t index);
+};
+
+/* Monotonic arena: allocation bumps a pointer inside the current block,
+ * deallocation is a no-op and memory is returned all at once by release()
+ * or the destructor. Not thread-safe. */
+class arena_resource {
+ public:
+  explicit arena_resource(std::size_t initial_block = 4096);
+  arena_resource(const arena_resource &) = delete;
+  arena_resource &operator=(const arena_resource &) = delete;
+  ~arena_resource();
+
+  void *allocate(std::size_t bytes, std::size_t alignment);
+  void deallocate(void *, std::size_t, std::size_t) noexcept {}
+  void release() noexcept;
+
+ private:
+  struct Block {
+    Block *next;
+  };
+
+  Block *blocks_;
+  char *current_;
+  char *end_;
+  std::size_t next_size_;
+};
+
+/* Allocators over a shared resource. Copies and rebinds share the resource,
+ * a default-constructed allocator creates its own. */
+template <typename T, typename Resource>
+class resource_allocator {
+ public:
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  template <typename U>
+  struct rebind {
+    using other = resource_allocator<U, Resource>;
+  };
+
+  resource_allocator() : resource_(std::make_shared<Resource>()) {}
+  explicit resource_allocator(std::shared_ptr<Resource> resource)
+      : resource_(std::move(resource)) {}
+  resource_allocator(const resource_allocator &other) noexcept
+      : resource_(other.resource_) {}
+  template <typename U>
+  resource_allocator(const resource_allocator<U, Resource> &other) noexcept
+      : resource_(other.resource()) {}
+  resource_allocator &operator=(const resource_allocator &other) noexcept;
+
+  T *allocate(std::size_t n);
+  void deallocate(T *ptr, std::size_t n) noexcept;
+
+  const std::shared_ptr<Resource> &resource() const noexcept {
+    return resource_;
+  }
+
+ private:
+  std::shared_ptr<Resource> resource_;
+};
+
+template <typename T, typename U, typename Resource>
+bool operator==(const resource_allocator<T, Resource> &a,
+                const resource_allocator<U, Resource> &b) noexcept;
+template <typename T, typename U, typename Resource>
+bool operator!=(const resource_allocator<T, Resource> &a,
+                const resource_allocator<U, Resource> &b) noexcept;
+
+template <typename T>
+using pool_allocator = resource_allocator<T, pool_resource>;
+template <typename T>
+using arena_allocator = resource_allocator<T, arena_resource>;
+
+}  // namespace s21
+
+#include "s21_allocator.tpp"
+
+#endif  // S21_ALLOCATOR_H_
@@ -0,0 +1,146 @@
+#include "s21_allocator.h"
+
+namespace s21 {
+
+/* POOL RESOURCE */
+inline pool_resource::~pool_resource() { release(); }
+
+inline void *pool_resource::allocate(std::size_t bytes,
+                                     std::size_t alignment) {
+  if (bytes == 0) bytes = 1;
+  if (bytes > kMaxBlock || alignment > kAlignment) {
+    return ::operator new(bytes, std::align_val_t(alignment));
+  }
+
+  std::size_t index = (bytes - 1) / kAlignment;
+  if (!free_[index]) refill(index);
+
+  FreeBlock *block = free_[index];
+  free_[index] = block->next;
+  return block;
+}
+
+inline void pool_resource::deallocate(void *ptr, std::size_t bytes,
+                                      std::size_t alignment) noexcept {
+  if (!ptr) return;
+  if (bytes == 0) bytes = 1;
+  if (bytes > kMaxBlock || alignment > kAlignment) {
+    ::operator delete(ptr, std::align_val_t(alignment));
+    return;
+  }
+
+  std::size_t index = (bytes - 1) / kAlignment;
+  FreeBlock *block = static_cast<FreeBlock *>(ptr);
+  block->next = free_[index];
+  free_[index] = block;
+}
+
+inline void pool_resource::release() noexcept {
+  while (slabs_) {
+    Slab *next = slabs_->next;
+    ::operator delete(slabs_);
+    slabs_ = next;
+  }
+  for (std::size_t i = 0; i < kClasses; ++i) free_[i] = nullptr;
+  slab_size_ = kMinSlab;
+}
+
+inline void pool_resource::refill(std::size_t index) {
+  std::size_t block_size = (index + 1) * kAlignment;
+  std::size_t slab_size = slab_size_;
+  if (slab_size < kAlignment + block_size) slab_size = kAlignment + block_size;
+
+  Slab *slab = static_cast<Slab *>(::operator new(slab_size));
+  slab->next = slabs_;
+  slabs_ = slab;
+  if (slab_size_ < kMaxSlab) slab_size_ *= 2;
+
+  /* first kAlignment bytes hold the slab header, the rest is carved up */
+  char *begin = reinterpret_cast<char *>(slab) + kAlignment;
+  char *end = reinterpret_cast<char *>(slab) + slab_size;
+  for (char *ptr = begin; ptr + block_size <= end; ptr += block_size) {
+    FreeBlock *block = reinterpret_cast<FreeBlock *>(ptr);
+    block->next = free_[index];
+    free_[index] = block;
+  }
+}
+
+/* ARENA RESOURCE */
+inline arena_resource::arena_resource(std::size_t initial_block)
+    : blocks_(nullptr),
+      current_(nullptr),
+      end_(nullptr),
+      next_size_(initial_block ? initial_block : 4096) {}
+
+inline arena_resource::~arena_resource() { release(); }
+
+inline void *arena_resource::allocate(std::size_t bytes,
+                                      std::size_t alignment) {
+  std::uintptr_t cur = reinterpret_cast<std::uintptr_t>(current_);
+  std::uintptr_t aligned = (cur + alignment - 1) & ~(alignment - 1);
+
+  if (!current_ || aligned + bytes > reinterpret_cast<std::uintptr_t>(end_)) {
+    std::size_t header = sizeof(Block) > alignof(std::max_align_t)
+                             ? sizeof(Block)
+                             : alignof(std::max_align_t);
+    std::size_t size = next_size_;
+    while (size < header + bytes + alignment) size *= 2;
+
+    Block *block = static_cast<Block *>(::operator new(size));
+    block->next = blocks_;
+    blocks_ = block;
+    next_size_ = size * 2;
+
+    current_ = reinterpret_cast<char *>(block) + header;
+    end_ = reinterpret_cast<char *>(block) + size;
+    cur = reinterpret_cast<std::uintptr_t>(current_);
+    aligned = (cur + alignment - 1) & ~(alignment - 1);
+  }
+
+  current_ = reinterpret_cast<char *>(aligned + bytes);
+  return reinterpret_cast<void *>(aligned);
+}
+
+inline void arena_resource::release() noexcept {
+  while (blocks_) {
+    Block *next = blocks_->next;
+    ::operator delete(blocks_);
+    blocks_ = next;
+  }
+  current_ = nullptr;
+  end_ = nullptr;
+}
+
+/* RESOURCE ALLOCATOR */
+template <typename T, typename Resource>
+resource_allocator<T, Resource> &resource_allocator<T, Resource>::operator=(
+    const resource_allocator &other) noexcept {
+  resource_ = other.resource_;
+  return *this;
+}
+
+template <typename T, typename Resource>
+T *resource_allocator<T, Resource>::allocate(std::size_t n) {
+  if (n > std::size_t(-1) / sizeof(T)) throw std::bad_alloc();
+  return static_cast<T *>(resource_->allocate(n * sizeof(T), alignof(T)));
+}
+
+template <typename T, typename Resource>
+void resource_allocator<T, Resource>::deallocate(T *ptr,
+                                                 std::size_t n) noexcept {
+  resource_->deallocate(ptr, n * sizeof(T), alignof(T));
+}
+
+template <typename T, typename U, typename Resource>
+bool operator==(const resource_allocator<T, Resource> &a,
+                const resource_allocator<U, Resource> &b) noexcept {
+  return a.resource() == b.resource();
+}
+
+template <typename T, typename U, typename Resource>
+bool operator!=(const resource_allocator<T, Resource> &a,
+                const resource_allocator<U, Resource> &b) noexcept {
+  return !(a == b);
+}
+
+}  // namespace s21
@@ -0,0 +1,235 @@
+#ifndef S21_DEQUE_H
+#define S21_DEQUE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+/* Double-ended queue in fixed-size blocks. A map of block pointers grows
+ * at either end, so push and pop at both ends are amortized O(1), an
+ * element never moves once constructed (references stay valid until it is
+ * erased) and element i is two index computations away.
+ *
+ * One emptied block is kept as a spare, so a queue that pushes at the back
+ * and pops at the front cycles blocks without touching the allocator. */
+template <typename T, typename Allocator = std::allocator<T>>
+class deque {
+ public:
+  template <bool Const>
+  class DequeIterator;
+
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = DequeIterator<false>;
+  using const_iterator = DequeIterator<true>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using allocator_type = Allocator;
+
+  /* Random-access iterator: the deque and an index into it */
+  template <bool Const>
+  class DequeIterator {
+    using owner_type = std::conditional_t<Const, const deque, deque>;
+
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T*, T*>;
+    using reference = std::conditional_t<Const, const T&, T&>;
+
+    DequeIterator() : owner_(nullptr), index_(0) {}
+    DequeIterator(owner_type* owner, size_type index)
+        : owner_(owner), index_(index) {}
+    template <bool C = Const, typename = std::enable_if_t<C>>
+    DequeIterator(const DequeIterator<false>& other)
+        : owner_(other.owner_), index_(other.index_) {}
+
+    reference operator*() const { return *owner_->slot(index_); }
+    pointer operator->() const { return owner_->slot(index_); }
+    reference operator[](difference_type n) const {
+      return *owner_->slot(index_ + n);
+    }
+
+    DequeIterator& operator++() {
+      ++index_;
+      return *this;
+    }
+    DequeIterator operator++(int) {
+      DequeIterator tmp(*this);
+      ++index_;
+      return tmp;
+    }
+    DequeIterator& operator--() {
+      --index_;
+      return *this;
+    }
+    DequeIterator operator--(int) {
+      DequeIterator tmp(*this);
+      --index_;
+      return tmp;
+    }
+    DequeIterator& operator+=(difference_type n) {
+      index_ += n;
+      return *this;
+    }
+    DequeIterator& operator-=(difference_type n) {
+      index_ -= n;
+      return *this;
+    }
+    DequeIterator operator+(difference_type n) const {
+      return DequeIterator(owner_, index_ + n);
+    }
+    friend DequeIterator operator+(difference_type n, DequeIterator it) {
+      return it + n;
+    }
+    DequeIterator operator-(difference_type n) const {
+      return DequeIterator(owner_, index_ - n);
+    }
+    difference_type operator-(const DequeIterator& other) const {
+      return difference_type(index_) - difference_type(other.index_);
+    }
+
+    bool operator==(const DequeIterator& other) const {
+      return index_ == other.index_ && owner_ == other.owner_;
+    }
+    bool operator!=(const DequeIterator& other) const {
+      return !(*this == other);
+    }
+    bool operator<(const DequeIterator& other) const {
+      return index_ < other.index_;
+    }
+    bool operator>(const DequeIterator& other) const { return other < *this; }
+    bool operator<=(const DequeIterator& other) const {
+      return !(other < *this);
+    }
+    bool operator>=(const DequeIterator& other) const {
+      return !(*this < other);
+    }
+
+   private:
+    friend class DequeIterator<!Const>;
+
+    owner_type* owner_;
+    size_type index_;
+  };
+
+  deque();
+  explicit deque(const allocator_type& alloc);
+  explicit deque(size_type n);
+  deque(std::initializer_list<value_type> const& items);
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+  deque(InputIt first, InputIt last);
+  deque(const deque& other);
+  deque(deque&& other) noexcept;
+  deque& operator=(const deque& other);
+  /* Allocators move along only as their propagate_on_container_* traits
+   * say; a move between unequal ones moves the elements one by one */
+  deque& operator=(deque&& other) noexcept(
+      block_traits::propagate_on_container_move_assignment::value ||
+      block_traits::is_always_equal::value);
+  ~deque();
+
+  allocator_type get_allocator() const;
+
+  /* operator[] is unchecked, at() throws std::out_of_range */
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos) { return *slot(pos); }
+  const_reference operator[](size_type pos) const { return *slot(pos); }
+  /* Undefined on an empty deque */
+  reference front() { return *slot(0); }
+  const_reference front() const { return *slot(0); }
+  reference back() { return *slot(size_ - 1); }
+  const_reference back() const { return *slot(size_ - 1); }
+
+  iterator begin() { return iterator(this, 0); }
+  iterator end() { return iterator(this, size_); }
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const { return const_iterator(this, size_); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type max_size() const;
+  /* Free the spare block and shrink the block map to the used blocks */
+  void shrink_to_fit();
+
+  void push_back(const_reference value);
+  void push_back(value_type&& value);
+  void push_front(const_reference value);
+  void push_front(value_type&& value);
+  template <class... Args>
+  reference emplace_back(Args&&... args);
+  template <class... Args>
+  reference emplace_front(Args&&... args);
+  /* No-ops on an empty deque, like list */
+  void pop_back();
+  void pop_front();
+  void clear();
+  void swap(deque& other) noexcept;
+
+  template <class... Args>
+  void insert_many_back(Args&&... args);
+  template <class... Args>
+  void insert_many_front(Args&&... args);
+
+ private:
+  using block_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<T>;
+  using block_traits = std::allocator_traits<block_allocator>;
+  using map_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<T*>;
+  using map_traits = std::allocator_traits<map_allocator>;
+
+  /* Elements per block: about 512 bytes, a power of two and at least 16 */
+  static constexpr size_type blockSize() {
+    size_type size = 16;
+    while (size * 2 * sizeof(T) <= 512) size *= 2;
+    return size;
+  }
+  static constexpr size_type kBlockSize = blockSize();
+  static constexpr size_type kMinMapSize = 8;
+
+  /* Element i lives at position start_ + i of the blocks in map_; the map
+   * entries of blocks holding no element are null */
+  T** map_;
+  size_type map_size_;
+  size_type start_;
+  size_type size_;
+  T* spare_;
+  block_allocator alloc_;
+
+  T* slot(size_type pos) const {
+    pos += start_;
+    return map_[pos / kBlockSize] + pos % kBlockSize;
+  }
+
+  T* allocateBlock();
+  void releaseBlock(size_type block);
+  void freeBlock(T* block);
+  /* Make room for one more block before the first (or after the last)
+   * used block: recentre the used blocks, or move them to a map twice as
+   * large when more than half of it is in use */
+  void growMap(bool at_front);
+  void freeMap();
+  /* Exchange the elements and blocks, not the allocators */
+  void swapStorage(deque& other) noexcept;
+};
+
+}  // namespace s21
+
+#include "s21_deque.tpp"
+
+#endif /* S21_DEQUE_H */
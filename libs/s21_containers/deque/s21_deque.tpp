@@ -0,0 +1,325 @@
+#include "s21_deque.h"
+
+namespace s21 {
+
+template <typename T, typename Allocator>
+deque<T, Allocator>::deque() : deque(allocator_type()) {}
+
+template <typename T, typename Allocator>
+deque<T, Allocator>::deque(const allocator_type& alloc)
+    : map_(nullptr),
+      map_size_(0),
+      start_(0),
+      size_(0),
+      spare_(nullptr),
+      alloc_(alloc) {}
+
+template <typename T, typename Allocator>
+deque<T, Allocator>::deque(size_type n) : deque() {
+  while (size_ < n) emplace_back();
+}
+
+template <typename T, typename Allocator>
+deque<T, Allocator>::deque(std::initializer_list<value_type> const& items)
+    : deque(items.begin(), items.end()) {}
+
+template <typename T, typename Allocator>
+template <typename InputIt, typename>
+deque<T, Allocator>::deque(InputIt first, InputIt last) : deque() {
+  for (; first != last; ++first) emplace_back(*first);
+}
+
+template <typename T, typename Allocator>
+deque<T, Allocator>::deque(const deque& other)
+    : deque(block_traits::select_on_container_copy_construction(
+          other.alloc_)) {
+  for (const_reference value : other) emplace_back(value);
+}
+
+template <typename T, typename Allocator>
+deque<T, Allocator>::deque(deque&& other) noexcept
+    : map_(other.map_),
+      map_size_(other.map_size_),
+      start_(other.start_),
+      size_(other.size_),
+      spare_(other.spare_),
+      alloc_(std::move(other.alloc_)) {
+  other.map_ = nullptr;
+  other.map_size_ = 0;
+  other.start_ = 0;
+  other.size_ = 0;
+  other.spare_ = nullptr;
+}
+
+template <typename T, typename Allocator>
+deque<T, Allocator>& deque<T, Allocator>::operator=(const deque& other) {
+  constexpr bool propagate =
+      block_traits::propagate_on_container_copy_assignment::value;
+  if (this != &other) {
+    deque tmp(propagate ? other.alloc_ : alloc_);
+    for (const_reference value : other) tmp.emplace_back(value);
+    /* tmp frees the old blocks with the allocator that made them */
+    swapStorage(tmp);
+    if (propagate) std::swap(alloc_, tmp.alloc_);
+  }
+  return *this;
+}
+
+template <typename T, typename Allocator>
+deque<T, Allocator>& deque<T, Allocator>::operator=(deque&& other) noexcept(
+    block_traits::propagate_on_container_move_assignment::value ||
+    block_traits::is_always_equal::value) {
+  constexpr bool propagate =
+      block_traits::propagate_on_container_move_assignment::value;
+  if (this == &other) return *this;
+
+  if (!propagate && alloc_ != other.alloc_) {
+    /* blocks cannot change owners, move the elements into our own */
+    deque tmp(alloc_);
+    for (reference value : other) tmp.emplace_back(std::move(value));
+    other.clear();
+    swapStorage(tmp);
+    return *this;
+  }
+  deque tmp(std::move(other));
+  swapStorage(tmp);
+  if (propagate) std::swap(alloc_, tmp.alloc_);
+  return *this;
+}
+
+template <typename T, typename Allocator>
+deque<T, Allocator>::~deque() {
+  clear();
+  freeBlock(spare_);
+  freeMap();
+}
+
+template <typename T, typename Allocator>
+typename deque<T, Allocator>::allocator_type
+deque<T, Allocator>::get_allocator() const {
+  return allocator_type(alloc_);
+}
+
+template <typename T, typename Allocator>
+typename deque<T, Allocator>::reference deque<T, Allocator>::at(
+    size_type pos) {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return *slot(pos);
+}
+
+template <typename T, typename Allocator>
+typename deque<T, Allocator>::const_reference deque<T, Allocator>::at(
+    size_type pos) const {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return *slot(pos);
+}
+
+template <typename T, typename Allocator>
+typename deque<T, Allocator>::size_type deque<T, Allocator>::max_size()
+    const {
+  return std::min<size_type>(block_traits::max_size(alloc_),
+                             std::numeric_limits<difference_type>::max());
+}
+
+template <typename T, typename Allocator>
+void deque<T, Allocator>::shrink_to_fit() {
+  freeBlock(spare_);
+  spare_ = nullptr;
+  if (!size_) {
+    freeMap();
+    start_ = 0;
+    return;
+  }
+  size_type first = start_ / kBlockSize;
+  size_type used = (start_ + size_ - 1) / kBlockSize - first + 1;
+  size_type new_size = std::max(kMinMapSize, used);
+  if (new_size >= map_size_) return;
+
+  map_allocator map_alloc(alloc_);
+  T** new_map = map_traits::allocate(map_alloc, new_size);
+  size_type new_first = (new_size - used) / 2;
+  std::fill(new_map, new_map + new_size, nullptr);
+  std::copy(map_ + first, map_ + first + used, new_map + new_first);
+  freeMap();
+  map_ = new_map;
+  map_size_ = new_size;
+  start_ = new_first * kBlockSize + start_ % kBlockSize;
+}
+
+template <typename T, typename Allocator>
+void deque<T, Allocator>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, typename Allocator>
+void deque<T, Allocator>::push_back(value_type&& value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T, typename Allocator>
+void deque<T, Allocator>::push_front(const_reference value) {
+  emplace_front(value);
+}
+
+template <typename T, typename Allocator>
+void deque<T, Allocator>::push_front(value_type&& value) {
+  emplace_front(std::move(value));
+}
+
+template <typename T, typename Allocator>
+template <class... Args>
+typename deque<T, Allocator>::reference deque<T, Allocator>::emplace_back(
+    Args&&... args) {
+  /* elements never move, so args may refer into the deque */
+  if (start_ + size_ == map_size_ * kBlockSize) growMap(false);
+  size_type pos = start_ + size_;
+  size_type block = pos / kBlockSize;
+  bool fresh = !map_[block];
+  if (fresh) map_[block] = allocateBlock();
+  try {
+    block_traits::construct(alloc_, map_[block] + pos % kBlockSize,
+                            std::forward<Args>(args)...);
+  } catch (...) {
+    if (fresh) releaseBlock(block);
+    throw;
+  }
+  ++size_;
+  return map_[block][pos % kBlockSize];
+}
+
+template <typename T, typename Allocator>
+template <class... Args>
+typename deque<T, Allocator>::reference deque<T, Allocator>::emplace_front(
+    Args&&... args) {
+  if (start_ == 0) growMap(true);
+  size_type pos = start_ - 1;
+  size_type block = pos / kBlockSize;
+  bool fresh = !map_[block];
+  if (fresh) map_[block] = allocateBlock();
+  try {
+    block_traits::construct(alloc_, map_[block] + pos % kBlockSize,
+                            std::forward<Args>(args)...);
+  } catch (...) {
+    if (fresh) releaseBlock(block);
+    throw;
+  }
+  start_ = pos;
+  ++size_;
+  return map_[block][pos % kBlockSize];
+}
+
+template <typename T, typename Allocator>
+void deque<T, Allocator>::pop_back() {
+  if (!size_) return;
+  size_type pos = start_ + --size_;
+  block_traits::destroy(alloc_, map_[pos / kBlockSize] + pos % kBlockSize);
+  if (pos % kBlockSize == 0 || !size_) releaseBlock(pos / kBlockSize);
+  /* an empty deque starts again from the middle of the map */
+  if (!size_) start_ = map_size_ / 2 * kBlockSize;
+}
+
+template <typename T, typename Allocator>
+void deque<T, Allocator>::pop_front() {
+  if (!size_) return;
+  size_type pos = start_++;
+  --size_;
+  block_traits::destroy(alloc_, map_[pos / kBlockSize] + pos % kBlockSize);
+  if (start_ % kBlockSize == 0 || !size_) releaseBlock(pos / kBlockSize);
+  if (!size_) start_ = map_size_ / 2 * kBlockSize;
+}
+
+template <typename T, typename Allocator>
+void deque<T, Allocator>::clear() {
+  while (size_) pop_back();
+}
+
+template <typename T, typename Allocator>
+void deque<T, Allocator>::swap(deque& other) noexcept {
+  swapStorage(other);
+  if (block_traits::propagate_on_container_swap::value) {
+    std::swap(alloc_, other.alloc_);
+  }
+}
+
+template <typename T, typename Allocator>
+template <class... Args>
+void deque<T, Allocator>::insert_many_back(Args&&... args) {
+  (emplace_back(std::forward<Args>(args)), ...);
+}
+
+template <typename T, typename Allocator>
+template <class... Args>
+void deque<T, Allocator>::insert_many_front(Args&&... args) {
+  (emplace_front(std::forward<Args>(args)), ...);
+}
+
+/* BLOCKS */
+template <typename T, typename Allocator>
+T* deque<T, Allocator>::allocateBlock() {
+  if (!spare_) return block_traits::allocate(alloc_, kBlockSize);
+  T* block = spare_;
+  spare_ = nullptr;
+  return block;
+}
+
+template <typename T, typename Allocator>
+void deque<T, Allocator>::releaseBlock(size_type block) {
+  T* freed = map_[block];
+  map_[block] = nullptr;
+  if (spare_) {
+    freeBlock(freed);
+  } else {
+    spare_ = freed;
+  }
+}
+
+template <typename T, typename Allocator>
+void deque<T, Allocator>::freeBlock(T* block) {
+  if (block) block_traits::deallocate(alloc_, block, kBlockSize);
+}
+
+template <typename T, typename Allocator>
+void deque<T, Allocator>::growMap(bool at_front) {
+  size_type first = start_ / kBlockSize;
+  size_type used = size_ ? (start_ + size_ - 1) / kBlockSize - first + 1 : 0;
+  size_type needed = used + 1;
+  size_type new_first = 0;
+
+  if (map_size_ >= 2 * needed) {
+    new_first = (map_size_ - needed) / 2 + (at_front ? 1 : 0);
+    std::memmove(map_ + new_first, map_ + first, used * sizeof(T*));
+    std::fill(map_, map_ + new_first, nullptr);
+    std::fill(map_ + new_first + used, map_ + map_size_, nullptr);
+  } else {
+    size_type new_size = std::max(kMinMapSize, 2 * std::max(map_size_, used));
+    map_allocator map_alloc(alloc_);
+    T** new_map = map_traits::allocate(map_alloc, new_size);
+    new_first = (new_size - needed) / 2 + (at_front ? 1 : 0);
+    std::fill(new_map, new_map + new_size, nullptr);
+    if (used) std::copy(map_ + first, map_ + first + used, new_map + new_first);
+    freeMap();
+    map_ = new_map;
+    map_size_ = new_size;
+  }
+  start_ = new_first * kBlockSize + start_ % kBlockSize;
+}
+
+template <typename T, typename Allocator>
+void deque<T, Allocator>::swapStorage(deque& other) noexcept {
+  std::swap(map_, other.map_);
+  std::swap(map_size_, other.map_size_);
+  std::swap(start_, other.start_);
+  std::swap(size_, other.size_);
+  std::swap(spare_, other.spare_);
+}
+
+template <typename T, typename Allocator>
+void deque<T, Allocator>::freeMap() {
+  if (!map_) return;
+  map_allocator map_alloc(alloc_);
+  map_traits::deallocate(map_alloc, map_, map_size_);
+  map_ = nullptr;
+  map_size_ = 0;
+}
+
+}  // namespace s21
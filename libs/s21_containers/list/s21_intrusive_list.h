@@ -0,0 +1,145 @@
+#ifndef S21_INTRUSIVE_LIST_H
+#define S21_INTRUSIVE_LIST_H
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+
+/* Links embedded in an element of an intrusive_list. Copying an element
+ * does not copy its membership, the copy starts unlinked. */
+class list_hook {
+ public:
+  list_hook() noexcept : prev_(nullptr), next_(nullptr) {}
+  list_hook(const list_hook&) noexcept : list_hook() {}
+  list_hook& operator=(const list_hook&) noexcept { return *this; }
+
+  bool is_linked() const noexcept { return next_ != nullptr; }
+
+ private:
+  template <class T, list_hook T::*Hook>
+  friend class intrusive_list;
+
+  list_hook* prev_;
+  list_hook* next_;
+};
+
+/* Doubly linked list of elements that embed a list_hook:
+ *
+ *   struct Connection { s21::list_hook hook; ... };
+ *   s21::intrusive_list<Connection, &Connection::hook> idle, active;
+ *   active.splice(active.end(), idle, idle.iterator_to(connection));
+ *
+ * The list links the caller's objects and never allocates, copies or
+ * destroys them. An element sits in at most one list per hook and must
+ * be erased before it is destroyed; the list unlinks what is left when
+ * it is cleared or destroyed. Everything but clear, merge and splicing a
+ * range out of another list is O(1), and iterators stay valid until
+ * their element is erased, splicing included. */
+template <class T, list_hook T::*Hook>
+class intrusive_list {
+ public:
+  class IntrusiveIterator;
+  class IntrusiveConstIterator;
+
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = IntrusiveIterator;
+  using const_iterator = IntrusiveConstIterator;
+  using size_type = std::size_t;
+
+  intrusive_list() noexcept;
+  intrusive_list(const intrusive_list&) = delete;
+  intrusive_list(intrusive_list&& other) noexcept;
+  intrusive_list& operator=(const intrusive_list&) = delete;
+  intrusive_list& operator=(intrusive_list&& other) noexcept;
+  ~intrusive_list();
+
+  bool empty() const;
+  size_type size() const;
+
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+
+  /* Throw std::invalid_argument if value is already linked */
+  void push_front(reference value);
+  void push_back(reference value);
+  iterator insert(const_iterator pos, reference value);
+  void pop_front();
+  void pop_back();
+  /* Unlink the element at pos, return the one after it */
+  iterator erase(const_iterator pos);
+  void clear();
+  void swap(intrusive_list& other);
+
+  /* Iterator to an element of this list, O(1) */
+  iterator iterator_to(reference value);
+  const_iterator iterator_to(const_reference value) const;
+
+  /* Move elements of other before pos: all of them, the one at it, or
+   * [first, last). other may be this list for the last two. */
+  void splice(const_iterator pos, intrusive_list& other);
+  void splice(const_iterator pos, intrusive_list& other, const_iterator it);
+  void splice(const_iterator pos, intrusive_list& other,
+              const_iterator first, const_iterator last);
+  /* Merge sorted other into this sorted list; stable, other ends empty.
+   * If comp throws, every element is still in one of the two lists. */
+  void merge(intrusive_list& other);
+  template <class Compare>
+  void merge(intrusive_list& other, Compare comp);
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  class IntrusiveIterator {
+   public:
+    IntrusiveIterator(list_hook* hook) : current(hook) {}
+    T& operator*() const;
+    T* operator->() const;
+    iterator& operator++();
+    iterator operator++(int);
+    iterator& operator--();
+    iterator operator--(int);
+    bool operator==(const iterator& other) const;
+    bool operator!=(const iterator& other) const;
+
+   protected:
+    friend class intrusive_list;
+    list_hook* current;
+  };
+
+  class IntrusiveConstIterator : public IntrusiveIterator {
+   public:
+    IntrusiveConstIterator(list_hook* hook) : iterator(hook) {}
+    IntrusiveConstIterator(const IntrusiveIterator& other)
+        : IntrusiveIterator(other) {}
+    const_reference operator*() const { return iterator::operator*(); }
+    const T* operator->() const { return iterator::operator->(); }
+  };
+
+ private:
+  list_hook root_; /* sentinel: next_ is the front, prev_ the back */
+  size_type size_;
+
+  static list_hook* hookOf(const_reference value);
+  static T* valueOf(list_hook* hook);
+  static void linkBefore(list_hook* pos, list_hook* hook);
+  static void unlink(list_hook* hook);
+  /* Move [first, last) before pos, which must lie outside the range */
+  static void transfer(list_hook* pos, list_hook* first, list_hook* last);
+  /* Take other's elements, this list must be empty */
+  void adopt(intrusive_list& other) noexcept;
+  static void checkUnlinked(const_reference value);
+};
+
+}  // namespace s21
+
+#include "s21_intrusive_list.tpp"
+#endif
@@ -0,0 +1,339 @@
+#include "s21_intrusive_list.h"
+
+namespace s21 {
+template <class T, list_hook T::*Hook>
+intrusive_list<T, Hook>::intrusive_list() noexcept : size_(0) {
+  root_.prev_ = root_.next_ = &root_;
+}
+
+template <class T, list_hook T::*Hook>
+intrusive_list<T, Hook>::intrusive_list(intrusive_list&& other) noexcept
+    : intrusive_list() {
+  adopt(other);
+}
+
+template <class T, list_hook T::*Hook>
+intrusive_list<T, Hook>& intrusive_list<T, Hook>::operator=(
+    intrusive_list&& other) noexcept {
+  if (this != &other) {
+    clear();
+    adopt(other);
+  }
+  return *this;
+}
+
+template <class T, list_hook T::*Hook>
+intrusive_list<T, Hook>::~intrusive_list() {
+  clear();
+}
+
+template <class T, list_hook T::*Hook>
+bool intrusive_list<T, Hook>::empty() const {
+  return size_ == 0;
+}
+
+template <class T, list_hook T::*Hook>
+typename intrusive_list<T, Hook>::size_type intrusive_list<T, Hook>::size()
+    const {
+  return size_;
+}
+
+template <class T, list_hook T::*Hook>
+T& intrusive_list<T, Hook>::front() {
+  return *valueOf(root_.next_);
+}
+
+template <class T, list_hook T::*Hook>
+const T& intrusive_list<T, Hook>::front() const {
+  return *valueOf(root_.next_);
+}
+
+template <class T, list_hook T::*Hook>
+T& intrusive_list<T, Hook>::back() {
+  return *valueOf(root_.prev_);
+}
+
+template <class T, list_hook T::*Hook>
+const T& intrusive_list<T, Hook>::back() const {
+  return *valueOf(root_.prev_);
+}
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::push_front(reference value) {
+  insert(begin(), value);
+}
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::push_back(reference value) {
+  insert(end(), value);
+}
+
+template <class T, list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::insert(
+    const_iterator pos, reference value) {
+  checkUnlinked(value);
+  list_hook* hook = hookOf(value);
+  linkBefore(pos.current, hook);
+  ++size_;
+  return iterator(hook);
+}
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::pop_front() {
+  if (size_) erase(begin());
+}
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::pop_back() {
+  if (size_) erase(root_.prev_);
+}
+
+template <class T, list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::erase(
+    const_iterator pos) {
+  list_hook* next = pos.current->next_;
+  unlink(pos.current);
+  --size_;
+  return iterator(next);
+}
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::clear() {
+  for (list_hook* hook = root_.next_; hook != &root_;) {
+    list_hook* next = hook->next_;
+    hook->prev_ = hook->next_ = nullptr;
+    hook = next;
+  }
+  root_.prev_ = root_.next_ = &root_;
+  size_ = 0;
+}
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::swap(intrusive_list& other) {
+  intrusive_list tmp(std::move(other));
+  other.adopt(*this);
+  adopt(tmp);
+}
+
+template <class T, list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator
+intrusive_list<T, Hook>::iterator_to(reference value) {
+  return iterator(hookOf(value));
+}
+
+template <class T, list_hook T::*Hook>
+typename intrusive_list<T, Hook>::const_iterator
+intrusive_list<T, Hook>::iterator_to(const_reference value) const {
+  return const_iterator(hookOf(value));
+}
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos,
+                                     intrusive_list& other) {
+  if (this == &other || other.empty()) return;
+  transfer(pos.current, other.root_.next_, &other.root_);
+  size_ += other.size_;
+  other.size_ = 0;
+}
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos,
+                                     intrusive_list& other,
+                                     const_iterator it) {
+  if (pos == it) return;
+  transfer(pos.current, it.current, it.current->next_);
+  --other.size_;
+  ++size_;
+}
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos,
+                                     intrusive_list& other,
+                                     const_iterator first,
+                                     const_iterator last) {
+  if (first == last) return;
+  if (this != &other) {
+    size_type count = 0;
+    for (list_hook* hook = first.current; hook != last.current;
+         hook = hook->next_) {
+      ++count;
+    }
+    other.size_ -= count;
+    size_ += count;
+  }
+  transfer(pos.current, first.current, last.current);
+}
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::merge(intrusive_list& other) {
+  merge(other, std::less<T>());
+}
+
+template <class T, list_hook T::*Hook>
+template <class Compare>
+void intrusive_list<T, Hook>::merge(intrusive_list& other, Compare comp) {
+  if (this == &other) return;
+  list_hook* pos = root_.next_;
+  list_hook* first = other.root_.next_;
+  while (first != &other.root_ && pos != &root_) {
+    if (!comp(*valueOf(first), *valueOf(pos))) {
+      pos = pos->next_;
+      continue;
+    }
+    /* move the whole run of other that goes before pos in one step;
+     * ties stay behind pos, which keeps the merge stable */
+    list_hook* last = first->next_;
+    size_type count = 1;
+    while (last != &other.root_ && comp(*valueOf(last), *valueOf(pos))) {
+      last = last->next_;
+      ++count;
+    }
+    transfer(pos, first, last);
+    other.size_ -= count;
+    size_ += count;
+    first = last;
+  }
+  splice(end(), other);
+}
+
+template <class T, list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::begin() {
+  return iterator(root_.next_);
+}
+
+template <class T, list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::end() {
+  return iterator(&root_);
+}
+
+template <class T, list_hook T::*Hook>
+typename intrusive_list<T, Hook>::const_iterator
+intrusive_list<T, Hook>::begin() const {
+  return const_iterator(root_.next_);
+}
+
+template <class T, list_hook T::*Hook>
+typename intrusive_list<T, Hook>::const_iterator
+intrusive_list<T, Hook>::end() const {
+  return const_iterator(const_cast<list_hook*>(&root_));
+}
+
+/* ITERATOR */
+template <class T, list_hook T::*Hook>
+T& intrusive_list<T, Hook>::IntrusiveIterator::operator*() const {
+  return *valueOf(current);
+}
+
+template <class T, list_hook T::*Hook>
+T* intrusive_list<T, Hook>::IntrusiveIterator::operator->() const {
+  return valueOf(current);
+}
+
+template <class T, list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator&
+intrusive_list<T, Hook>::IntrusiveIterator::operator++() {
+  current = current->next_;
+  return *this;
+}
+
+template <class T, list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator
+intrusive_list<T, Hook>::IntrusiveIterator::operator++(int) {
+  iterator tmp = *this;
+  ++(*this);
+  return tmp;
+}
+
+template <class T, list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator&
+intrusive_list<T, Hook>::IntrusiveIterator::operator--() {
+  current = current->prev_;
+  return *this;
+}
+
+template <class T, list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator
+intrusive_list<T, Hook>::IntrusiveIterator::operator--(int) {
+  iterator tmp = *this;
+  --(*this);
+  return tmp;
+}
+
+template <class T, list_hook T::*Hook>
+bool intrusive_list<T, Hook>::IntrusiveIterator::operator==(
+    const iterator& other) const {
+  return current == other.current;
+}
+
+template <class T, list_hook T::*Hook>
+bool intrusive_list<T, Hook>::IntrusiveIterator::operator!=(
+    const iterator& other) const {
+  return current != other.current;
+}
+
+/* LINKS */
+template <class T, list_hook T::*Hook>
+list_hook* intrusive_list<T, Hook>::hookOf(const_reference value) {
+  return &(const_cast<T&>(value).*Hook);
+}
+
+template <class T, list_hook T::*Hook>
+T* intrusive_list<T, Hook>::valueOf(list_hook* hook) {
+  /* offset of the hook inside T, measured on raw storage so that no T
+   * is needed; it folds to a constant */
+  alignas(T) unsigned char probe[sizeof(T)];
+  const T* base = reinterpret_cast<const T*>(probe);
+  std::ptrdiff_t offset =
+      reinterpret_cast<const unsigned char*>(&(base->*Hook)) - probe;
+  return reinterpret_cast<T*>(reinterpret_cast<unsigned char*>(hook) -
+                              offset);
+}
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::linkBefore(list_hook* pos, list_hook* hook) {
+  hook->next_ = pos;
+  hook->prev_ = pos->prev_;
+  pos->prev_->next_ = hook;
+  pos->prev_ = hook;
+}
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::unlink(list_hook* hook) {
+  hook->prev_->next_ = hook->next_;
+  hook->next_->prev_ = hook->prev_;
+  hook->prev_ = hook->next_ = nullptr;
+}
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::transfer(list_hook* pos, list_hook* first,
+                                       list_hook* last) {
+  if (first == last || pos == last) return;
+  list_hook* back = last->prev_;
+  first->prev_->next_ = last;
+  last->prev_ = first->prev_;
+
+  first->prev_ = pos->prev_;
+  pos->prev_->next_ = first;
+  back->next_ = pos;
+  pos->prev_ = back;
+}
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::adopt(intrusive_list& other) noexcept {
+  if (other.empty()) return;
+  root_.next_ = other.root_.next_;
+  root_.prev_ = other.root_.prev_;
+  root_.next_->prev_ = &root_;
+  root_.prev_->next_ = &root_;
+  size_ = other.size_;
+  other.root_.prev_ = other.root_.next_ = &other.root_;
+  other.size_ = 0;
+}
+
+template <class T, list_hook T::*Hook>
+void intrusive_list<T, Hook>::checkUnlinked(const_reference value) {
+  if (hookOf(value)->is_linked()) {
+    throw std::invalid_argument("intrusive_list: element is already linked");
+  }
+}
+}  // namespace s21
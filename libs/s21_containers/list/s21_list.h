@@ -1,25 +1,68 @@
 #ifndef S21_LIST_H
 #define S21_LIST_H
 
+#include <algorithm>
+#include <exception>
+#include <functional>
 #include <initializer_list>
 #include <iostream>
 #include <limits>
+#include <memory>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace s21 {
 
-template <typename T>
+template <typename T, typename Allocator = std::allocator<T>>
 class list {
  private:
   struct Node {
     T value;
     Node* prev;
     Node* next;
-    Node(T val) : value(val), prev(nullptr), next(nullptr) {}
+    template <class... Args>
+    explicit Node(Args&&... args)
+        : value(std::forward<Args>(args)...), prev(nullptr), next(nullptr) {}
   };
 
+  using node_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
   Node* head_;
   Node* tail_;
   size_t size_;
+  node_allocator alloc_;
+
+  template <class... Args>
+  Node* createNode(Args&&... args);
+  void destroyNode(Node* node);
+  void linkBefore(Node* pos, Node* node);
+
+  /* Sorting works on null-terminated chains whose head's prev points at
+   * the chain's tail, so merges keep every link right and no pass over
+   * the scattered nodes is needed at the end. If comp throws, the chains
+   * are concatenated and relink() repairs the list. */
+  static constexpr std::size_t kParallelSortThreshold = 1 << 15;
+  static constexpr std::size_t kMinSortRun = 16;
+
+  /* Detach the natural run at the front of rest, at least kMinSortRun
+   * long unless rest runs out */
+  template <class Compare>
+  static Node* takeRun(Node*& rest, Compare& comp);
+  /* Stable merge of chains a and b into out; if comp throws, out still
+   * holds every node */
+  template <class Compare>
+  static void mergeChains(Node*& out, Node* a, Node* b, Compare& comp);
+  /* On a throw head still holds every node, in unspecified order */
+  template <class Compare>
+  static void sortChain(Node*& head, Compare& comp);
+  static Node* concatChains(Node* const* chains, std::size_t count);
+  /* Make the list the chain at head */
+  void adoptChain(Node* head);
+  void relink(Node* head);
 
  public:
   class ListIterator;
@@ -31,17 +74,21 @@ class list {
   using iterator = ListIterator;
   using const_iterator = ListConstIterator;
   using size_type = std::size_t;
+  using allocator_type = Allocator;
 
   list();
+  explicit list(const allocator_type& alloc);
   list(size_type n);
   list(const list& other);
   list(list&& other) noexcept;
   list(std::initializer_list<T> const& init);
-  list<T>& operator=(const list& other);
-  list<T>& operator=(list&& other);
+  list& operator=(const list& other);
+  list& operator=(list&& other);
 
   ~list();
 
+  allocator_type get_allocator() const;
+
   bool empty() const;
   size_t size() const;
   size_t max_size() const;
@@ -52,19 +99,42 @@ class list {
   const_reference back() const;
 
   void push_front(const_reference value);
+  void push_front(value_type&& value);
   void push_back(const_reference value);
+  void push_back(value_type&& value);
+  template <class... Args>
+  reference emplace_front(Args&&... args);
+  template <class... Args>
+  reference emplace_back(Args&&... args);
   void pop_front();
   void pop_back();
   void clear();
-  void swap(list& other);
+  void swap(list& other) noexcept;
+  /* Merge sorted other into this sorted list; stable, other ends empty */
   void merge(list& other);
+  template <class Compare>
+  void merge(list& other, Compare comp);
   void splice(iterator pos, list& other);
   void reverse();
   void unique();
+  /* Stable bottom-up natural merge sort: relinks nodes, no recursion and
+   * O(1) extra memory. Strictly descending runs are reversed in place. */
   void sort();
+  template <class Compare>
+  void sort(Compare comp);
+  /* Sort slices of the list on up to `threads` threads (all hardware
+   * threads for 0), then merge them; comp is copied to every thread and
+   * must be safe to call concurrently. Short lists sort in place. */
+  void parallel_sort(unsigned threads = 0);
+  template <class Compare>
+  void parallel_sort(Compare comp, unsigned threads = 0);
+  /* Replace this list with the merge of sorted left and right */
   void merge_sorted(list& left, list& right);
 
   iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, value_type&& value);
+  template <class... Args>
+  iterator emplace(const_iterator pos, Args&&... args);
   iterator begin();
   iterator end();
   iterator erase(iterator pos);
@@ -96,7 +166,7 @@ class list {
    public:
     ListConstIterator(Node* ptr) : iterator(ptr){};
     ListConstIterator(const ListIterator& other) : ListIterator(other){};
-    const_reference operator*() const { iterator::operator*(); };
+    const_reference operator*() const { return iterator::operator*(); };
   };
 };
 }  // namespace s21
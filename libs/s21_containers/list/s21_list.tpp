@@ -1,26 +1,36 @@
 #include "s21_list.h"
 
 namespace s21 {
-template <typename T>
-list<T>::list() {
+template <typename T, typename Allocator>
+list<T, Allocator>::list() : alloc_() {
   head_ = nullptr;
   tail_ = nullptr;
   size_ = 0;
 }
 
-template <typename T>
-list<T>::list(size_type n) : list() {
+template <typename T, typename Allocator>
+list<T, Allocator>::list(const allocator_type& alloc) : alloc_(alloc) {
+  head_ = nullptr;
+  tail_ = nullptr;
+  size_ = 0;
+}
+
+template <typename T, typename Allocator>
+list<T, Allocator>::list(size_type n) : list() {
   if (n > 0) {
     for (size_type i = 0; i < n; ++i) {
-      push_front(value_type());
+      emplace_back();
     }
   }
 }
 
-template <typename T>
-list<T>& list<T>::operator=(const list& other) {
+template <typename T, typename Allocator>
+list<T, Allocator>& list<T, Allocator>::operator=(const list& other) {
   if (this != &other) {
     clear();
+    if (node_traits::propagate_on_container_copy_assignment::value) {
+      alloc_ = other.alloc_;
+    }
     Node* current = other.head_;
     while (current) {
       push_back(current->value);
@@ -30,11 +40,24 @@ list<T>& list<T>::operator=(const list& other) {
   return *this;
 }
 
-template <typename T>
-list<T>& list<T>::operator=(list&& other) {
+template <typename T, typename Allocator>
+list<T, Allocator>& list<T, Allocator>::operator=(list&& other) {
   if (this != &other) {
     clear();
 
+    if (!node_traits::propagate_on_container_move_assignment::value &&
+        alloc_ != other.alloc_) {
+      /* nodes cannot change owners, copy them into our own memory */
+      for (Node* current = other.head_; current; current = current->next) {
+        push_back(std::move(current->value));
+      }
+      other.clear();
+      return *this;
+    }
+    if (node_traits::propagate_on_container_move_assignment::value) {
+      alloc_ = other.alloc_;
+    }
+
     head_ = other.head_;
     tail_ = other.tail_;
     size_ = other.size_;
@@ -46,8 +69,9 @@ list<T>& list<T>::operator=(list&& other) {
   return *this;
 }
 
-template <typename T>
-list<T>::list(const list& other) : list() {
+template <typename T, typename Allocator>
+list<T, Allocator>::list(const list& other)
+    : list(node_traits::select_on_container_copy_construction(other.alloc_)) {
   Node* currrent = other.head_;
   while (currrent) {
     push_back(currrent->value);
@@ -55,8 +79,8 @@ list<T>::list(const list& other) : list() {
   }
 }
 
-template <typename T>
-list<T>::list(list&& other) noexcept {
+template <typename T, typename Allocator>
+list<T, Allocator>::list(list&& other) noexcept : alloc_(other.alloc_) {
   std::swap(head_, other.head_);
   std::swap(tail_, other.tail_);
   std::swap(size_, other.size_);
@@ -65,40 +89,66 @@ list<T>::list(list&& other) noexcept {
   other.size_ = 0;
 }
 
-template <typename T>
-list<T>::list(std::initializer_list<T> const& init)
-    : head_(nullptr), tail_(nullptr), size_(0) {
+template <typename T, typename Allocator>
+list<T, Allocator>::list(std::initializer_list<T> const& init)
+    : head_(nullptr), tail_(nullptr), size_(0), alloc_() {
   for (const T& value : init) {
     push_back(value);
   }
 }
 
-template <typename T>
-list<T>::~list() {
+template <typename T, typename Allocator>
+list<T, Allocator>::~list() {
   clear();
 }
 
-template <typename T>
-bool list<T>::empty() const {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::allocator_type list<T, Allocator>::get_allocator()
+    const {
+  return allocator_type(alloc_);
+}
+
+template <typename T, typename Allocator>
+template <class... Args>
+typename list<T, Allocator>::Node* list<T, Allocator>::createNode(
+    Args&&... args) {
+  Node* node = node_traits::allocate(alloc_, 1);
+  try {
+    node_traits::construct(alloc_, node, std::forward<Args>(args)...);
+  } catch (...) {
+    node_traits::deallocate(alloc_, node, 1);
+    throw;
+  }
+  return node;
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::destroyNode(Node* node) {
+  node_traits::destroy(alloc_, node);
+  node_traits::deallocate(alloc_, node, 1);
+}
+
+template <typename T, typename Allocator>
+bool list<T, Allocator>::empty() const {
   return size_ == 0;
 }
 
-template <typename T>
-size_t list<T>::size() const {
+template <typename T, typename Allocator>
+size_t list<T, Allocator>::size() const {
   return size_;
 }
 
-template <typename T>
-size_t list<T>::max_size() const {
+template <typename T, typename Allocator>
+size_t list<T, Allocator>::max_size() const {
   return std::numeric_limits<size_t>::max() / sizeof(T);
 }
 
-template <typename T>
-void list<T>::clear() {
+template <typename T, typename Allocator>
+void list<T, Allocator>::clear() {
   Node* current = head_;
   while (current != nullptr) {
     Node* next = current->next;
-    delete current;
+    destroyNode(current);
     current = next;
   }
   head_ = nullptr;
@@ -106,78 +156,108 @@ void list<T>::clear() {
   size_ = 0;
 }
 
-template <typename T>
-T& list<T>::front() {
+template <typename T, typename Allocator>
+T& list<T, Allocator>::front() {
   return head_->value;
 }
 
-template <typename T>
-const T& list<T>::front() const {
+template <typename T, typename Allocator>
+const T& list<T, Allocator>::front() const {
   return head_->value;
 }
 
-template <typename T>
-T& list<T>::back() {
+template <typename T, typename Allocator>
+T& list<T, Allocator>::back() {
   return tail_->value;
 }
 
-template <typename T>
-const T& list<T>::back() const {
+template <typename T, typename Allocator>
+const T& list<T, Allocator>::back() const {
   return tail_->value;
 }
 
-template <typename T>
-void list<T>::push_front(const_reference value) {
-  Node* new_node = new Node(value);
-  new_node->next = head_;
-  if (head_) {
-    head_->prev = new_node;
+template <typename T, typename Allocator>
+void list<T, Allocator>::linkBefore(Node* pos, Node* node) {
+  /* pos == nullptr means end(): the node becomes the new tail */
+  Node* before = pos ? pos->prev : tail_;
+  node->prev = before;
+  node->next = pos;
+
+  if (before) {
+    before->next = node;
+  } else {
+    head_ = node;
   }
-  head_ = new_node;
-  if (!tail_) {
-    tail_ = new_node;
+
+  if (pos) {
+    pos->prev = node;
+  } else {
+    tail_ = node;
   }
-  size_++;
+  ++size_;
 }
 
-template <typename T>
-typename list<T>::iterator list<T>::insert(iterator pos,
-                                           const_reference value) {
-  Node* new_node = new Node(value);
-  new_node->prev = pos.getNode()->prev;
-  new_node->next = pos.getNode();
+template <typename T, typename Allocator>
+void list<T, Allocator>::push_front(const_reference value) {
+  emplace_front(value);
+}
 
-  if (pos.getNode()->prev != nullptr) {
-    pos.getNode()->prev->next = new_node;
-  } else {
-    head_ = new_node;
-  }
+template <typename T, typename Allocator>
+void list<T, Allocator>::push_front(value_type&& value) {
+  emplace_front(std::move(value));
+}
 
-  pos.getNode()->prev = new_node;
-  ++size_;
-  return iterator(new_node);
+template <typename T, typename Allocator>
+void list<T, Allocator>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::push_back(value_type&& value) {
+  emplace_back(std::move(value));
 }
 
-template <typename T>
-void list<T>::push_back(const_reference value) {
-  Node* new_node = new Node(value);
-  new_node->prev = tail_;
-  new_node->next = nullptr;
+template <typename T, typename Allocator>
+template <class... Args>
+typename list<T, Allocator>::reference list<T, Allocator>::emplace_front(
+    Args&&... args) {
+  Node* new_node = createNode(std::forward<Args>(args)...);
+  linkBefore(head_, new_node);
+  return new_node->value;
+}
 
-  if (tail_) {
-    tail_->next = new_node;
-  }
+template <typename T, typename Allocator>
+template <class... Args>
+typename list<T, Allocator>::reference list<T, Allocator>::emplace_back(
+    Args&&... args) {
+  Node* new_node = createNode(std::forward<Args>(args)...);
+  linkBefore(nullptr, new_node);
+  return new_node->value;
+}
+
+template <typename T, typename Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::insert(
+    iterator pos, const_reference value) {
+  return emplace(pos, value);
+}
 
-  tail_ = new_node;
+template <typename T, typename Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::insert(
+    iterator pos, value_type&& value) {
+  return emplace(pos, std::move(value));
+}
 
-  if (!head_) {
-    head_ = new_node;
-  }
-  ++size_;
+template <typename T, typename Allocator>
+template <class... Args>
+typename list<T, Allocator>::iterator list<T, Allocator>::emplace(
+    const_iterator pos, Args&&... args) {
+  Node* new_node = createNode(std::forward<Args>(args)...);
+  linkBefore(pos.getNode(), new_node);
+  return iterator(new_node);
 }
 
-template <typename T>
-void list<T>::pop_front() {
+template <typename T, typename Allocator>
+void list<T, Allocator>::pop_front() {
   if (head_) {
     Node* tmp = head_;
     head_ = head_->next;
@@ -186,12 +266,12 @@ void list<T>::pop_front() {
     } else {
       tail_ = nullptr;
     }
-    delete tmp;
+    destroyNode(tmp);
     --size_;
   }
 }
-template <typename T>
-void list<T>::pop_back() {
+template <typename T, typename Allocator>
+void list<T, Allocator>::pop_back() {
   if (tail_) {
     Node* tmp = tail_;
     tail_ = tail_->prev;
@@ -200,69 +280,74 @@ void list<T>::pop_back() {
     } else {
       head_ = nullptr;
     }
-    delete tmp;
+    destroyNode(tmp);
     --size_;
   }
 }
 
-template <typename T>
-T& list<T>::ListIterator::operator*() const {
+template <typename T, typename Allocator>
+T& list<T, Allocator>::ListIterator::operator*() const {
   return current->value;
 }
 
-template <typename T>
-typename list<T>::iterator& list<T>::ListIterator::operator++() {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::iterator&
+list<T, Allocator>::ListIterator::operator++() {
   current = current->next;
   return *this;
 }
 
-template <typename T>
-typename list<T>::iterator list<T>::ListIterator::operator++(int) {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::iterator
+list<T, Allocator>::ListIterator::operator++(int) {
   iterator tmp = *this;
   ++(*this);
   return tmp;
 }
 
-template <typename T>
-typename list<T>::iterator& list<T>::ListIterator::operator--() {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::iterator&
+list<T, Allocator>::ListIterator::operator--() {
   current = current->prev;
   return *this;
 }
 
-template <typename T>
-typename list<T>::iterator list<T>::ListIterator::operator--(int) {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::iterator
+list<T, Allocator>::ListIterator::operator--(int) {
   iterator tmp = *this;
   --(*this);
   return tmp;
 }
 
-template <typename T>
-bool list<T>::ListIterator::operator==(const iterator& other) const {
+template <typename T, typename Allocator>
+bool list<T, Allocator>::ListIterator::operator==(const iterator& other) const {
   return current == other.current;
 }
 
-template <typename T>
-bool list<T>::ListIterator::operator!=(const iterator& other) const {
+template <typename T, typename Allocator>
+bool list<T, Allocator>::ListIterator::operator!=(const iterator& other) const {
   return current != other.current;
 }
 
-template <typename T>
-typename list<T>::Node* list<T>::ListIterator::getNode() {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::Node*
+list<T, Allocator>::ListIterator::getNode() {
   return current;
 }
 
-template <typename T>
-typename list<T>::iterator list<T>::begin() {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::begin() {
   return iterator(head_);
 }
 
-template <typename T>
-typename list<T>::iterator list<T>::end() {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::end() {
   return iterator(nullptr);
 }
 
-template <typename T>
-typename list<T>::iterator list<T>::erase(iterator pos) {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::erase(iterator pos) {
   if (*pos == tail_->value) {
     return iterator(tail_);
   }
@@ -282,25 +367,62 @@ typename list<T>::iterator list<T>::erase(iterator pos) {
     head_ = nodeToRemove->prev;
   }
 
-  delete nodeToRemove;
+  destroyNode(nodeToRemove);
 
   --size_;
 
   return nextIter;
 }
 
-template <typename T>
-void list<T>::swap(list& other) {
-  std::swap(*this, other);
+template <typename T, typename Allocator>
+void list<T, Allocator>::swap(list& other) noexcept {
+  std::swap(head_, other.head_);
+  std::swap(tail_, other.tail_);
+  std::swap(size_, other.size_);
+  if (node_traits::propagate_on_container_swap::value) {
+    std::swap(alloc_, other.alloc_);
+  }
 }
 
-template <typename T>
-void list<T>::merge(list& other) {
-  merge_sorted(*this, other);
+template <typename T, typename Allocator>
+void list<T, Allocator>::merge(list& other) {
+  merge(other, std::less<T>());
 }
 
-template <typename T>
-void list<T>::reverse() {
+template <typename T, typename Allocator>
+template <class Compare>
+void list<T, Allocator>::merge(list& other, Compare comp) {
+  if (this == &other || other.empty()) return;
+  if (alloc_ != other.alloc_) {
+    /* nodes cannot change owners, copy them into our own memory */
+    list tmp(get_allocator());
+    for (Node* current = other.head_; current; current = current->next) {
+      tmp.push_back(std::move(current->value));
+    }
+    other.clear();
+    merge(tmp, comp);
+    return;
+  }
+
+  Node* left = head_;
+  Node* right = other.head_;
+  if (left) left->prev = tail_;
+  right->prev = other.tail_;
+  size_ += other.size_;
+  other.head_ = other.tail_ = nullptr;
+  other.size_ = 0;
+  Node* head = nullptr;
+  try {
+    mergeChains(head, left, right, comp);
+  } catch (...) {
+    relink(head);
+    throw;
+  }
+  adoptChain(head);
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::reverse() {
   if (size_ > 1) {
     Node* current = head_;
     Node* prevNode = nullptr;
@@ -316,59 +438,17 @@ void list<T>::reverse() {
     std::swap(head_, tail_);
   }
 }
-template <typename T>
-void list<T>::merge_sorted(list& left, list& right) {
-  Node* left_node = left.head_;
-  Node* right_node = right.head_;
-  Node* node = nullptr;
-
-  Node* thisHead = nullptr;
-  Node* thistail = nullptr;
-  size_t thisSize = 0;
-
-  while (left_node != nullptr || right_node != nullptr) {
-    Node* next_node;
-    bool choose_left =
-        right_node == nullptr ||
-        (left_node != nullptr && left_node->value <= right_node->value);
-
-    if (choose_left) {
-      next_node = left_node;
-      left_node = left_node->next;
-    } else {
-      next_node = right_node;
-      right_node = right_node->next;
-    }
-
-    if (node != nullptr) {
-      node->next = next_node;
-      next_node->prev = node;
-    } else {
-      thisHead = next_node;
-      next_node->prev = nullptr;
-    }
-
-    node = next_node;
-  }
-
-  thistail = node;
-  thisSize = left.size_ + right.size_;
-
-  left.head_ = nullptr;
-  left.tail_ = nullptr;
-  left.size_ = 0;
-
-  right.head_ = nullptr;
-  right.tail_ = nullptr;
-  right.size_ = 0;
-
-  head_ = thisHead;
-  tail_ = thistail;
-  size_ = thisSize;
+template <typename T, typename Allocator>
+void list<T, Allocator>::merge_sorted(list& left, list& right) {
+  if (&left == &right) return;
+  list result(get_allocator());
+  result.swap(left);
+  result.merge(right);
+  swap(result);
 }
 
-template <typename T>
-void list<T>::unique() {
+template <typename T, typename Allocator>
+void list<T, Allocator>::unique() {
   if (size_ <= 1) {
     return;
   }
@@ -386,7 +466,7 @@ void list<T>::unique() {
       } else {
         prevNode->next = nextNode;
       }
-      delete current;
+      destroyNode(current);
       current = nextNode;
     } else {
       prevNode = current;
@@ -396,12 +476,22 @@ void list<T>::unique() {
   tail_ = prevNode;
 }
 
-template <typename T>
-void list<T>::splice(iterator pos, list& other) {
+template <typename T, typename Allocator>
+void list<T, Allocator>::splice(iterator pos, list& other) {
   if (other.empty()) {
     return;
   }
 
+  if (alloc_ != other.alloc_) {
+    list tmp(get_allocator());
+    for (Node* current = other.head_; current; current = current->next) {
+      tmp.push_back(std::move(current->value));
+    }
+    other.clear();
+    splice(pos, tmp);
+    return;
+  }
+
   Node* before = (pos == begin()) ? nullptr : pos.getNode()->prev;
   Node* after = (pos == end()) ? nullptr : pos.getNode();
 
@@ -425,66 +515,285 @@ void list<T>::splice(iterator pos, list& other) {
   other.tail_ = nullptr;
 }
 
-template <typename T>
-void list<T>::sort() {
-  if (size_ <= 1) {
-    return;
+template <typename T, typename Allocator>
+void list<T, Allocator>::sort() {
+  sort(std::less<T>());
+}
+
+template <typename T, typename Allocator>
+template <class Compare>
+void list<T, Allocator>::sort(Compare comp) {
+  if (size_ < 2) return;
+  Node* head = head_;
+  try {
+    sortChain(head, comp);
+  } catch (...) {
+    relink(head);
+    throw;
   }
+  adoptChain(head);
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::parallel_sort(unsigned threads) {
+  parallel_sort(std::less<T>(), threads);
+}
 
-  list<T> left_half;
-  list<T> right_half;
+template <typename T, typename Allocator>
+template <class Compare>
+void list<T, Allocator>::parallel_sort(Compare comp, unsigned threads) {
+  if (!threads) threads = std::max(1u, std::thread::hardware_concurrency());
+  size_type slices = std::min<size_type>(threads, size_ / 2);
+  if (size_ < kParallelSortThreshold || slices < 2) {
+    sort(comp);
+    return;
+  }
 
-  Node* middle = head_;
+  /* cut the list into contiguous slices of about equal length */
+  std::vector<Node*> chains(slices);
   Node* current = head_;
+  for (size_type i = 0; i < slices; ++i) {
+    chains[i] = current;
+    size_type length = size_ / slices + (i < size_ % slices ? 1 : 0);
+    for (size_type k = 1; k < length; ++k) current = current->next;
+    Node* next = current->next;
+    current->next = nullptr;
+    current = next;
+  }
 
-  while (current != nullptr && current->next != nullptr) {
-    current = current->next->next;
-    if (current != nullptr) {
-      middle = middle->next;
+  std::vector<std::exception_ptr> errors(slices);
+  auto sortSlice = [&](size_type i) {
+    try {
+      Compare local(comp);
+      sortChain(chains[i], local);
+    } catch (...) {
+      errors[i] = std::current_exception();
+    }
+  };
+  std::vector<std::thread> workers;
+  for (size_type i = 1; i < slices; ++i) {
+    try {
+      workers.emplace_back(sortSlice, i);
+    } catch (const std::system_error&) {
+      sortSlice(i); /* no thread available, sort it here */
     }
   }
+  sortSlice(0);
+  for (std::thread& worker : workers) worker.join();
 
-  right_half.head_ = middle->next;
-  right_half.tail_ = tail_;
-  right_half.size_ = size_ / 2;
+  std::exception_ptr error;
+  for (const std::exception_ptr& e : errors) {
+    if (e && !error) error = e;
+  }
+  /* merge neighbouring slices pairwise, keeping equal elements in order */
+  for (size_type width = 1; !error && width < slices; width *= 2) {
+    for (size_type i = 0; i + width < slices; i += 2 * width) {
+      Node* left = chains[i];
+      Node* right = chains[i + width];
+      chains[i + width] = nullptr;
+      try {
+        mergeChains(chains[i], left, right, comp);
+      } catch (...) {
+        error = std::current_exception();
+        break;
+      }
+    }
+  }
+  if (error) {
+    relink(concatChains(chains.data(), slices));
+    std::rethrow_exception(error);
+  }
+  adoptChain(chains[0]);
+}
+
+template <typename T, typename Allocator>
+template <class Compare>
+typename list<T, Allocator>::Node* list<T, Allocator>::takeRun(
+    Node*& rest, Compare& comp) {
+  Node* head = rest;
+  Node* last = head;
+  std::size_t length = 1;
+  if (last->next && comp(last->next->value, last->value)) {
+    /* strictly descending: reversing it keeps the sort stable */
+    while (last->next && comp(last->next->value, last->value)) {
+      last = last->next;
+      ++length;
+    }
+    rest = last->next;
+    Node* reversed = nullptr;
+    for (Node* node = head; node != rest;) {
+      Node* next = node->next;
+      node->next = reversed;
+      reversed = node;
+      node = next;
+    }
+    last = head;
+    head = reversed;
+  } else {
+    while (last->next && !comp(last->next->value, last->value)) {
+      last = last->next;
+      ++length;
+    }
+    rest = last->next;
+  }
+  last->next = nullptr;
+
+  /* extend short runs by insertion while their nodes are still in cache,
+   * random input would otherwise be merged from runs of two */
+  for (; length < kMinSortRun && rest; ++length) {
+    Node* node = rest;
+    Node** link = &last->next;
+    try {
+      if (comp(node->value, last->value)) {
+        link = &head;
+        while (!comp(node->value, (*link)->value)) link = &(*link)->next;
+      }
+    } catch (...) {
+      last->next = rest;
+      rest = head;
+      throw;
+    }
+    rest = node->next;
+    node->next = *link;
+    *link = node;
+    if (!node->next) last = node;
+  }
+  for (Node* node = head; node != last; node = node->next) {
+    node->next->prev = node;
+  }
+  head->prev = last;
+  return head;
+}
 
-  left_half.head_ = head_;
-  left_half.tail_ = middle;
-  left_half.size_ = size_ - right_half.size_;
+template <typename T, typename Allocator>
+template <class Compare>
+void list<T, Allocator>::mergeChains(Node*& out, Node* a, Node* b,
+                                     Compare& comp) {
+  if (!a || !b) {
+    out = a ? a : b;
+    return;
+  }
+  Node* a_tail = a->prev;
+  Node* b_tail = b->prev;
+  Node* head = nullptr;
+  Node** link = &head;
+  Node* last = nullptr;
+  try {
+    while (a && b) {
+      /* ties go to a, which holds the earlier elements */
+      Node* node;
+      if (comp(b->value, a->value)) {
+        node = b;
+        b = b->next;
+      } else {
+        node = a;
+        a = a->next;
+      }
+      *link = node;
+      node->prev = last;
+      last = node;
+      link = &node->next;
+    }
+  } catch (...) {
+    Node* rest[] = {a, b};
+    *link = concatChains(rest, 2);
+    out = head;
+    throw;
+  }
+  /* the rest of a or b is still linked and ends at that chain's tail */
+  *link = a ? a : b;
+  (*link)->prev = last;
+  head->prev = a ? a_tail : b_tail;
+  out = head;
+}
+
+template <typename T, typename Allocator>
+template <class Compare>
+void list<T, Allocator>::sortChain(Node*& head, Compare& comp) {
+  /* bins[i] holds a sorted run built from about 2^i natural runs; higher
+   * bins hold earlier elements, so they are the left side of merges */
+  Node* bins[std::numeric_limits<size_type>::digits + 1] = {};
+  size_type used = 0;
+  Node* rest = head;
+  Node* carry = nullptr;
+  try {
+    while (rest) {
+      carry = takeRun(rest, comp);
+      size_type i = 0;
+      for (; i < used && bins[i]; ++i) {
+        Node* left = bins[i];
+        bins[i] = nullptr;
+        Node* right = carry;
+        carry = nullptr;
+        mergeChains(carry, left, right, comp);
+      }
+      if (i == used && used < std::numeric_limits<size_type>::digits) ++used;
+      bins[i] = carry;
+      carry = nullptr;
+    }
+    for (size_type i = 0; i < used; ++i) {
+      Node* left = bins[i];
+      bins[i] = nullptr;
+      Node* right = carry;
+      carry = nullptr;
+      mergeChains(carry, left, right, comp);
+    }
+  } catch (...) {
+    bins[used] = carry;
+    Node* all[] = {concatChains(bins, used + 1), rest};
+    head = concatChains(all, 2);
+    throw;
+  }
+  head = carry;
+}
 
-  middle->next = nullptr;
-  right_half.head_->prev = nullptr;
+template <typename T, typename Allocator>
+typename list<T, Allocator>::Node* list<T, Allocator>::concatChains(
+    Node* const* chains, std::size_t count) {
+  Node* head = nullptr;
+  Node** link = &head;
+  for (std::size_t i = 0; i < count; ++i) {
+    *link = chains[i];
+    while (*link) link = &(*link)->next;
+  }
+  return head;
+}
 
-  left_half.sort();
-  right_half.sort();
+template <typename T, typename Allocator>
+void list<T, Allocator>::adoptChain(Node* head) {
+  head_ = head;
+  tail_ = head->prev;
+  head->prev = nullptr;
+}
 
-  merge_sorted(left_half, right_half);
+template <typename T, typename Allocator>
+void list<T, Allocator>::relink(Node* head) {
+  head_ = head;
+  tail_ = nullptr;
+  for (Node* node = head; node; node = node->next) {
+    node->prev = tail_;
+    tail_ = node;
+  }
 }
 
-template <typename T>
+template <typename T, typename Allocator>
 template <class... Args>
-typename list<T>::iterator list<T>::insert_many(const_iterator pos,
-                                                Args&&... args) {
-  for (const auto& arg : {args...}) {
-    insert(pos, arg);
-  }
+typename list<T, Allocator>::iterator list<T, Allocator>::insert_many(
+    const_iterator pos, Args&&... args) {
+  (emplace(pos, std::forward<Args>(args)), ...);
   return pos;
 }
 
-template <typename T>
+template <typename T, typename Allocator>
 template <class... Args>
-void list<T>::insert_many_back(Args&&... args) {
-  for (const auto& arg : {args...}) {
-    push_back(arg);
-  }
+void list<T, Allocator>::insert_many_back(Args&&... args) {
+  (emplace_back(std::forward<Args>(args)), ...);
 }
 
-template <typename T>
+template <typename T, typename Allocator>
 template <class... Args>
-void list<T>::insert_many_front(Args&&... args) {
-  for (const auto& arg : {args...}) {
-    push_front(arg);
-  }
+void list<T, Allocator>::insert_many_front(Args&&... args) {
+  (emplace_front(std::forward<Args>(args)), ...);
 }
 
 }  // namespace s21
\ No newline at end of file
@@ -1,13 +1,19 @@
 #ifndef S21_MAP_H_
 #define S21_MAP_H_
 
+#include <tuple>
 #include <vector>
 
 #include "../RBTree/s21_rbtree.h"
 
 namespace s21 {
-template <typename K, typename T>
-class map : public RBTree<K, T> {
+template <typename K, typename T,
+          typename Allocator = std::allocator<std::pair<const K, T>>>
+class map
+    : public RBTree<K, std::pair<const K, T>, MapKeyOfValue<K, T>, Allocator> {
+  using tree_type =
+      RBTree<K, std::pair<const K, T>, MapKeyOfValue<K, T>, Allocator>;
+
  public:
   class MapIterator;
   class ConstMapIterator;
@@ -20,46 +26,83 @@ class map : public RBTree<K, T> {
   using iterator = MapIterator;
   using const_iterator = ConstMapIterator;
   using size_type = size_t;
+  using allocator_type = Allocator;
 
-  map() : RBTree<K, T>(){};
+  map() : tree_type(){};
+  explicit map(const allocator_type &alloc) : tree_type(alloc){};
   map(std::initializer_list<value_type> const &items);
-  map(const map &other) : RBTree<K, T>(other){};
-  map(map &&other) noexcept : RBTree<K, T>(std::move(other)){};
+  /* Linear-time build when [first, last) is sorted by key */
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+  map(InputIt first, InputIt last);
+  map(const map &other) : tree_type(other){};
+  map(map &&other) noexcept : tree_type(std::move(other)){};
   map &operator=(const map &other);
-  map &operator=(map &&other) noexcept;
+  map &operator=(map &&other) noexcept(
+      std::is_nothrow_move_assignable<tree_type>::value);
 
   ~map() = default;
 
   T &at(const K &key);
   T &operator[](const K &key);
+  T &operator[](K &&key);
   std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(value_type &&value);
   std::pair<iterator, bool> insert(const K &key, const T &obj);
+  std::pair<iterator, bool> insert(const K &key, T &&obj);
   std::pair<iterator, bool> insert_or_assign(const K &key, const T &obj);
+  std::pair<iterator, bool> insert_or_assign(const K &key, T &&obj);
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args &&...args);
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(const K &key, Args &&...args);
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(K &&key, Args &&...args);
+  template <class... Args>
+  iterator emplace_hint(iterator hint, Args &&...args);
 
   template <class... Args>
   std::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
 
+  iterator nth_element(size_type k);
+  const_iterator nth_element(size_type k) const;
+  /* Move the elements with keys >= key into the returned map, O(log n) */
+  map split(const K &key);
+
+  iterator lower_bound(const K &key);
+  const_iterator lower_bound(const K &key) const;
+  iterator upper_bound(const K &key);
+  const_iterator upper_bound(const K &key) const;
+  std::pair<iterator, iterator> equal_range(const K &key);
+  std::pair<const_iterator, const_iterator> equal_range(const K &key) const;
+  /* Elements with keys in [lo, hi), iterated in place */
+  range_view<iterator> range(const K &lo, const K &hi);
+  range_view<const_iterator> range(const K &lo, const K &hi) const;
+
   iterator begin();
   iterator end();
   const_iterator cbegin() const;
   const_iterator cend() const;
 
-  class MapIterator : public RBTree<K, T>::Iterator {
+  class MapIterator : public tree_type::Iterator {
    public:
-    MapIterator() : RBTree<K, T>::Iterator() {}
-    MapIterator(const typename RBTree<K, T>::Iterator &other)
-        : RBTree<K, T>::Iterator(other) {}
+    MapIterator() : tree_type::Iterator() {}
+    MapIterator(const typename tree_type::Iterator &other)
+        : tree_type::Iterator(other) {}
     value_type &operator*();
   };
 
-  class ConstMapIterator : public RBTree<K, T>::ConstIterator {
+  class ConstMapIterator : public tree_type::ConstIterator {
    public:
-    ConstMapIterator() : RBTree<K, T>::ConstIterator() {}
-    ConstMapIterator(const typename RBTree<K, T>::ConstIterator &other)
-        : RBTree<K, T>::ConstIterator(other) {}
+    ConstMapIterator() : tree_type::ConstIterator() {}
+    ConstMapIterator(const typename tree_type::ConstIterator &other)
+        : tree_type::ConstIterator(other) {}
   };
+
+ private:
+  explicit map(tree_type &&tree) : tree_type(std::move(tree)) {}
 };
 }  // namespace s21
 #include "s21_map.tpp"
 
-#endif
\ No newline at end of file
+#endif
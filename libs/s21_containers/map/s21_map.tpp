@@ -1,104 +1,243 @@
 #include "s21_map.h"
 namespace s21 {
-template <typename K, typename T>
-map<K, T>::map(std::initializer_list<value_type> const &items) {
-  for (auto it = items.begin(); it != items.end(); ++it) {
-    insert(*it);
-  }
+template <typename K, typename T, typename Allocator>
+map<K, T, Allocator>::map(std::initializer_list<value_type> const &items) {
+  tree_type::assign_sorted(items.begin(), items.end());
+}
+
+template <typename K, typename T, typename Allocator>
+template <typename InputIt, typename>
+map<K, T, Allocator>::map(InputIt first, InputIt last) {
+  tree_type::assign_sorted(first, last);
 }
 
-template <typename K, typename T>
-map<K, T> &map<K, T>::operator=(const map &other) {
+template <typename K, typename T, typename Allocator>
+map<K, T, Allocator> &map<K, T, Allocator>::operator=(const map &other) {
   if (this != &other) {
-    RBTree<K, T>::operator=(other);
+    tree_type::operator=(other);
   }
   return *this;
 }
 
-template <typename K, typename T>
-map<K, T> &map<K, T>::operator=(map &&other) noexcept {
+template <typename K, typename T, typename Allocator>
+map<K, T, Allocator> &map<K, T, Allocator>::operator=(map &&other) noexcept(
+    std::is_nothrow_move_assignable<tree_type>::value) {
   if (this != &other) {
-    RBTree<K, T>::operator=(std::move(other));
+    tree_type::operator=(std::move(other));
   }
   return *this;
 }
 
-template <typename K, typename T>
-T &map<K, T>::at(const K &key) {
-  if (!RBTree<K, T>::contains(key)) {
+template <typename K, typename T, typename Allocator>
+T &map<K, T, Allocator>::at(const K &key) {
+  auto it = tree_type::find(key);
+  if (it == tree_type::end()) {
     throw std::out_of_range("map<K, T>::at(): key not found");
   }
-  return RBTree<K, T>::search(key);
+  return (*it).second;
 }
 
-template <typename K, typename T>
-T &map<K, T>::operator[](const K &key) {
-  if (!RBTree<K, T>::contains(key)) {
-    insert(key, T());
-  }
-  return RBTree<K, T>::search(key);
+template <typename K, typename T, typename Allocator>
+T &map<K, T, Allocator>::operator[](const K &key) {
+  return (*try_emplace(key).first).second;
+}
+
+template <typename K, typename T, typename Allocator>
+T &map<K, T, Allocator>::operator[](K &&key) {
+  return (*try_emplace(std::move(key)).first).second;
+}
+
+template <typename K, typename T, typename Allocator>
+std::pair<typename map<K, T, Allocator>::iterator, bool>
+map<K, T, Allocator>::insert(const value_type &value) {
+  auto res = tree_type::insert(value);
+  return {iterator(res.first), res.second};
+}
+
+template <typename K, typename T, typename Allocator>
+std::pair<typename map<K, T, Allocator>::iterator, bool>
+map<K, T, Allocator>::insert(value_type &&value) {
+  auto res = tree_type::insert(std::move(value));
+  return {iterator(res.first), res.second};
+}
+
+template <typename K, typename T, typename Allocator>
+std::pair<typename map<K, T, Allocator>::iterator, bool>
+map<K, T, Allocator>::insert(const K &key, const T &obj) {
+  return try_emplace(key, obj);
+}
+
+template <typename K, typename T, typename Allocator>
+std::pair<typename map<K, T, Allocator>::iterator, bool>
+map<K, T, Allocator>::insert(const K &key, T &&obj) {
+  return try_emplace(key, std::move(obj));
 }
 
-template <typename K, typename T>
-std::pair<typename map<K, T>::iterator, bool> map<K, T>::insert(
-    const value_type &value) {
-  return insert(value.first, value.second);
+template <typename K, typename T, typename Allocator>
+std::pair<typename map<K, T, Allocator>::iterator, bool>
+map<K, T, Allocator>::insert_or_assign(const K &key, const T &obj) {
+  auto res = try_emplace(key, obj);
+  if (!res.second) (*res.first).second = obj;
+  return res;
+}
+
+template <typename K, typename T, typename Allocator>
+std::pair<typename map<K, T, Allocator>::iterator, bool>
+map<K, T, Allocator>::insert_or_assign(const K &key, T &&obj) {
+  auto res = try_emplace(key, std::move(obj));
+  if (!res.second) (*res.first).second = std::move(obj);
+  return res;
 }
 
-template <typename K, typename T>
-std::pair<typename map<K, T>::iterator, bool> map<K, T>::insert(const K &key,
-                                                                const T &obj) {
-  auto res = RBTree<K, T>::insert(key, obj);
+template <typename K, typename T, typename Allocator>
+template <class... Args>
+std::pair<typename map<K, T, Allocator>::iterator, bool>
+map<K, T, Allocator>::emplace(Args &&...args) {
+  auto res = tree_type::emplace(std::forward<Args>(args)...);
+  return {iterator(res.first), res.second};
+}
+
+template <typename K, typename T, typename Allocator>
+template <class... Args>
+std::pair<typename map<K, T, Allocator>::iterator, bool>
+map<K, T, Allocator>::try_emplace(const K &key, Args &&...args) {
+  auto res = tree_type::try_emplace(
+      key, std::piecewise_construct, std::forward_as_tuple(key),
+      std::forward_as_tuple(std::forward<Args>(args)...));
   return {iterator(res.first), res.second};
 }
 
-template <typename K, typename T>
-std::pair<typename map<K, T>::iterator, bool> map<K, T>::insert_or_assign(
-    const K &key, const T &obj) {
-  auto res = RBTree<K, T>::insert_or_assign(key, obj);
+template <typename K, typename T, typename Allocator>
+template <class... Args>
+std::pair<typename map<K, T, Allocator>::iterator, bool>
+map<K, T, Allocator>::try_emplace(K &&key, Args &&...args) {
+  /* key is only moved into the node after the lookup has finished */
+  auto res = tree_type::try_emplace(
+      key, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+      std::forward_as_tuple(std::forward<Args>(args)...));
   return {iterator(res.first), res.second};
 }
 
-template <typename K, typename T>
+template <typename K, typename T, typename Allocator>
 template <class... Args>
-std::vector<std::pair<typename map<K, T>::iterator, bool>>
-map<K, T>::insert_many(Args &&...args) {
+typename map<K, T, Allocator>::iterator map<K, T, Allocator>::emplace_hint(
+    iterator hint, Args &&...args) {
+  return iterator(tree_type::emplace_hint(hint, std::forward<Args>(args)...));
+}
+
+template <typename K, typename T, typename Allocator>
+template <class... Args>
+std::vector<std::pair<typename map<K, T, Allocator>::iterator, bool>>
+map<K, T, Allocator>::insert_many(Args &&...args) {
   std::vector<std::pair<iterator, bool>> res;
-  for (const auto &arg : {args...}) {
-    res.push_back(insert(arg));
-  }
+  res.reserve(sizeof...(args));
+  (res.push_back(emplace(std::forward<Args>(args))), ...);
   return res;
 }
 
-template <typename K, typename T>
-typename map<K, T>::iterator map<K, T>::begin() {
-  return iterator(RBTree<K, T>::begin());
+template <typename K, typename T, typename Allocator>
+typename map<K, T, Allocator>::iterator map<K, T, Allocator>::nth_element(
+    size_type k) {
+  return iterator(tree_type::nth_element(k));
+}
+
+template <typename K, typename T, typename Allocator>
+typename map<K, T, Allocator>::const_iterator
+map<K, T, Allocator>::nth_element(size_type k) const {
+  return const_iterator(tree_type::nth_element(k));
+}
+
+template <typename K, typename T, typename Allocator>
+map<K, T, Allocator> map<K, T, Allocator>::split(const K &key) {
+  return map(tree_type::split(key));
+}
+
+template <typename K, typename T, typename Allocator>
+typename map<K, T, Allocator>::iterator map<K, T, Allocator>::lower_bound(
+    const K &key) {
+  return iterator(tree_type::lower_bound(key));
+}
+
+template <typename K, typename T, typename Allocator>
+typename map<K, T, Allocator>::const_iterator
+map<K, T, Allocator>::lower_bound(const K &key) const {
+  return const_iterator(tree_type::lower_bound(key));
+}
+
+template <typename K, typename T, typename Allocator>
+typename map<K, T, Allocator>::iterator map<K, T, Allocator>::upper_bound(
+    const K &key) {
+  return iterator(tree_type::upper_bound(key));
+}
+
+template <typename K, typename T, typename Allocator>
+typename map<K, T, Allocator>::const_iterator
+map<K, T, Allocator>::upper_bound(const K &key) const {
+  return const_iterator(tree_type::upper_bound(key));
+}
+
+template <typename K, typename T, typename Allocator>
+std::pair<typename map<K, T, Allocator>::iterator,
+          typename map<K, T, Allocator>::iterator>
+map<K, T, Allocator>::equal_range(const K &key) {
+  auto res = tree_type::equal_range(key);
+  return {iterator(res.first), iterator(res.second)};
+}
+
+template <typename K, typename T, typename Allocator>
+std::pair<typename map<K, T, Allocator>::const_iterator,
+          typename map<K, T, Allocator>::const_iterator>
+map<K, T, Allocator>::equal_range(const K &key) const {
+  auto res = tree_type::equal_range(key);
+  return {const_iterator(res.first), const_iterator(res.second)};
+}
+
+template <typename K, typename T, typename Allocator>
+range_view<typename map<K, T, Allocator>::iterator>
+map<K, T, Allocator>::range(const K &lo, const K &hi) {
+  auto res = tree_type::range(lo, hi);
+  return {iterator(res.begin()), iterator(res.end())};
+}
+
+template <typename K, typename T, typename Allocator>
+range_view<typename map<K, T, Allocator>::const_iterator>
+map<K, T, Allocator>::range(const K &lo, const K &hi) const {
+  auto res = tree_type::range(lo, hi);
+  return {const_iterator(res.begin()), const_iterator(res.end())};
+}
+
+template <typename K, typename T, typename Allocator>
+typename map<K, T, Allocator>::iterator map<K, T, Allocator>::begin() {
+  return iterator(tree_type::begin());
 }
 
-template <typename K, typename T>
-typename map<K, T>::iterator map<K, T>::end() {
-  return iterator(RBTree<K, T>::end());
+template <typename K, typename T, typename Allocator>
+typename map<K, T, Allocator>::iterator map<K, T, Allocator>::end() {
+  return iterator(tree_type::end());
 }
 
-template <typename K, typename T>
-typename map<K, T>::const_iterator map<K, T>::cbegin() const {
-  return const_iterator(RBTree<K, T>::cbegin());
+template <typename K, typename T, typename Allocator>
+typename map<K, T, Allocator>::const_iterator map<K, T, Allocator>::cbegin()
+    const {
+  return const_iterator(tree_type::cbegin());
 }
 
-template <typename K, typename T>
-typename map<K, T>::const_iterator map<K, T>::cend() const {
-  return const_iterator(RBTree<K, T>::cend());
+template <typename K, typename T, typename Allocator>
+typename map<K, T, Allocator>::const_iterator map<K, T, Allocator>::cend()
+    const {
+  return const_iterator(tree_type::cend());
 }
 
-template <typename K, typename T>
-typename map<K, T>::value_type &map<K, T>::MapIterator::operator*() {
-  typename RBTree<K, T>::Node *node = RBTree<K, T>::Iterator::getNode();
+template <typename K, typename T, typename Allocator>
+typename map<K, T, Allocator>::value_type &
+map<K, T, Allocator>::MapIterator::operator*() {
+  typename tree_type::Node *node = tree_type::Iterator::getNode();
 
   if (!node) {
     throw std::out_of_range(
         "map<K, T>::MapIterator::operator*(): iterator out of range");
   }
-  return node->pair;
+  return node->value;
 }
 
-}  // namespace s21
\ No newline at end of file
+}  // namespace s21
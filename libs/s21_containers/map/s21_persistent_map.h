@@ -0,0 +1,43 @@
+#ifndef S21_PERSISTENT_MAP_H_
+#define S21_PERSISTENT_MAP_H_
+
+#include "../RBTree/s21_persistent_rbtree.h"
+
+namespace s21 {
+/* Map with O(1) immutable snapshots for concurrent readers, see
+ * PersistentRBTree. Values are copied when their node is path-copied,
+ * so T must be copy-constructible. */
+template <typename K, typename T,
+          typename Allocator = std::allocator<std::pair<const K, T>>>
+class persistent_map
+    : public PersistentRBTree<K, std::pair<const K, T>, MapKeyOfValue<K, T>,
+                              Allocator> {
+  using tree_type =
+      PersistentRBTree<K, std::pair<const K, T>, MapKeyOfValue<K, T>,
+                       Allocator>;
+
+ public:
+  using key_type = K;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using const_reference = const value_type &;
+  using const_iterator = typename tree_type::const_iterator;
+  using snapshot_type = typename tree_type::snapshot_type;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  persistent_map() : tree_type() {}
+  explicit persistent_map(const allocator_type &alloc) : tree_type(alloc) {}
+  persistent_map(std::initializer_list<value_type> const &items);
+
+  const T &at(const K &key) const;
+
+  using tree_type::insert;
+  using tree_type::insert_or_assign;
+  bool insert(const K &key, const T &obj);
+  bool insert_or_assign(const K &key, const T &obj);
+};
+}  // namespace s21
+#include "s21_persistent_map.tpp"
+
+#endif
@@ -0,0 +1,31 @@
+#include "s21_persistent_map.h"
+
+namespace s21 {
+
+template <typename K, typename T, typename Allocator>
+persistent_map<K, T, Allocator>::persistent_map(
+    std::initializer_list<value_type> const &items) {
+  for (const value_type &item : items) tree_type::insert(item);
+}
+
+template <typename K, typename T, typename Allocator>
+const T &persistent_map<K, T, Allocator>::at(const K &key) const {
+  const_iterator it = tree_type::find(key);
+  if (it == tree_type::end()) {
+    throw std::out_of_range("persistent_map<K, T>::at(): key not found");
+  }
+  return it->second;
+}
+
+template <typename K, typename T, typename Allocator>
+bool persistent_map<K, T, Allocator>::insert(const K &key, const T &obj) {
+  return tree_type::insert(value_type(key, obj));
+}
+
+template <typename K, typename T, typename Allocator>
+bool persistent_map<K, T, Allocator>::insert_or_assign(const K &key,
+                                                       const T &obj) {
+  return tree_type::insert_or_assign(value_type(key, obj));
+}
+
+}  // namespace s21
@@ -0,0 +1,196 @@
+#ifndef S21_PARALLEL_H
+#define S21_PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "s21_thread_pool.h"
+
+namespace s21 {
+/* Data-parallel algorithms on a thread_pool. Ranges are cut into chunks
+ * of options::grain elements that run as tasks of one thread_pool::run().
+ *
+ * Every algorithm takes either a random-access iterator range or a
+ * container: s21::vector and s21::array are processed through data(),
+ * map and set in segments that start at nth_element(), so a chunk costs
+ * one O(log n) descent plus the walk over its own elements.
+ *
+ * The functions passed in are called from several threads at once. If
+ * one throws, chunks not started yet are skipped and the exception is
+ * rethrown once the running ones finish. */
+namespace parallel {
+
+struct options {
+  /* Elements per task; 0 picks max(kMinGrain, size / kMaxChunks) */
+  std::size_t grain = 0;
+  /* reduce combines the chunk results in range order, so a grain fixed
+   * by the caller gives the same result on every pool and run */
+  bool deterministic = false;
+  /* nullptr means thread_pool::default_pool() */
+  thread_pool* pool = nullptr;
+};
+
+/* Default chunking: few enough chunks to keep the tasks cheap, enough to
+ * balance uneven work across the pool */
+constexpr std::size_t kMinGrain = 1024;
+constexpr std::size_t kMaxChunks = 256;
+
+namespace detail {
+
+template <class C, class = void>
+struct is_container : std::false_type {};
+template <class C>
+struct is_container<C, std::void_t<decltype(std::declval<C&>().size())>>
+    : std::true_type {};
+
+template <class C, class = void>
+struct has_nth_element : std::false_type {};
+template <class C>
+struct has_nth_element<
+    C, std::void_t<decltype(std::declval<C&>().nth_element(std::size_t()))>>
+    : std::true_type {};
+
+template <class C>
+using enable_if_container =
+    std::enable_if_t<is_container<std::remove_const_t<C>>::value>;
+
+/* First element of a random-access range */
+template <class It>
+struct IndexedRange {
+  It first;
+  std::size_t size;
+
+  It at(std::size_t index) const { return first + index; }
+};
+
+/* Elements of a map or set, found by order statistics */
+template <class Container>
+struct SegmentedRange {
+  Container* container;
+  std::size_t size;
+
+  auto at(std::size_t index) const { return container->nth_element(index); }
+};
+
+template <class C>
+auto dataOf(C& c, int) -> decltype(c.data()) {
+  return c.data();
+}
+/* const s21::array only has cdata() */
+template <class C>
+auto dataOf(C& c, long) -> decltype(c.cdata()) {
+  return c.cdata();
+}
+
+template <class C>
+auto beginOf(C& c);
+template <class C>
+auto rangeOf(C& c);
+template <class It>
+IndexedRange<It> rangeOf(It first, It last);
+
+inline thread_pool& poolOf(const options& opts);
+inline std::size_t grainOf(std::size_t size, const options& opts);
+
+/* Call fn(it, count, begin) for every chunk of range, where it points at
+ * element begin and count elements follow */
+template <class Range, class Fn>
+void forChunks(const Range& range, const options& opts, Fn&& fn);
+
+template <class Range, class UnaryFunction>
+void forEach(const Range& range, UnaryFunction& f, const options& opts);
+template <class Range, class OutputIt, class UnaryOperation>
+OutputIt transform(const Range& range, OutputIt d_first, UnaryOperation& op,
+                   const options& opts);
+template <class Range, class T, class BinaryOperation>
+T reduce(const Range& range, T init, BinaryOperation& op,
+         const options& opts);
+template <class Range, class UnaryPredicate>
+auto findIf(const Range& range, UnaryPredicate& pred, const options& opts);
+template <class Range, class UnaryPredicate>
+std::size_t countIf(const Range& range, UnaryPredicate& pred,
+                    const options& opts);
+
+}  // namespace detail
+
+template <class RandomIt, class UnaryFunction>
+void for_each(RandomIt first, RandomIt last, UnaryFunction f,
+              const options& opts = options());
+template <class Container, class UnaryFunction,
+          class = detail::enable_if_container<Container>>
+void for_each(Container& c, UnaryFunction f, const options& opts = options());
+
+/* Write op(x) for every x of the range to d_first..., a random-access
+ * output; return the end of the output */
+template <class RandomIt, class OutputIt, class UnaryOperation>
+OutputIt transform(RandomIt first, RandomIt last, OutputIt d_first,
+                   UnaryOperation op, const options& opts = options());
+template <class Container, class OutputIt, class UnaryOperation,
+          class = detail::enable_if_container<Container>>
+OutputIt transform(Container& c, OutputIt d_first, UnaryOperation op,
+                   const options& opts = options());
+
+/* init combined with every element. op must be associative; unless
+ * opts.deterministic is set it must be commutative too, as chunk results
+ * are combined in the order they finish. */
+template <class RandomIt, class T, class BinaryOperation>
+T reduce(RandomIt first, RandomIt last, T init, BinaryOperation op,
+         const options& opts = options());
+template <class RandomIt, class T>
+T reduce(RandomIt first, RandomIt last, T init,
+         const options& opts = options());
+template <class Container, class T, class BinaryOperation,
+          class = detail::enable_if_container<Container>>
+T reduce(Container& c, T init, BinaryOperation op,
+         const options& opts = options());
+template <class Container, class T,
+          class = detail::enable_if_container<Container>>
+T reduce(Container& c, T init, const options& opts = options());
+
+/* Not stable. Chunks are sorted in parallel, then merged pairwise in
+ * rounds; comp is shared by all threads. Without a grain there is one
+ * chunk per pool thread. */
+template <class RandomIt, class Compare>
+void sort(RandomIt first, RandomIt last, Compare comp,
+          const options& opts = options());
+template <class RandomIt>
+void sort(RandomIt first, RandomIt last, const options& opts = options());
+template <class Container, class Compare,
+          class = detail::enable_if_container<Container>>
+void sort(Container& c, Compare comp, const options& opts = options());
+template <class Container, class = detail::enable_if_container<Container>>
+void sort(Container& c, const options& opts = options());
+
+/* First element satisfying pred, last / end() if none; the container
+ * version returns the container's iterator. Chunks past a match already
+ * found are skipped. */
+template <class RandomIt, class UnaryPredicate>
+RandomIt find_if(RandomIt first, RandomIt last, UnaryPredicate pred,
+                 const options& opts = options());
+template <class Container, class UnaryPredicate,
+          class = detail::enable_if_container<Container>>
+auto find_if(Container& c, UnaryPredicate pred,
+             const options& opts = options());
+
+template <class RandomIt, class UnaryPredicate>
+std::size_t count_if(RandomIt first, RandomIt last, UnaryPredicate pred,
+                     const options& opts = options());
+template <class Container, class UnaryPredicate,
+          class = detail::enable_if_container<Container>>
+std::size_t count_if(Container& c, UnaryPredicate pred,
+                     const options& opts = options());
+
+}  // namespace parallel
+}  // namespace s21
+
+#include "s21_parallel.tpp"
+
+#endif  // S21_PARALLEL_H
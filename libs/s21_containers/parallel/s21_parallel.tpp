@@ -0,0 +1,263 @@
+#include "s21_parallel.h"
+
+namespace s21 {
+namespace parallel {
+
+/* CHUNKING */
+template <class C>
+auto detail::beginOf(C& c) {
+  if constexpr (std::is_const<C>::value) {
+    return c.cbegin();
+  } else {
+    return c.begin();
+  }
+}
+
+template <class C>
+auto detail::rangeOf(C& c) {
+  if constexpr (has_nth_element<C>::value) {
+    return SegmentedRange<C>{&c, c.size()};
+  } else {
+    auto first = dataOf(c, 0);
+    return IndexedRange<decltype(first)>{first, c.size()};
+  }
+}
+
+template <class It>
+detail::IndexedRange<It> detail::rangeOf(It first, It last) {
+  return IndexedRange<It>{first, std::size_t(last - first)};
+}
+
+inline thread_pool& detail::poolOf(const options& opts) {
+  return opts.pool ? *opts.pool : thread_pool::default_pool();
+}
+
+inline std::size_t detail::grainOf(std::size_t size, const options& opts) {
+  if (opts.grain) return opts.grain;
+  return std::max(kMinGrain, (size + kMaxChunks - 1) / kMaxChunks);
+}
+
+template <class Range, class Fn>
+void detail::forChunks(const Range& range, const options& opts, Fn&& fn) {
+  std::size_t grain = grainOf(range.size, opts);
+  std::size_t chunks = (range.size + grain - 1) / grain;
+  poolOf(opts).run(chunks, [&](std::size_t chunk) {
+    std::size_t begin = chunk * grain;
+    fn(range.at(begin), std::min(grain, range.size - begin), begin);
+  });
+}
+
+/* ALGORITHMS ON RANGES */
+template <class Range, class UnaryFunction>
+void detail::forEach(const Range& range, UnaryFunction& f,
+                     const options& opts) {
+  forChunks(range, opts, [&](auto it, std::size_t count, std::size_t) {
+    for (; count; --count, ++it) f(*it);
+  });
+}
+
+template <class Range, class OutputIt, class UnaryOperation>
+OutputIt detail::transform(const Range& range, OutputIt d_first,
+                           UnaryOperation& op, const options& opts) {
+  forChunks(range, opts, [&](auto it, std::size_t count, std::size_t begin) {
+    OutputIt out = d_first + std::ptrdiff_t(begin);
+    for (; count; --count, ++it, ++out) *out = op(*it);
+  });
+  return d_first + std::ptrdiff_t(range.size);
+}
+
+template <class Range, class T, class BinaryOperation>
+T detail::reduce(const Range& range, T init, BinaryOperation& op,
+                 const options& opts) {
+  auto fold = [&](auto it, std::size_t count) {
+    T value(*it);
+    for (++it; --count; ++it) value = op(std::move(value), *it);
+    return value;
+  };
+
+  if (opts.deterministic) {
+    std::size_t grain = grainOf(range.size, opts);
+    std::vector<std::optional<T>> partial((range.size + grain - 1) / grain);
+    forChunks(range, opts,
+              [&](auto it, std::size_t count, std::size_t begin) {
+                partial[begin / grain].emplace(fold(it, count));
+              });
+    for (std::optional<T>& value : partial) {
+      init = op(std::move(init), std::move(*value));
+    }
+    return init;
+  }
+
+  std::mutex lock;
+  forChunks(range, opts, [&](auto it, std::size_t count, std::size_t) {
+    T value = fold(it, count);
+    std::lock_guard<std::mutex> guard(lock);
+    init = op(std::move(init), std::move(value));
+  });
+  return init;
+}
+
+template <class Range, class UnaryPredicate>
+auto detail::findIf(const Range& range, UnaryPredicate& pred,
+                    const options& opts) {
+  std::atomic<std::size_t> found(range.size);
+  forChunks(range, opts, [&](auto it, std::size_t count, std::size_t begin) {
+    for (std::size_t i = begin; i < begin + count; ++i, ++it) {
+      if (found.load(std::memory_order_relaxed) <= i) return;
+      if (pred(*it)) {
+        std::size_t seen = found.load(std::memory_order_relaxed);
+        while (i < seen && !found.compare_exchange_weak(
+                               seen, i, std::memory_order_relaxed)) {
+        }
+        return;
+      }
+    }
+  });
+  return range.at(found.load(std::memory_order_relaxed));
+}
+
+template <class Range, class UnaryPredicate>
+std::size_t detail::countIf(const Range& range, UnaryPredicate& pred,
+                            const options& opts) {
+  std::atomic<std::size_t> total(0);
+  forChunks(range, opts, [&](auto it, std::size_t count, std::size_t) {
+    std::size_t matches = 0;
+    for (; count; --count, ++it) {
+      if (pred(*it)) ++matches;
+    }
+    total.fetch_add(matches, std::memory_order_relaxed);
+  });
+  return total.load(std::memory_order_relaxed);
+}
+
+/* FOR_EACH */
+template <class RandomIt, class UnaryFunction>
+void for_each(RandomIt first, RandomIt last, UnaryFunction f,
+              const options& opts) {
+  detail::forEach(detail::rangeOf(first, last), f, opts);
+}
+
+template <class Container, class UnaryFunction, class>
+void for_each(Container& c, UnaryFunction f, const options& opts) {
+  detail::forEach(detail::rangeOf(c), f, opts);
+}
+
+/* TRANSFORM */
+template <class RandomIt, class OutputIt, class UnaryOperation>
+OutputIt transform(RandomIt first, RandomIt last, OutputIt d_first,
+                   UnaryOperation op, const options& opts) {
+  return detail::transform(detail::rangeOf(first, last), d_first, op, opts);
+}
+
+template <class Container, class OutputIt, class UnaryOperation, class>
+OutputIt transform(Container& c, OutputIt d_first, UnaryOperation op,
+                   const options& opts) {
+  return detail::transform(detail::rangeOf(c), d_first, op, opts);
+}
+
+/* REDUCE */
+template <class RandomIt, class T, class BinaryOperation>
+T reduce(RandomIt first, RandomIt last, T init, BinaryOperation op,
+         const options& opts) {
+  if (first == last) return init;
+  return detail::reduce(detail::rangeOf(first, last), std::move(init), op,
+                        opts);
+}
+
+template <class RandomIt, class T>
+T reduce(RandomIt first, RandomIt last, T init, const options& opts) {
+  return reduce(first, last, std::move(init), std::plus<>(), opts);
+}
+
+template <class Container, class T, class BinaryOperation, class>
+T reduce(Container& c, T init, BinaryOperation op, const options& opts) {
+  if (c.empty()) return init;
+  return detail::reduce(detail::rangeOf(c), std::move(init), op, opts);
+}
+
+template <class Container, class T, class>
+T reduce(Container& c, T init, const options& opts) {
+  return reduce(c, std::move(init), std::plus<>(), opts);
+}
+
+/* SORT */
+template <class RandomIt, class Compare>
+void sort(RandomIt first, RandomIt last, Compare comp, const options& opts) {
+  std::size_t size = std::size_t(last - first);
+  thread_pool& pool = detail::poolOf(opts);
+  /* every merge round is a pass over the data, so by default there is
+   * one chunk per thread rather than many small ones */
+  std::size_t grain = opts.grain;
+  if (!grain) {
+    grain = std::max(kMinGrain, (size + pool.size() - 1) / pool.size());
+  }
+  std::size_t chunks = (size + grain - 1) / grain;
+  auto bound = [&](std::size_t chunk) {
+    return first + std::ptrdiff_t(std::min(size, chunk * grain));
+  };
+
+  pool.run(chunks, [&](std::size_t chunk) {
+    std::sort(bound(chunk), bound(chunk + 1), comp);
+  });
+  /* merge runs of width chunks with their right neighbours */
+  for (std::size_t width = 1; width < chunks; width *= 2) {
+    std::size_t pairs = (chunks + 2 * width - 1) / (2 * width);
+    pool.run(pairs, [&](std::size_t pair) {
+      std::size_t left = pair * 2 * width;
+      if (left + width >= chunks) return;
+      std::inplace_merge(bound(left), bound(left + width),
+                         bound(left + 2 * width), comp);
+    });
+  }
+}
+
+template <class RandomIt>
+void sort(RandomIt first, RandomIt last, const options& opts) {
+  using value_type = typename std::iterator_traits<RandomIt>::value_type;
+  sort(first, last, std::less<value_type>(), opts);
+}
+
+template <class Container, class Compare, class>
+void sort(Container& c, Compare comp, const options& opts) {
+  auto first = detail::dataOf(c, 0);
+  sort(first, first + c.size(), comp, opts);
+}
+
+template <class Container, class>
+void sort(Container& c, const options& opts) {
+  auto first = detail::dataOf(c, 0);
+  sort(first, first + c.size(), opts);
+}
+
+/* FIND_IF / COUNT_IF */
+template <class RandomIt, class UnaryPredicate>
+RandomIt find_if(RandomIt first, RandomIt last, UnaryPredicate pred,
+                 const options& opts) {
+  return detail::findIf(detail::rangeOf(first, last), pred, opts);
+}
+
+template <class Container, class UnaryPredicate, class>
+auto find_if(Container& c, UnaryPredicate pred, const options& opts) {
+  auto range = detail::rangeOf(c);
+  auto found = detail::findIf(range, pred, opts);
+  if constexpr (detail::has_nth_element<Container>::value) {
+    return found;
+  } else {
+    return detail::beginOf(c) + (found - range.first);
+  }
+}
+
+template <class RandomIt, class UnaryPredicate>
+std::size_t count_if(RandomIt first, RandomIt last, UnaryPredicate pred,
+                     const options& opts) {
+  return detail::countIf(detail::rangeOf(first, last), pred, opts);
+}
+
+template <class Container, class UnaryPredicate, class>
+std::size_t count_if(Container& c, UnaryPredicate pred,
+                     const options& opts) {
+  return detail::countIf(detail::rangeOf(c), pred, opts);
+}
+
+}  // namespace parallel
+}  // namespace s21
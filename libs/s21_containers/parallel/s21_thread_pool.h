@@ -0,0 +1,105 @@
+#ifndef S21_THREAD_POOL_H
+#define S21_THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "../deque/s21_deque.h"
+
+namespace s21 {
+namespace parallel {
+
+/* Fork-join pool with work stealing. run() hands out an index range by
+ * halving it: the thread that holds a range keeps the lower half and
+ * pushes the upper one onto its own task deque, idle threads steal from
+ * the other end of that deque. Big ranges spread over the pool in a few
+ * steps and every thread works through neighbouring indices.
+ *
+ * The calling thread works on its own run() and, while it waits, on any
+ * queued task, so bodies may call run() again without deadlocking. */
+class thread_pool {
+ public:
+  /* threads counts the caller: threads - 1 workers are started, fewer if
+   * the system refuses. 0 means one per hardware thread. */
+  explicit thread_pool(unsigned threads = 0);
+  thread_pool(const thread_pool&) = delete;
+  thread_pool& operator=(const thread_pool&) = delete;
+  ~thread_pool();
+
+  /* Threads taking part in a run(), the caller included */
+  unsigned size() const;
+
+  /* Call body(i) for every i in [0, count) and return when all calls are
+   * done. After a call throws, indices not started yet are skipped and
+   * the first exception is rethrown here. */
+  template <class Body>
+  void run(std::size_t count, Body&& body);
+
+  /* Pool used by the parallel algorithms unless told otherwise */
+  static thread_pool& default_pool();
+
+ private:
+  static constexpr std::size_t kCacheLine = 64;
+
+  struct Job {
+    void (*call)(void* body, std::size_t index);
+    void* body;
+    std::atomic<std::size_t> remaining; /* indices not finished */
+    std::atomic<bool> failed;
+    std::exception_ptr error; /* set by the thread that set failed */
+  };
+
+  /* Indices [first, last) of a job */
+  struct Task {
+    Job* job;
+    std::size_t first;
+    std::size_t last;
+  };
+
+  struct alignas(kCacheLine) Queue {
+    std::mutex lock;
+    deque<Task> tasks;
+  };
+
+  /* One queue per worker and a last one shared by outside callers */
+  std::unique_ptr<Queue[]> queues_;
+  unsigned queue_count_;
+  std::vector<std::thread> workers_;
+
+  std::mutex sleep_lock_;
+  std::condition_variable wake_;
+  std::atomic<unsigned> sleepers_{0};
+  std::uint64_t epoch_ = 0; /* bumped under sleep_lock_ to wake sleepers */
+  bool stop_ = false;
+
+  /* Queue of the running thread, for its pool */
+  inline static thread_local thread_pool* current_pool_ = nullptr;
+  inline static thread_local unsigned current_queue_ = 0;
+
+  unsigned ownQueue() const;
+  void push(unsigned queue, const Task& task);
+  bool pop(unsigned queue, Task& task);
+  bool steal(unsigned thief, Task& task);
+  /* Run one queued task, false if there was none */
+  bool runOne(unsigned queue);
+  void execute(unsigned queue, Task task);
+  void workerLoop(unsigned queue);
+  void notify();
+};
+
+}  // namespace parallel
+}  // namespace s21
+
+#include "s21_thread_pool.tpp"
+
+#endif  // S21_THREAD_POOL_H
@@ -0,0 +1,158 @@
+#include "s21_thread_pool.h"
+
+namespace s21 {
+namespace parallel {
+
+inline thread_pool::thread_pool(unsigned threads) {
+  if (!threads) threads = std::max(1u, std::thread::hardware_concurrency());
+  queue_count_ = threads;
+  queues_.reset(new Queue[queue_count_]);
+  workers_.reserve(threads - 1);
+  for (unsigned i = 0; i + 1 < threads; ++i) {
+    try {
+      workers_.emplace_back(&thread_pool::workerLoop, this, i);
+    } catch (const std::system_error&) {
+      break; /* work with the threads we got */
+    }
+  }
+}
+
+inline thread_pool::~thread_pool() {
+  {
+    std::lock_guard<std::mutex> lock(sleep_lock_);
+    stop_ = true;
+    ++epoch_;
+  }
+  wake_.notify_all();
+  for (std::thread& worker : workers_) worker.join();
+}
+
+inline unsigned thread_pool::size() const {
+  return unsigned(workers_.size()) + 1;
+}
+
+template <class Body>
+void thread_pool::run(std::size_t count, Body&& body) {
+  if (!count) return;
+  if (workers_.empty()) {
+    for (std::size_t i = 0; i < count; ++i) body(i);
+    return;
+  }
+
+  using Fn = std::remove_reference_t<Body>;
+  Job job;
+  job.call = [](void* fn, std::size_t index) {
+    (*static_cast<Fn*>(fn))(index);
+  };
+  job.body = const_cast<void*>(static_cast<const void*>(&body));
+  job.remaining.store(count, std::memory_order_relaxed);
+  job.failed.store(false, std::memory_order_relaxed);
+
+  unsigned queue = ownQueue();
+  execute(queue, Task{&job, 0, count});
+  /* help with whatever is queued until the last index of job is done */
+  while (job.remaining.load(std::memory_order_acquire)) {
+    if (!runOne(queue)) std::this_thread::yield();
+  }
+  if (job.error) std::rethrow_exception(job.error);
+}
+
+inline thread_pool& thread_pool::default_pool() {
+  static thread_pool pool;
+  return pool;
+}
+
+inline unsigned thread_pool::ownQueue() const {
+  return current_pool_ == this ? current_queue_ : queue_count_ - 1;
+}
+
+inline void thread_pool::push(unsigned queue, const Task& task) {
+  {
+    std::lock_guard<std::mutex> lock(queues_[queue].lock);
+    queues_[queue].tasks.push_back(task);
+  }
+  notify();
+}
+
+inline bool thread_pool::pop(unsigned queue, Task& task) {
+  std::lock_guard<std::mutex> lock(queues_[queue].lock);
+  if (queues_[queue].tasks.empty()) return false;
+  task = queues_[queue].tasks.back();
+  queues_[queue].tasks.pop_back();
+  return true;
+}
+
+inline bool thread_pool::steal(unsigned thief, Task& task) {
+  for (unsigned i = 1; i < queue_count_; ++i) {
+    Queue& victim = queues_[(thief + i) % queue_count_];
+    std::lock_guard<std::mutex> lock(victim.lock);
+    if (victim.tasks.empty()) continue;
+    /* the oldest task is the biggest range */
+    task = victim.tasks.front();
+    victim.tasks.pop_front();
+    return true;
+  }
+  return false;
+}
+
+inline bool thread_pool::runOne(unsigned queue) {
+  Task task;
+  if (!pop(queue, task) && !steal(queue, task)) return false;
+  execute(queue, task);
+  return true;
+}
+
+inline void thread_pool::execute(unsigned queue, Task task) {
+  while (task.last - task.first > 1) {
+    std::size_t middle = task.first + (task.last - task.first) / 2;
+    push(queue, Task{task.job, middle, task.last});
+    task.last = middle;
+  }
+  Job* job = task.job;
+  if (!job->failed.load(std::memory_order_relaxed)) {
+    try {
+      job->call(job->body, task.first);
+    } catch (...) {
+      if (!job->failed.exchange(true)) job->error = std::current_exception();
+    }
+  }
+  /* last touch of job: its owner may return once remaining hits 0 */
+  job->remaining.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+inline void thread_pool::workerLoop(unsigned queue) {
+  current_pool_ = this;
+  current_queue_ = queue;
+  while (true) {
+    if (runOne(queue)) continue;
+
+    std::unique_lock<std::mutex> lock(sleep_lock_);
+    if (stop_) return;
+    std::uint64_t seen = epoch_;
+    sleepers_.fetch_add(1, std::memory_order_seq_cst);
+    lock.unlock();
+    /* a push that missed the sleeper count happened before this look */
+    Task task;
+    if (steal(queue, task)) {
+      sleepers_.fetch_sub(1, std::memory_order_relaxed);
+      execute(queue, task);
+      continue;
+    }
+    lock.lock();
+    wake_.wait(lock, [&] { return stop_ || epoch_ != seen; });
+    sleepers_.fetch_sub(1, std::memory_order_relaxed);
+  }
+}
+
+inline void thread_pool::notify() {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (!sleepers_.load(std::memory_order_relaxed)) return;
+  {
+    std::lock_guard<std::mutex> lock(sleep_lock_);
+    ++epoch_;
+  }
+  wake_.notify_one();
+}
+
+}  // namespace parallel
+}  // namespace s21
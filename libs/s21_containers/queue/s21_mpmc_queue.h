@@ -0,0 +1,132 @@
+#ifndef S21_MPMC_QUEUE_H
+#define S21_MPMC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define S21_QUEUE_FUTEX 1
+#else
+#define S21_QUEUE_FUTEX 0
+#endif
+
+namespace s21 {
+/* Bounded lock-free ring queue after D. Vyukov: every cell carries a
+ * sequence number telling producers and consumers whose turn it is, so a
+ * push or pop is one CAS on the shared position plus one store to the
+ * cell. The positions and wait words sit on separate cache lines.
+ *
+ * MultiProducer / MultiConsumer = false drop the CAS on that side; use
+ * the spsc_queue and mpsc_queue aliases and keep to one thread per side.
+ * try_* calls never block. push, pop and insert_many_back spin briefly,
+ * then sleep on a futex (a yield loop off Linux) until there is room or
+ * an element. T must be nothrow move constructible and assignable. */
+template <class T, bool MultiProducer = true, bool MultiConsumer = true>
+class mpmc_queue {
+  static_assert(std::is_nothrow_move_constructible<T>::value &&
+                    std::is_nothrow_move_assignable<T>::value,
+                "mpmc_queue elements must be nothrow movable");
+
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = std::size_t;
+
+  /* Capacity is rounded up to a power of two, at least 2 */
+  explicit mpmc_queue(size_type capacity);
+  mpmc_queue(const mpmc_queue&) = delete;
+  mpmc_queue& operator=(const mpmc_queue&) = delete;
+  ~mpmc_queue();
+
+  bool try_push(const_reference value);
+  bool try_push(value_type&& value);
+  template <class... Args>
+  bool try_emplace(Args&&... args);
+  bool try_pop(reference out);
+
+  /* Push the first elements of [first, first + count) that fit, pop up to
+   * count elements to out; one CAS per batch. Return how many moved. */
+  template <class InputIt>
+  size_type push_bulk(InputIt first, size_type count);
+  template <class OutputIt>
+  size_type pop_bulk(OutputIt out, size_type count);
+
+  /* Blocking variants */
+  void push(const_reference value);
+  void push(value_type&& value);
+  template <class... Args>
+  void emplace(Args&&... args);
+  void pop(reference out);
+  template <class... Args>
+  void insert_many_back(Args&&... args);
+
+  /* Exact only while no other thread is pushing or popping */
+  size_type size() const;
+  bool empty() const;
+  size_type capacity() const;
+
+ private:
+  static constexpr size_type kCacheLine = 64;
+  static constexpr int kSpins = 64;
+
+  struct Cell {
+    std::atomic<size_type> sequence;
+    alignas(T) unsigned char storage[sizeof(T)];
+
+    T* value() { return std::launder(reinterpret_cast<T*>(storage)); }
+  };
+
+  /* Sleepers on one side of the queue; epoch changes on every wake-up */
+  struct alignas(kCacheLine) WaitPoint {
+    std::atomic<std::uint32_t> epoch{0};
+    std::atomic<std::uint32_t> waiters{0};
+  };
+
+  /* Consecutive cells claimed by one push or pop */
+  struct Claim {
+    size_type pos;
+    size_type count;
+  };
+
+  std::unique_ptr<Cell[]> cells_;
+  size_type mask_;
+  alignas(kCacheLine) std::atomic<size_type> tail_; /* next push */
+  alignas(kCacheLine) std::atomic<size_type> head_; /* next pop */
+  WaitPoint not_full_;
+  WaitPoint not_empty_;
+
+  Claim claimPush(size_type count);
+  Claim claimPop(size_type count);
+  void publishPush(size_type pos);
+  void publishPop(size_type pos);
+
+  /* Sleep until try() succeeds */
+  template <class Try>
+  void waitFor(WaitPoint& point, Try try_once);
+  void notify(WaitPoint& point, size_type count);
+  static void futexWait(std::atomic<std::uint32_t>& word,
+                        std::uint32_t expected);
+  static void futexWake(std::atomic<std::uint32_t>& word, size_type count);
+};
+
+template <class T>
+using spsc_queue = mpmc_queue<T, false, false>;
+template <class T>
+using mpsc_queue = mpmc_queue<T, true, false>;
+
+}  // namespace s21
+
+#include "s21_mpmc_queue.tpp"
+
+#endif
@@ -0,0 +1,263 @@
+#include "s21_mpmc_queue.h"
+
+namespace s21 {
+
+template <class T, bool MP, bool MC>
+mpmc_queue<T, MP, MC>::mpmc_queue(size_type capacity) : mask_(1) {
+  if (capacity == 0) {
+    throw std::invalid_argument("mpmc_queue: capacity must be positive");
+  }
+  while (mask_ + 1 < capacity) mask_ = mask_ * 2 + 1;
+  cells_.reset(new Cell[mask_ + 1]);
+  for (size_type i = 0; i <= mask_; ++i) {
+    cells_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+  tail_.store(0, std::memory_order_relaxed);
+  head_.store(0, std::memory_order_relaxed);
+}
+
+template <class T, bool MP, bool MC>
+mpmc_queue<T, MP, MC>::~mpmc_queue() {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  for (size_type pos = head_.load(std::memory_order_relaxed); pos != tail;
+       ++pos) {
+    cells_[pos & mask_].value()->~T();
+  }
+}
+
+template <class T, bool MP, bool MC>
+bool mpmc_queue<T, MP, MC>::try_push(const_reference value) {
+  /* copy first: a claimed cell must be filled without throwing */
+  return try_push(value_type(value));
+}
+
+template <class T, bool MP, bool MC>
+bool mpmc_queue<T, MP, MC>::try_push(value_type&& value) {
+  Claim claim = claimPush(1);
+  if (!claim.count) return false;
+  new (cells_[claim.pos & mask_].storage) T(std::move(value));
+  publishPush(claim.pos);
+  notify(not_empty_, 1);
+  return true;
+}
+
+template <class T, bool MP, bool MC>
+template <class... Args>
+bool mpmc_queue<T, MP, MC>::try_emplace(Args&&... args) {
+  return try_push(value_type(std::forward<Args>(args)...));
+}
+
+template <class T, bool MP, bool MC>
+bool mpmc_queue<T, MP, MC>::try_pop(reference out) {
+  Claim claim = claimPop(1);
+  if (!claim.count) return false;
+  T* value = cells_[claim.pos & mask_].value();
+  out = std::move(*value);
+  value->~T();
+  publishPop(claim.pos);
+  notify(not_full_, 1);
+  return true;
+}
+
+template <class T, bool MP, bool MC>
+template <class InputIt>
+typename mpmc_queue<T, MP, MC>::size_type mpmc_queue<T, MP, MC>::push_bulk(
+    InputIt first, size_type count) {
+  static_assert(std::is_nothrow_constructible<T, decltype(*first)>::value,
+                "push_bulk fills claimed cells, use a move_iterator");
+  Claim claim = claimPush(count);
+  for (size_type i = 0; i < claim.count; ++i, ++first) {
+    new (cells_[(claim.pos + i) & mask_].storage) T(*first);
+    publishPush(claim.pos + i);
+  }
+  notify(not_empty_, claim.count);
+  return claim.count;
+}
+
+template <class T, bool MP, bool MC>
+template <class OutputIt>
+typename mpmc_queue<T, MP, MC>::size_type mpmc_queue<T, MP, MC>::pop_bulk(
+    OutputIt out, size_type count) {
+  Claim claim = claimPop(count);
+  for (size_type i = 0; i < claim.count; ++i, ++out) {
+    T* value = cells_[(claim.pos + i) & mask_].value();
+    *out = std::move(*value);
+    value->~T();
+    publishPop(claim.pos + i);
+  }
+  notify(not_full_, claim.count);
+  return claim.count;
+}
+
+template <class T, bool MP, bool MC>
+void mpmc_queue<T, MP, MC>::push(const_reference value) {
+  push(value_type(value));
+}
+
+template <class T, bool MP, bool MC>
+void mpmc_queue<T, MP, MC>::push(value_type&& value) {
+  waitFor(not_full_, [&] { return try_push(std::move(value)); });
+}
+
+template <class T, bool MP, bool MC>
+template <class... Args>
+void mpmc_queue<T, MP, MC>::emplace(Args&&... args) {
+  push(value_type(std::forward<Args>(args)...));
+}
+
+template <class T, bool MP, bool MC>
+void mpmc_queue<T, MP, MC>::pop(reference out) {
+  waitFor(not_empty_, [&] { return try_pop(out); });
+}
+
+template <class T, bool MP, bool MC>
+template <class... Args>
+void mpmc_queue<T, MP, MC>::insert_many_back(Args&&... args) {
+  (emplace(std::forward<Args>(args)), ...);
+}
+
+template <class T, bool MP, bool MC>
+typename mpmc_queue<T, MP, MC>::size_type mpmc_queue<T, MP, MC>::size()
+    const {
+  size_type head = head_.load(std::memory_order_acquire);
+  size_type tail = tail_.load(std::memory_order_acquire);
+  return tail > head ? tail - head : 0;
+}
+
+template <class T, bool MP, bool MC>
+bool mpmc_queue<T, MP, MC>::empty() const {
+  return size() == 0;
+}
+
+template <class T, bool MP, bool MC>
+typename mpmc_queue<T, MP, MC>::size_type mpmc_queue<T, MP, MC>::capacity()
+    const {
+  return mask_ + 1;
+}
+
+/* CLAIMS */
+template <class T, bool MP, bool MC>
+typename mpmc_queue<T, MP, MC>::Claim mpmc_queue<T, MP, MC>::claimPush(
+    size_type count) {
+  size_type pos = tail_.load(std::memory_order_relaxed);
+  while (count) {
+    /* a cell is free for position pos when its sequence equals pos */
+    size_type n = 0;
+    std::intptr_t diff = 0;
+    for (; n < count; ++n) {
+      size_type seq =
+          cells_[(pos + n) & mask_].sequence.load(std::memory_order_acquire);
+      diff = std::intptr_t(seq) - std::intptr_t(pos + n);
+      if (diff) break;
+    }
+    if (!n && diff < 0) break; /* full */
+    if (!n) {
+      pos = tail_.load(std::memory_order_relaxed); /* lost a race */
+    } else if (!MP) {
+      tail_.store(pos + n, std::memory_order_relaxed);
+      return {pos, n};
+    } else if (tail_.compare_exchange_weak(pos, pos + n,
+                                           std::memory_order_relaxed)) {
+      return {pos, n};
+    }
+  }
+  return {pos, 0};
+}
+
+template <class T, bool MP, bool MC>
+typename mpmc_queue<T, MP, MC>::Claim mpmc_queue<T, MP, MC>::claimPop(
+    size_type count) {
+  size_type pos = head_.load(std::memory_order_relaxed);
+  while (count) {
+    /* a cell holds the element for position pos at sequence pos + 1 */
+    size_type n = 0;
+    std::intptr_t diff = 0;
+    for (; n < count; ++n) {
+      size_type seq =
+          cells_[(pos + n) & mask_].sequence.load(std::memory_order_acquire);
+      diff = std::intptr_t(seq) - std::intptr_t(pos + n + 1);
+      if (diff) break;
+    }
+    if (!n && diff < 0) break; /* empty */
+    if (!n) {
+      pos = head_.load(std::memory_order_relaxed);
+    } else if (!MC) {
+      head_.store(pos + n, std::memory_order_relaxed);
+      return {pos, n};
+    } else if (head_.compare_exchange_weak(pos, pos + n,
+                                           std::memory_order_relaxed)) {
+      return {pos, n};
+    }
+  }
+  return {pos, 0};
+}
+
+template <class T, bool MP, bool MC>
+void mpmc_queue<T, MP, MC>::publishPush(size_type pos) {
+  cells_[pos & mask_].sequence.store(pos + 1, std::memory_order_release);
+}
+
+template <class T, bool MP, bool MC>
+void mpmc_queue<T, MP, MC>::publishPop(size_type pos) {
+  cells_[pos & mask_].sequence.store(pos + mask_ + 1,
+                                     std::memory_order_release);
+}
+
+/* WAITING */
+template <class T, bool MP, bool MC>
+template <class Try>
+void mpmc_queue<T, MP, MC>::waitFor(WaitPoint& point, Try try_once) {
+  for (int i = 0; i < kSpins; ++i) {
+    if (try_once()) return;
+    std::this_thread::yield();
+  }
+  while (true) {
+    point.waiters.fetch_add(1, std::memory_order_relaxed);
+    /* pairs with the fence in notify(): either we see its cell or it
+     * sees us waiting */
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::uint32_t epoch = point.epoch.load(std::memory_order_acquire);
+    bool done = try_once();
+    if (!done) futexWait(point.epoch, epoch);
+    point.waiters.fetch_sub(1, std::memory_order_relaxed);
+    if (done) return;
+  }
+}
+
+template <class T, bool MP, bool MC>
+void mpmc_queue<T, MP, MC>::notify(WaitPoint& point, size_type count) {
+  if (!count) return;
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (point.waiters.load(std::memory_order_relaxed)) {
+    point.epoch.fetch_add(1, std::memory_order_release);
+    futexWake(point.epoch, count);
+  }
+}
+
+template <class T, bool MP, bool MC>
+void mpmc_queue<T, MP, MC>::futexWait(std::atomic<std::uint32_t>& word,
+                                      std::uint32_t expected) {
+#if S21_QUEUE_FUTEX
+  syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word),
+          FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+#else
+  while (word.load(std::memory_order_acquire) == expected) {
+    std::this_thread::yield();
+  }
+#endif
+}
+
+template <class T, bool MP, bool MC>
+void mpmc_queue<T, MP, MC>::futexWake(std::atomic<std::uint32_t>& word,
+                                      size_type count) {
+#if S21_QUEUE_FUTEX
+  int n = count > size_type(INT32_MAX) ? INT32_MAX : int(count);
+  syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word),
+          FUTEX_WAKE_PRIVATE, n, nullptr, nullptr, 0);
+#else
+  (void)word;
+  (void)count;
+#endif
+}
+
+}  // namespace s21
@@ -1,10 +1,13 @@
 #ifndef S21_QUEUE_H
 #define S21_QUEUE_H
 
+#include "../deque/s21_deque.h"
 #include "../list/s21_list.h"
 
 namespace s21 {
-template <class T, class Container = list<T>>
+/* Container defaults to deque: pushes and pops reuse its blocks instead
+ * of allocating a node per element. list<T> still works. */
+template <class T, class Container = deque<T>>
 class queue {
  public:
   using value_type = T;
@@ -24,6 +27,9 @@ class queue {
   const_reference back();
 
   void push(const_reference value);
+  void push(value_type&& value);
+  template <class... Args>
+  void emplace(Args&&... args);
   void pop();
   void swap(queue& other);
   bool empty();
@@ -33,7 +39,7 @@ class queue {
   void insert_many_back(Args&&... args);
 
  private:
-  Container list_;
+  Container container_;
 };
 
 }  // namespace s21
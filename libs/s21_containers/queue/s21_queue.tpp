@@ -3,27 +3,27 @@
 namespace s21 {
 
 template <class T, class Container>
-queue<T, Container>::queue() : list_() {}
+queue<T, Container>::queue() : container_() {}
 
 template <class T, class Container>
 queue<T, Container>::queue(std::initializer_list<value_type> const& items)
-    : list_(items) {}
+    : container_(items) {}
 
 template <class T, class Container>
-queue<T, Container>::queue(const queue& q) : list_(q.list_) {}
+queue<T, Container>::queue(const queue& q) : container_(q.container_) {}
 
 template <class T, class Container>
-queue<T, Container>::queue(queue&& q) : list_(std::move(q.list_)) {}
+queue<T, Container>::queue(queue&& q) : container_(std::move(q.container_)) {}
 
 template <class T, class Container>
 queue<T, Container>& queue<T, Container>::operator=(const queue& q) {
-  list_ = q.list_;
+  container_ = q.container_;
   return *this;
 }
 
 template <class T, class Container>
 queue<T, Container>& queue<T, Container>::operator=(queue&& q) noexcept {
-  list_ = std::move(q.list_);
+  container_ = std::move(q.container_);
   return *this;
 }
 
@@ -32,45 +32,54 @@ queue<T, Container>::~queue() {}
 
 template <class T, class Container>
 typename queue<T, Container>::const_reference queue<T, Container>::front() {
-  return list_.front();
+  return container_.front();
 }
 
 template <class T, class Container>
 typename queue<T, Container>::const_reference queue<T, Container>::back() {
-  return list_.back();
+  return container_.back();
 }
 
 template <class T, class Container>
 void queue<T, Container>::push(const_reference value) {
-  list_.push_back(value);
+  container_.push_back(value);
+}
+
+template <class T, class Container>
+void queue<T, Container>::push(value_type&& value) {
+  container_.push_back(std::move(value));
+}
+
+template <class T, class Container>
+template <class... Args>
+void queue<T, Container>::emplace(Args&&... args) {
+  container_.emplace_back(std::forward<Args>(args)...);
 }
 
 template <class T, class Container>
 void queue<T, Container>::pop() {
-  list_.pop_front();
+  container_.pop_front();
 }
 
 template <class T, class Container>
 void queue<T, Container>::swap(queue& other) {
-  list_.swap(other.list_);
+  container_.swap(other.container_);
 }
 
 template <typename T, class Container>
 bool queue<T, Container>::empty() {
-  return list_.empty();
+  return container_.empty();
 }
 
 template <typename T, class Container>
 typename queue<T, Container>::size_type queue<T, Container>::size() {
-  return list_.size();
+  return container_.size();
 }
 
 template <class T, class Container>
 template <class... Args>
 void queue<T, Container>::insert_many_back(Args&&... args) {
-  for (const auto& arg : {args...}) {
-    list_.push_back(arg);
-  }
+  (container_.emplace_back(std::forward<Args>(args)), ...);
 }
 
 }  // namespace s21
\ No newline at end of file
@@ -6,32 +6,52 @@
 #include "../RBTree/s21_rbtree.h"
 
 namespace s21 {
-template <typename V>
-class set : public RBTree<V, V> {
+template <typename V, typename Allocator = std::allocator<V>>
+class set : public RBTree<V, V, SetKeyOfValue<V>, Allocator> {
+  using tree_type = RBTree<V, V, SetKeyOfValue<V>, Allocator>;
+
  public:
   using key_type = V;
   using value_type = V;
   using reference = value_type &;
   using const_reference = const value_type &;
-  using iterator = typename RBTree<V, V>::Iterator;
-  using const_iterator = typename RBTree<V, V>::ConstIterator;
+  using iterator = typename tree_type::Iterator;
+  using const_iterator = typename tree_type::ConstIterator;
   using size_type = size_t;
+  using allocator_type = Allocator;
 
-  set() : RBTree<V, V>() {}
+  set() : tree_type() {}
+  explicit set(const allocator_type &alloc) : tree_type(alloc) {}
   set(std::initializer_list<value_type> const &items);
-  set(const set &other) : RBTree<V, V>(other) {}
-  set(set &&other) noexcept : RBTree<V, V>(std::move(other)) {}
+  /* Linear-time build when [first, last) is sorted by key */
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+  set(InputIt first, InputIt last);
+  set(const set &other) : tree_type(other) {}
+  set(set &&other) noexcept : tree_type(std::move(other)) {}
   set &operator=(const set &other);
-  set &operator=(set &&other) noexcept;
+  set &operator=(set &&other) noexcept(
+      std::is_nothrow_move_assignable<tree_type>::value);
 
   ~set() = default;
 
   std::pair<iterator, bool> insert(const value_type &value);
-  iterator find(const key_type &key) { return RBTree<V, V>::find(key); };
+  std::pair<iterator, bool> insert(value_type &&value);
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args &&...args);
+  iterator find(const key_type &key) { return tree_type::find(key); };
+  template <class... Args>
+  iterator emplace_hint(iterator hint, Args &&...args);
   template <class... Args>
   std::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+  /* Move the elements >= key into the returned set, O(log n) */
+  set split(const key_type &key);
+
+ private:
+  explicit set(tree_type &&tree) : tree_type(std::move(tree)) {}
 };
 }  // namespace s21
 #include "s21_set.tpp"
 
-#endif
\ No newline at end of file
+#endif
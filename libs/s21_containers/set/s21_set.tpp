@@ -2,45 +2,74 @@
 
 namespace s21 {
 
-template <typename V>
-set<V>::set(std::initializer_list<value_type> const &items) {
-  for (auto it = items.begin(); it != items.end(); it++) {
-    RBTree<V, V>::insert(*it, *it);
-  }
+template <typename V, typename Allocator>
+set<V, Allocator>::set(std::initializer_list<value_type> const &items) {
+  tree_type::assign_sorted(items.begin(), items.end());
+}
+
+template <typename V, typename Allocator>
+template <typename InputIt, typename>
+set<V, Allocator>::set(InputIt first, InputIt last) {
+  tree_type::assign_sorted(first, last);
 }
 
-template <typename V>
-set<V> &set<V>::operator=(const set &other) {
+template <typename V, typename Allocator>
+set<V, Allocator> &set<V, Allocator>::operator=(const set &other) {
   if (this != &other) {
-    RBTree<V, V>::operator=(other);
+    tree_type::operator=(other);
   }
   return *this;
 }
 
-template <typename V>
-set<V> &set<V>::operator=(set &&other) noexcept {
+template <typename V, typename Allocator>
+set<V, Allocator> &set<V, Allocator>::operator=(set &&other) noexcept(
+    std::is_nothrow_move_assignable<tree_type>::value) {
   if (this != &other) {
-    RBTree<V, V>::operator=(std::move(other));
+    tree_type::operator=(std::move(other));
   }
   return *this;
 }
 
-template <typename V>
-std::pair<typename set<V>::iterator, bool> set<V>::insert(
+template <typename V, typename Allocator>
+std::pair<typename set<V, Allocator>::iterator, bool> set<V, Allocator>::insert(
     const value_type &value) {
-  auto res = RBTree<V, V>::insert(value, value);
+  auto res = tree_type::insert(value);
   return {iterator(res.first), res.second};
 }
 
-template <typename V>
+template <typename V, typename Allocator>
+std::pair<typename set<V, Allocator>::iterator, bool> set<V, Allocator>::insert(
+    value_type &&value) {
+  return tree_type::insert(std::move(value));
+}
+
+template <typename V, typename Allocator>
+template <class... Args>
+std::pair<typename set<V, Allocator>::iterator, bool>
+set<V, Allocator>::emplace(Args &&...args) {
+  return tree_type::emplace(std::forward<Args>(args)...);
+}
+
+template <typename V, typename Allocator>
+template <class... Args>
+typename set<V, Allocator>::iterator set<V, Allocator>::emplace_hint(
+    iterator hint, Args &&...args) {
+  return tree_type::emplace_hint(hint, std::forward<Args>(args)...);
+}
+
+template <typename V, typename Allocator>
 template <class... Args>
-std::vector<std::pair<typename set<V>::iterator, bool>> set<V>::insert_many(
-    Args &&...args) {
+std::vector<std::pair<typename set<V, Allocator>::iterator, bool>>
+set<V, Allocator>::insert_many(Args &&...args) {
   std::vector<std::pair<iterator, bool>> res;
-  for (const auto &arg : {args...}) {
-    res.push_back(RBTree<V, V>::insert(arg, arg));
-  }
+  res.reserve(sizeof...(args));
+  (res.push_back(emplace(std::forward<Args>(args))), ...);
   return res;
 }
 
-}  // namespace s21
\ No newline at end of file
+template <typename V, typename Allocator>
+set<V, Allocator> set<V, Allocator>::split(const key_type &key) {
+  return set(tree_type::split(key));
+}
+
+}  // namespace s21
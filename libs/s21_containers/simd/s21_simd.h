@@ -0,0 +1,70 @@
+#ifndef S21_SIMD_H_
+#define S21_SIMD_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define S21_SIMD_X86 1
+#else
+#define S21_SIMD_X86 0
+#endif
+
+namespace s21 {
+/* Bulk kernels over contiguous ranges. Arithmetic element types get SSE2,
+ * AVX2 and AVX-512 variants picked at runtime from the CPU features, other
+ * types (and other architectures) use the scalar loops. */
+namespace simd {
+
+enum class Isa { kScalar, kSse2, kAvx2, kAvx512 };
+
+/* Widest instruction set this CPU supports */
+inline Isa detected_isa() noexcept;
+/* Instruction set used by the kernels, detected_isa() unless overridden */
+inline Isa active_isa() noexcept;
+/* Override the kernels' instruction set (clamped to detected_isa()) and
+ * return the one in effect. Meant for tests and benchmarks; not
+ * thread-safe. */
+inline Isa set_isa(Isa isa) noexcept;
+
+/* Element types with a vector path: float, double and non-bool integers */
+template <typename T>
+struct is_vectorizable
+    : std::integral_constant<
+          bool, std::is_same<T, float>::value ||
+                    std::is_same<T, double>::value ||
+                    (std::is_integral<T>::value &&
+                     !std::is_same<T, bool>::value)> {};
+
+template <typename T>
+void fill(T *first, std::size_t n, const T &value);
+/* Index of the first element equal to value, n if there is none */
+template <typename T>
+std::size_t find(const T *first, std::size_t n, const T &value);
+template <typename T>
+std::size_t count(const T *first, std::size_t n, const T &value);
+/* Smallest / largest element, n must be positive. The result is
+ * unspecified if the range holds a NaN. */
+template <typename T>
+T min(const T *first, std::size_t n);
+template <typename T>
+T max(const T *first, std::size_t n);
+/* Integer sums wrap around like unsigned arithmetic; floating point sums
+ * are reassociated by the vector paths, so the last bits may differ from
+ * a left-to-right loop */
+template <typename T>
+T sum(const T *first, std::size_t n);
+template <typename T>
+T dot(const T *a, const T *b, std::size_t n);
+/* Lexicographic three-way compare with operator<: -1, 0 or 1 */
+template <typename T>
+int compare(const T *a, std::size_t n, const T *b, std::size_t m);
+
+}  // namespace simd
+}  // namespace s21
+
+#include "s21_simd.tpp"
+
+#endif  // S21_SIMD_H_
@@ -0,0 +1,449 @@
+#include "s21_simd.h"
+
+namespace s21 {
+namespace simd {
+namespace detail {
+
+template <std::size_t Size, bool Signed>
+struct SizedInt;
+template <>
+struct SizedInt<1, true> {
+  using type = std::int8_t;
+};
+template <>
+struct SizedInt<1, false> {
+  using type = std::uint8_t;
+};
+template <>
+struct SizedInt<2, true> {
+  using type = std::int16_t;
+};
+template <>
+struct SizedInt<2, false> {
+  using type = std::uint16_t;
+};
+template <>
+struct SizedInt<4, true> {
+  using type = std::int32_t;
+};
+template <>
+struct SizedInt<4, false> {
+  using type = std::uint32_t;
+};
+template <>
+struct SizedInt<8, true> {
+  using type = std::int64_t;
+};
+template <>
+struct SizedInt<8, false> {
+  using type = std::uint64_t;
+};
+
+/* Vector lane type: same size and signedness as T */
+template <typename T, bool = std::is_floating_point<T>::value>
+struct Lane {
+  using type = T;
+};
+template <typename T>
+struct Lane<T, false> {
+  using type = typename SizedInt<sizeof(T), std::is_signed<T>::value>::type;
+};
+
+/* Accumulator of sum/dot: integers wrap around in the unsigned lane type */
+template <typename T, bool = is_vectorizable<T>::value &&
+                             std::is_integral<T>::value>
+struct Acc {
+  using type = T;
+};
+template <typename T>
+struct Acc<T, true> {
+  using type = typename SizedInt<sizeof(T), false>::type;
+};
+
+/* x * y without the promotion to int, which could overflow for uint16_t */
+template <typename A>
+A multiply(const A &x, const A &y) {
+  using P = std::conditional_t<std::is_integral<A>::value &&
+                                   (sizeof(A) < sizeof(unsigned)),
+                               unsigned, A>;
+  return A(P(x) * P(y));
+}
+
+inline Isa &activeIsa() noexcept {
+  static Isa isa = detected_isa();
+  return isa;
+}
+
+#if S21_SIMD_X86
+#define S21_SIMD_INLINE __attribute__((always_inline)) inline
+
+template <typename L, std::size_t Bytes>
+struct Vector {
+  typedef L type __attribute__((vector_size(Bytes)));
+};
+
+template <typename Mask>
+S21_SIMD_INLINE bool anyLane(const Mask &mask) {
+  std::uint64_t words[sizeof(Mask) / 8];
+  std::memcpy(words, &mask, sizeof(Mask));
+  std::uint64_t bits = 0;
+  for (std::uint64_t word : words) bits |= word;
+  return bits != 0;
+}
+#endif
+
+/* Each kernel has a scalar loop for any T and, for vectorizable T, a
+ * vector loop over Bytes-wide registers that leaves the tail to the
+ * scalar one */
+struct Fill {
+  template <typename T>
+  static void scalar(T *first, std::size_t n, const T &value) {
+    for (std::size_t i = 0; i < n; ++i) first[i] = value;
+  }
+
+#if S21_SIMD_X86
+  template <typename T, std::size_t Bytes>
+  static S21_SIMD_INLINE void vector(T *first, std::size_t n, T value) {
+    using L = typename Lane<T>::type;
+    using V = typename Vector<L, Bytes>::type;
+    const V fill = V{} + static_cast<L>(value);
+    std::size_t i = 0;
+    for (; n - i >= Bytes / sizeof(T); i += Bytes / sizeof(T)) {
+      std::memcpy(first + i, &fill, Bytes);
+    }
+    scalar(first + i, n - i, value);
+  }
+#endif
+};
+
+struct Find {
+  template <typename T>
+  static std::size_t scalar(const T *first, std::size_t n, const T &value) {
+    std::size_t i = 0;
+    while (i < n && !(first[i] == value)) ++i;
+    return i;
+  }
+
+#if S21_SIMD_X86
+  template <typename T, std::size_t Bytes>
+  static S21_SIMD_INLINE std::size_t vector(const T *first, std::size_t n,
+                                            T value) {
+    using L = typename Lane<T>::type;
+    using V = typename Vector<L, Bytes>::type;
+    const V needle = V{} + static_cast<L>(value);
+    std::size_t i = 0;
+    for (; n - i >= Bytes / sizeof(T); i += Bytes / sizeof(T)) {
+      V x;
+      std::memcpy(&x, first + i, Bytes);
+      if (anyLane(x == needle)) break;
+    }
+    return i + scalar(first + i, n - i, value);
+  }
+#endif
+};
+
+struct Count {
+  template <typename T>
+  static std::size_t scalar(const T *first, std::size_t n, const T &value) {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; ++i) count += first[i] == value;
+    return count;
+  }
+
+#if S21_SIMD_X86
+  template <typename T, std::size_t Bytes>
+  static S21_SIMD_INLINE std::size_t vector(const T *first, std::size_t n,
+                                            T value) {
+    using L = typename Lane<T>::type;
+    using U = typename SizedInt<sizeof(T), false>::type;
+    using V = typename Vector<L, Bytes>::type;
+    using C = typename Vector<U, Bytes>::type;
+    constexpr std::size_t kLanes = Bytes / sizeof(T);
+    /* Blocks a lane counter can take before it has to be flushed */
+    constexpr std::size_t kFlush =
+        sizeof(T) > 2 ? std::size_t(-1) : std::size_t(U(-1));
+    const V needle = V{} + static_cast<L>(value);
+    std::size_t count = 0, i = 0;
+    while (n - i >= kLanes) {
+      std::size_t blocks = (n - i) / kLanes;
+      if (blocks > kFlush) blocks = kFlush;
+      C lanes = C{};
+      for (; blocks; --blocks, i += kLanes) {
+        V x;
+        std::memcpy(&x, first + i, Bytes);
+        lanes -= (C)(x == needle); /* a match is all ones, i.e. -1 */
+      }
+      for (std::size_t k = 0; k < kLanes; ++k) count += lanes[k];
+    }
+    return count + scalar(first + i, n - i, value);
+  }
+#endif
+};
+
+template <bool Max>
+struct Extremum {
+  template <typename T>
+  static T scalar(const T *first, std::size_t n) {
+    T best = first[0];
+    for (std::size_t i = 1; i < n; ++i) {
+      if (Max ? best < first[i] : first[i] < best) best = first[i];
+    }
+    return best;
+  }
+
+#if S21_SIMD_X86
+  template <typename T, std::size_t Bytes>
+  static S21_SIMD_INLINE T vector(const T *first, std::size_t n) {
+    using L = typename Lane<T>::type;
+    using V = typename Vector<L, Bytes>::type;
+    constexpr std::size_t kLanes = Bytes / sizeof(T);
+    if (n < kLanes) return scalar(first, n);
+    V best;
+    std::memcpy(&best, first, Bytes);
+    std::size_t i = kLanes;
+    for (; n - i >= kLanes; i += kLanes) {
+      V x;
+      std::memcpy(&x, first + i, Bytes);
+      best = (Max ? best < x : x < best) ? x : best;
+    }
+    T result = static_cast<T>(best[0]);
+    for (std::size_t k = 1; k < kLanes; ++k) {
+      T lane = static_cast<T>(best[k]);
+      if (Max ? result < lane : lane < result) result = lane;
+    }
+    if (i < n) {
+      T tail = scalar(first + i, n - i);
+      if (Max ? result < tail : tail < result) result = tail;
+    }
+    return result;
+  }
+#endif
+};
+
+struct Sum {
+  template <typename T>
+  static T scalar(const T *first, std::size_t n) {
+    using A = typename Acc<T>::type;
+    A total = A();
+    for (std::size_t i = 0; i < n; ++i) total = A(total + A(first[i]));
+    return T(total);
+  }
+
+#if S21_SIMD_X86
+  /* Four independent accumulators hide the latency of the adds */
+  template <typename T, std::size_t Bytes>
+  static S21_SIMD_INLINE T vector(const T *first, std::size_t n) {
+    using A = typename Acc<T>::type;
+    using V = typename Vector<A, Bytes>::type;
+    constexpr std::size_t kLanes = Bytes / sizeof(T);
+    V s0 = V{}, s1 = V{}, s2 = V{}, s3 = V{};
+    std::size_t i = 0;
+    for (; n - i >= 4 * kLanes; i += 4 * kLanes) {
+      V x0, x1, x2, x3;
+      std::memcpy(&x0, first + i, Bytes);
+      std::memcpy(&x1, first + i + kLanes, Bytes);
+      std::memcpy(&x2, first + i + 2 * kLanes, Bytes);
+      std::memcpy(&x3, first + i + 3 * kLanes, Bytes);
+      s0 += x0;
+      s1 += x1;
+      s2 += x2;
+      s3 += x3;
+    }
+    for (; n - i >= kLanes; i += kLanes) {
+      V x;
+      std::memcpy(&x, first + i, Bytes);
+      s0 += x;
+    }
+    s0 = (s0 + s1) + (s2 + s3);
+    A total = A();
+    for (std::size_t k = 0; k < kLanes; ++k) total = A(total + s0[k]);
+    return T(A(total + A(scalar(first + i, n - i))));
+  }
+#endif
+};
+
+struct Dot {
+  template <typename T>
+  static T scalar(const T *a, const T *b, std::size_t n) {
+    using A = typename Acc<T>::type;
+    A total = A();
+    for (std::size_t i = 0; i < n; ++i) {
+      total = A(total + multiply(A(a[i]), A(b[i])));
+    }
+    return T(total);
+  }
+
+#if S21_SIMD_X86
+  template <typename T, std::size_t Bytes>
+  static S21_SIMD_INLINE T vector(const T *a, const T *b, std::size_t n) {
+    using A = typename Acc<T>::type;
+    using V = typename Vector<A, Bytes>::type;
+    constexpr std::size_t kLanes = Bytes / sizeof(T);
+    V s0 = V{}, s1 = V{}, s2 = V{}, s3 = V{};
+    std::size_t i = 0;
+    for (; n - i >= 4 * kLanes; i += 4 * kLanes) {
+      V x0, x1, x2, x3, y0, y1, y2, y3;
+      std::memcpy(&x0, a + i, Bytes);
+      std::memcpy(&x1, a + i + kLanes, Bytes);
+      std::memcpy(&x2, a + i + 2 * kLanes, Bytes);
+      std::memcpy(&x3, a + i + 3 * kLanes, Bytes);
+      std::memcpy(&y0, b + i, Bytes);
+      std::memcpy(&y1, b + i + kLanes, Bytes);
+      std::memcpy(&y2, b + i + 2 * kLanes, Bytes);
+      std::memcpy(&y3, b + i + 3 * kLanes, Bytes);
+      s0 += x0 * y0;
+      s1 += x1 * y1;
+      s2 += x2 * y2;
+      s3 += x3 * y3;
+    }
+    for (; n - i >= kLanes; i += kLanes) {
+      V x, y;
+      std::memcpy(&x, a + i, Bytes);
+      std::memcpy(&y, b + i, Bytes);
+      s0 += x * y;
+    }
+    s0 = (s0 + s1) + (s2 + s3);
+    A total = A();
+    for (std::size_t k = 0; k < kLanes; ++k) total = A(total + s0[k]);
+    return T(A(total + A(scalar(a + i, b + i, n - i))));
+  }
+#endif
+};
+
+struct Compare {
+  template <typename T>
+  static int scalar(const T *a, std::size_t n, const T *b, std::size_t m) {
+    for (std::size_t i = 0; i < n && i < m; ++i) {
+      if (a[i] < b[i]) return -1;
+      if (b[i] < a[i]) return 1;
+    }
+    return n < m ? -1 : (m < n ? 1 : 0);
+  }
+
+#if S21_SIMD_X86
+  /* Skip the equal prefix a register at a time, the scalar loop decides */
+  template <typename T, std::size_t Bytes>
+  static S21_SIMD_INLINE int vector(const T *a, std::size_t n, const T *b,
+                                    std::size_t m) {
+    using L = typename Lane<T>::type;
+    using V = typename Vector<L, Bytes>::type;
+    const std::size_t common = n < m ? n : m;
+    std::size_t i = 0;
+    for (; common - i >= Bytes / sizeof(T); i += Bytes / sizeof(T)) {
+      V x, y;
+      std::memcpy(&x, a + i, Bytes);
+      std::memcpy(&y, b + i, Bytes);
+      if (anyLane(x != y)) break;
+    }
+    return scalar(a + i, n - i, b + i, m - i);
+  }
+#endif
+};
+
+#if S21_SIMD_X86
+template <typename Op, typename T, typename... Args>
+__attribute__((target("sse2"))) auto runSse2(Args... args) {
+  return Op::template vector<T, 16>(args...);
+}
+
+template <typename Op, typename T, typename... Args>
+__attribute__((target("avx2"))) auto runAvx2(Args... args) {
+  return Op::template vector<T, 32>(args...);
+}
+
+template <typename Op, typename T, typename... Args>
+__attribute__((target("avx512f,avx512bw"))) auto runAvx512(Args... args) {
+  return Op::template vector<T, 64>(args...);
+}
+#endif
+
+/* Scalar arguments are passed by value so each variant gets its own copy */
+template <typename Op, typename T, typename... Args>
+auto dispatch(Args... args) {
+#if S21_SIMD_X86
+  if constexpr (is_vectorizable<T>::value) {
+    switch (activeIsa()) {
+      case Isa::kAvx512:
+        return runAvx512<Op, T>(args...);
+      case Isa::kAvx2:
+        return runAvx2<Op, T>(args...);
+      case Isa::kSse2:
+        return runSse2<Op, T>(args...);
+      case Isa::kScalar:
+        break;
+    }
+  }
+#endif
+  return Op::template scalar<T>(args...);
+}
+
+}  // namespace detail
+
+inline Isa detected_isa() noexcept {
+#if S21_SIMD_X86
+  static const Isa isa = [] {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") &&
+        __builtin_cpu_supports("avx512bw")) {
+      return Isa::kAvx512;
+    }
+    if (__builtin_cpu_supports("avx2")) return Isa::kAvx2;
+    if (__builtin_cpu_supports("sse2")) return Isa::kSse2;
+    return Isa::kScalar;
+  }();
+  return isa;
+#else
+  return Isa::kScalar;
+#endif
+}
+
+inline Isa active_isa() noexcept { return detail::activeIsa(); }
+
+inline Isa set_isa(Isa isa) noexcept {
+  Isa best = detected_isa();
+  detail::activeIsa() = isa < best ? isa : best;
+  return detail::activeIsa();
+}
+
+template <typename T>
+void fill(T *first, std::size_t n, const T &value) {
+  detail::dispatch<detail::Fill, T>(first, n, value);
+}
+
+template <typename T>
+std::size_t find(const T *first, std::size_t n, const T &value) {
+  return detail::dispatch<detail::Find, T>(first, n, value);
+}
+
+template <typename T>
+std::size_t count(const T *first, std::size_t n, const T &value) {
+  return detail::dispatch<detail::Count, T>(first, n, value);
+}
+
+template <typename T>
+T min(const T *first, std::size_t n) {
+  return detail::dispatch<detail::Extremum<false>, T>(first, n);
+}
+
+template <typename T>
+T max(const T *first, std::size_t n) {
+  return detail::dispatch<detail::Extremum<true>, T>(first, n);
+}
+
+template <typename T>
+T sum(const T *first, std::size_t n) {
+  return detail::dispatch<detail::Sum, T>(first, n);
+}
+
+template <typename T>
+T dot(const T *a, const T *b, std::size_t n) {
+  return detail::dispatch<detail::Dot, T>(a, b, n);
+}
+
+template <typename T>
+int compare(const T *a, std::size_t n, const T *b, std::size_t m) {
+  return detail::dispatch<detail::Compare, T>(a, n, b, m);
+}
+
+}  // namespace simd
+}  // namespace s21
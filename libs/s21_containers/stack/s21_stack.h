@@ -1,45 +1,69 @@
 #ifndef S21_STACK_H_
 #define S21_STACK_H_
 
-#include <iostream>
-#include <limits>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_stack_buffer.h"
+
 namespace s21 {
-template <typename T>
+/* LIFO adapter over Container, like queue. Container needs back(),
+ * push_back(), emplace_back(), pop_back(), size(), empty(), clear() and
+ * swap(); s21::vector, s21::list and s21::deque all fit. reserve() is
+ * passed through when Container has it.
+ *
+ * The default stack_buffer keeps no spare elements constructed; use
+ * small_stack<T, N> to keep the first N elements inside the object. */
+template <typename T, typename Container = stack_buffer<T>>
 class stack {
  public:
+  using container_type = Container;
   using value_type = T;
   using reference = T&;
   using const_reference = const T&;
   using size_type = std::size_t;
 
-  stack();
+  stack() = default;
   stack(std::initializer_list<value_type> const& items);
-  stack(const stack& other);
-  stack(stack&& other);
-  stack& operator=(const stack& other);
-  stack& operator=(stack&& other);
-  ~stack();
+  explicit stack(const Container& container) : container_(container) {}
+  explicit stack(Container&& container) : container_(std::move(container)) {}
+  stack(const stack& other) = default;
+  stack(stack&& other) = default;
+  stack& operator=(const stack& other) = default;
+  stack& operator=(stack&& other) = default;
+  ~stack() = default;
 
   const_reference top();
   void push(const_reference value);
+  void push(value_type&& value);
+  template <typename... Args>
+  void emplace(Args&&... args);
+  /* Push every element of range in order, the last one ends on top; the
+   * elements of an rvalue range are moved */
+  template <typename Range>
+  void push_range(Range&& range);
   void pop();
   void swap(stack& other);
 
   bool empty();
   size_type size();
   void clear();
+  /* No-op when Container has no reserve() */
+  void reserve(size_type capacity);
 
   template <typename... Args>
   void insert_many_front(Args&&... args);
 
  private:
-  T* data_;
-  size_type count_;
-  size_type size_;
-  void resize();
+  Container container_;
 };
+
+template <typename T, std::size_t N>
+using small_stack = stack<T, stack_buffer<T, N>>;
 }  // namespace s21
 
 #include "s21_stack.tpp"
 
-#endif
\ No newline at end of file
+#endif
@@ -2,129 +2,98 @@
 
 namespace s21 {
 
-template <typename T>
-stack<T>::stack() : data_(nullptr), count_(0), size_(0) {}
-
-template <typename T>
-stack<T>::stack(std::initializer_list<T> const& items)
-    : data_(nullptr), count_(0), size_(0) {
-  for (auto it = items.begin(); it != items.end(); it++) {
-    push(*it);
-  }
-}
-
-template <typename T>
-stack<T>::stack(const stack& other)
-    : data_(new value_type[other.size_]),
-      count_(other.count_),
-      size_(other.size_) {
-  std::copy(other.data_, other.data_ + size_, data_);
-}
-
-template <typename T>
-stack<T>::stack(stack&& other)
-    : data_(other.data_), count_(other.count_), size_(other.size_) {
-  other.data_ = nullptr;
-  other.count_ = 0;
+namespace stack_detail {
+template <typename Container, typename = void>
+struct has_reserve : std::false_type {};
+
+template <typename Container>
+struct has_reserve<
+    Container, std::void_t<decltype(std::declval<Container&>().reserve(0))>>
+    : std::true_type {};
+}  // namespace stack_detail
+
+template <typename T, typename Container>
+stack<T, Container>::stack(std::initializer_list<T> const& items) {
+  reserve(items.size());
+  for (const_reference item : items) container_.push_back(item);
 }
 
-template <typename T>
-stack<T>& stack<T>::operator=(const stack& other) {
-  if (this != &other) {
-    delete[] data_;
-    size_ = other.size_;
-    count_ = other.count_;
-    data_ = new value_type[size_];
-    std::copy(other.data_, other.data_ + size_, data_);
+template <typename T, typename Container>
+typename stack<T, Container>::const_reference stack<T, Container>::top() {
+  if (empty()) {
+    throw std::out_of_range("stack::top(): Stack is empty");
   }
-
-  return *this;
+  return container_.back();
 }
 
-template <typename T>
-stack<T>& stack<T>::operator=(stack&& other) {
-  if (this != &other) {
-    delete[] data_;
-    size_ = other.size_;
-    count_ = other.count_;
-    data_ = other.data_;
-    other.data_ = nullptr;
-    other.count_ = 0;
-  }
-
-  return *this;
+template <typename T, typename Container>
+void stack<T, Container>::push(const_reference value) {
+  container_.push_back(value);
 }
 
-template <typename T>
-stack<T>::~stack() {
-  delete[] data_;
-  data_ = nullptr;
+template <typename T, typename Container>
+void stack<T, Container>::push(value_type&& value) {
+  container_.push_back(std::move(value));
 }
 
-template <typename T>
-typename stack<T>::const_reference stack<T>::top() {
-  if (empty()) {
-    throw std::out_of_range("stack::top(): Stack is empty");
-  }
-  return data_[count_ - 1];
+template <typename T, typename Container>
+template <typename... Args>
+void stack<T, Container>::emplace(Args&&... args) {
+  container_.emplace_back(std::forward<Args>(args)...);
 }
 
-template <typename T>
-void stack<T>::push(const_reference value) {
-  if (count_ == size_) {
-    resize();
+template <typename T, typename Container>
+template <typename Range>
+void stack<T, Container>::push_range(Range&& range) {
+  for (auto&& value : range) {
+    if constexpr (std::is_lvalue_reference<Range>::value) {
+      container_.emplace_back(value);
+    } else {
+      container_.emplace_back(std::move(value));
+    }
   }
-  data_[count_++] = value;
 }
 
-template <typename T>
-void stack<T>::pop() {
-  if (!count_) {
+template <typename T, typename Container>
+void stack<T, Container>::pop() {
+  if (empty()) {
     throw std::out_of_range("stack::pop(): Stack is empty");
   }
-  count_--;
+  container_.pop_back();
 }
 
-template <typename T>
-void stack<T>::swap(stack& other) {
-  std::swap(size_, other.size_);
-  std::swap(count_, other.count_);
-  std::swap(data_, other.data_);
+template <typename T, typename Container>
+void stack<T, Container>::swap(stack& other) {
+  container_.swap(other.container_);
 }
 
-template <typename T>
-void stack<T>::resize() {
-  if (!size_) size_ = 1;
-  T* tmp = new T[size_ * 2];
-  std::copy(data_, data_ + count_, tmp);
-  delete[] data_;
-  data_ = tmp;
-  size_ *= 2;
+template <typename T, typename Container>
+void stack<T, Container>::clear() {
+  container_.clear();
 }
 
-template <typename T>
-void stack<T>::clear() {
-  for (size_type i = 0; i < count_; ++i) {
-    data_[i].~T();
+template <typename T, typename Container>
+void stack<T, Container>::reserve(size_type capacity) {
+  if constexpr (stack_detail::has_reserve<Container>::value) {
+    container_.reserve(capacity);
+  } else {
+    (void)capacity;
   }
-  count_ = 0;
 }
 
-template <typename T>
-bool stack<T>::empty() {
-  return (count_ == 0);
+template <typename T, typename Container>
+bool stack<T, Container>::empty() {
+  return container_.empty();
 }
 
-template <typename T>
-typename stack<T>::size_type stack<T>::size() {
-  return count_;
+template <typename T, typename Container>
+typename stack<T, Container>::size_type stack<T, Container>::size() {
+  return container_.size();
 }
 
-template <typename T>
+template <typename T, typename Container>
 template <class... Args>
-void stack<T>::insert_many_front(Args&&... args) {
-  for (const auto& arg : {args...}) {
-    push(arg);
-  }
+void stack<T, Container>::insert_many_front(Args&&... args) {
+  (emplace(std::forward<Args>(args)), ...);
 }
-}  // namespace s21
\ No newline at end of file
+}  // namespace s21
@@ -0,0 +1,104 @@
+#ifndef S21_STACK_BUFFER_H_
+#define S21_STACK_BUFFER_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+/* Room for N elements inside the object; nothing at all for N = 0 */
+template <typename T, std::size_t N>
+struct stack_inline_storage {
+  alignas(T) unsigned char bytes[N * sizeof(T)];
+
+  T* inlineData() { return std::launder(reinterpret_cast<T*>(bytes)); }
+};
+
+template <typename T>
+struct stack_inline_storage<T, 0> {
+  T* inlineData() { return nullptr; }
+};
+
+/* Growable array for the back of a stack. The first N elements live
+ * inside the object, so a stack that never gets deeper than N does not
+ * allocate; beyond that the elements move to the heap and the capacity
+ * doubles. Slots past size() are raw memory, elements are relocated by
+ * move (by copy if the move may throw and T is copyable). */
+template <typename T, std::size_t N = 0>
+class stack_buffer : private stack_inline_storage<T, N> {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using pointer = T*;
+  using const_pointer = const T*;
+  using size_type = std::size_t;
+
+  static constexpr size_type inline_capacity = N;
+
+  stack_buffer() noexcept;
+  stack_buffer(const stack_buffer& other);
+  stack_buffer(stack_buffer&& other) noexcept(
+      std::is_nothrow_move_constructible<T>::value);
+  stack_buffer& operator=(const stack_buffer& other);
+  stack_buffer& operator=(stack_buffer&& other) noexcept(
+      std::is_nothrow_move_constructible<T>::value);
+  ~stack_buffer();
+
+  /* Unchecked, the buffer must not be empty */
+  reference back() { return data_[size_ - 1]; }
+  const_reference back() const { return data_[size_ - 1]; }
+  pointer data() noexcept { return data_; }
+  const_pointer data() const noexcept { return data_; }
+  pointer begin() noexcept { return data_; }
+  pointer end() noexcept { return data_ + size_; }
+  const_pointer begin() const noexcept { return data_; }
+  const_pointer end() const noexcept { return data_ + size_; }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept { return capacity_; }
+  size_type max_size() const noexcept;
+  /* True while the elements are stored inside the object */
+  bool is_inline() const noexcept { return capacity_ == N; }
+  void reserve(size_type capacity);
+
+  void push_back(const_reference value);
+  void push_back(value_type&& value);
+  /* args may refer to an element of the buffer */
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
+  /* Unchecked, the buffer must not be empty */
+  void pop_back();
+  /* Destroys the elements and keeps the capacity */
+  void clear() noexcept;
+  void swap(stack_buffer& other);
+
+ private:
+  pointer data_;
+  size_type size_;
+  size_type capacity_;
+
+  static pointer allocate(size_type n);
+  static void deallocate(pointer ptr, size_type n);
+  /* Construct [first, last) at dest by move (or copy), the source is left
+   * for the caller to destroy */
+  static void transfer(pointer first, pointer last, pointer dest);
+  size_type grownCapacity(size_type needed) const;
+  /* Take other's heap block, or move its inline elements; other is left
+   * empty and inline. Our elements must already be destroyed. */
+  void takeFrom(stack_buffer& other);
+  void releaseHeap() noexcept;
+};
+
+}  // namespace s21
+
+#include "s21_stack_buffer.tpp"
+
+#endif  // S21_STACK_BUFFER_H_
@@ -0,0 +1,204 @@
+#include "s21_stack_buffer.h"
+
+namespace s21 {
+
+template <typename T, std::size_t N>
+stack_buffer<T, N>::stack_buffer() noexcept
+    : data_(this->inlineData()), size_(0), capacity_(N) {}
+
+template <typename T, std::size_t N>
+stack_buffer<T, N>::stack_buffer(const stack_buffer& other) : stack_buffer() {
+  reserve(other.size_);
+  std::uninitialized_copy(other.begin(), other.end(), data_);
+  size_ = other.size_;
+}
+
+template <typename T, std::size_t N>
+stack_buffer<T, N>::stack_buffer(stack_buffer&& other) noexcept(
+    std::is_nothrow_move_constructible<T>::value)
+    : stack_buffer() {
+  takeFrom(other);
+}
+
+template <typename T, std::size_t N>
+stack_buffer<T, N>& stack_buffer<T, N>::operator=(const stack_buffer& other) {
+  if (this != &other) {
+    stack_buffer tmp(other);
+    clear();
+    takeFrom(tmp);
+  }
+  return *this;
+}
+
+template <typename T, std::size_t N>
+stack_buffer<T, N>& stack_buffer<T, N>::operator=(
+    stack_buffer&& other) noexcept(
+    std::is_nothrow_move_constructible<T>::value) {
+  if (this != &other) {
+    clear();
+    takeFrom(other);
+  }
+  return *this;
+}
+
+template <typename T, std::size_t N>
+stack_buffer<T, N>::~stack_buffer() {
+  clear();
+  releaseHeap();
+}
+
+template <typename T, std::size_t N>
+typename stack_buffer<T, N>::size_type stack_buffer<T, N>::max_size()
+    const noexcept {
+  return std::numeric_limits<std::ptrdiff_t>::max() / sizeof(T);
+}
+
+template <typename T, std::size_t N>
+void stack_buffer<T, N>::reserve(size_type capacity) {
+  if (capacity <= capacity_) return;
+  if (capacity > max_size()) {
+    throw std::length_error("stack_buffer::reserve(): too large");
+  }
+  pointer block = allocate(capacity);
+  try {
+    transfer(begin(), end(), block);
+  } catch (...) {
+    deallocate(block, capacity);
+    throw;
+  }
+  std::destroy(begin(), end());
+  releaseHeap();
+  data_ = block;
+  capacity_ = capacity;
+}
+
+template <typename T, std::size_t N>
+void stack_buffer<T, N>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, std::size_t N>
+void stack_buffer<T, N>::push_back(value_type&& value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T, std::size_t N>
+template <typename... Args>
+typename stack_buffer<T, N>::reference stack_buffer<T, N>::emplace_back(
+    Args&&... args) {
+  if (size_ < capacity_) {
+    ::new (static_cast<void*>(data_ + size_))
+        value_type(std::forward<Args>(args)...);
+    return data_[size_++];
+  }
+
+  /* build the new element before the old ones move: args may name one */
+  size_type capacity = grownCapacity(size_ + 1);
+  pointer block = allocate(capacity);
+  try {
+    ::new (static_cast<void*>(block + size_))
+        value_type(std::forward<Args>(args)...);
+  } catch (...) {
+    deallocate(block, capacity);
+    throw;
+  }
+  try {
+    transfer(begin(), end(), block);
+  } catch (...) {
+    block[size_].~T();
+    deallocate(block, capacity);
+    throw;
+  }
+  std::destroy(begin(), end());
+  releaseHeap();
+  data_ = block;
+  capacity_ = capacity;
+  return data_[size_++];
+}
+
+template <typename T, std::size_t N>
+void stack_buffer<T, N>::pop_back() {
+  data_[--size_].~T();
+}
+
+template <typename T, std::size_t N>
+void stack_buffer<T, N>::clear() noexcept {
+  std::destroy(begin(), end());
+  size_ = 0;
+}
+
+template <typename T, std::size_t N>
+void stack_buffer<T, N>::swap(stack_buffer& other) {
+  if (this == &other) return;
+  if (!is_inline() && !other.is_inline()) {
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+    return;
+  }
+  stack_buffer tmp(std::move(other));
+  other.takeFrom(*this);
+  takeFrom(tmp);
+}
+
+template <typename T, std::size_t N>
+typename stack_buffer<T, N>::pointer stack_buffer<T, N>::allocate(
+    size_type n) {
+  return std::allocator<value_type>().allocate(n);
+}
+
+template <typename T, std::size_t N>
+void stack_buffer<T, N>::deallocate(pointer ptr, size_type n) {
+  std::allocator<value_type>().deallocate(ptr, n);
+}
+
+template <typename T, std::size_t N>
+void stack_buffer<T, N>::transfer(pointer first, pointer last, pointer dest) {
+  if constexpr (std::is_trivially_copyable<value_type>::value) {
+    if (first != last) std::memcpy(dest, first, (last - first) * sizeof(T));
+  } else if constexpr (std::is_nothrow_move_constructible<value_type>::value ||
+                       !std::is_copy_constructible<value_type>::value) {
+    std::uninitialized_move(first, last, dest);
+  } else {
+    std::uninitialized_copy(first, last, dest);
+  }
+}
+
+template <typename T, std::size_t N>
+typename stack_buffer<T, N>::size_type stack_buffer<T, N>::grownCapacity(
+    size_type needed) const {
+  if (needed > max_size()) {
+    throw std::length_error("stack_buffer: too many elements");
+  }
+  size_type grown = capacity_ > max_size() / 2 ? max_size() : capacity_ * 2;
+  return std::max<size_type>({needed, grown, 4});
+}
+
+template <typename T, std::size_t N>
+void stack_buffer<T, N>::takeFrom(stack_buffer& other) {
+  if (!other.is_inline()) {
+    releaseHeap();
+    data_ = other.data_;
+    size_ = other.size_;
+    capacity_ = other.capacity_;
+    other.data_ = other.inlineData();
+    other.capacity_ = N;
+  } else {
+    /* at most N elements, they fit in whatever storage we have */
+    transfer(other.begin(), other.end(), data_);
+    size_ = other.size_;
+    std::destroy(other.begin(), other.end());
+  }
+  other.size_ = 0;
+}
+
+template <typename T, std::size_t N>
+void stack_buffer<T, N>::releaseHeap() noexcept {
+  if (!is_inline()) {
+    deallocate(data_, capacity_);
+    data_ = this->inlineData();
+    capacity_ = N;
+  }
+}
+
+}  // namespace s21
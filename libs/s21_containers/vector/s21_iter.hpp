@@ -38,19 +38,9 @@ class vector<T>::vectorIter {
 
   bool operator!=(const vectorIter& other) const { return _ptr != other._ptr; }
 
-  vectorIter operator+(int n) const {
-    vectorIter tmp(*this);
-    for (int i = 0; i < n; i++) tmp++;
-
-    return tmp;
-  }
+  vectorIter operator+(ptrdiff_t n) const { return vectorIter(_ptr + n); }
 
-  vectorIter operator-(int n) const {
-    vectorIter tmp(*this);
-    for (int i = 0; i < n; i++) tmp--;
-
-    return tmp;
-  }
+  vectorIter operator-(ptrdiff_t n) const { return vectorIter(_ptr - n); }
 
   ptrdiff_t operator-(const vectorIter& other) const {
     return _ptr - other._ptr;
@@ -98,18 +88,12 @@ class vector<T>::vectorConstIter : public vectorIter {
     return _ptr != other._ptr;
   }
 
-  vectorConstIter operator+(int n) const {
-    vectorConstIter tmp(*this);
-    for (int i = 0; i < n; i++) tmp++;
-
-    return tmp;
+  vectorConstIter operator+(ptrdiff_t n) const {
+    return vectorConstIter(_ptr + n);
   }
 
-  vectorConstIter operator-(int n) const {
-    vectorConstIter tmp(*this);
-    for (int i = 0; i < n; i++) tmp--;
-
-    return tmp;
+  vectorConstIter operator-(ptrdiff_t n) const {
+    return vectorConstIter(_ptr - n);
   }
 
   ptrdiff_t operator-(const vectorConstIter& other) const {
@@ -2,10 +2,30 @@
 #define S21_VECTOR_H
 
 #include <cstddef>
+#include <cstring>
 #include <initializer_list>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../simd/s21_simd.h"
 
 namespace s21 {
+/* Pure input iterators such as std::istream_iterator can be walked only
+ * once; iterators without iterator_traits, the containers' own ones
+ * included, are taken to be multi-pass */
+template <typename It, typename = void>
+struct is_single_pass : std::false_type {};
+template <typename It>
+struct is_single_pass<
+    It, std::void_t<typename std::iterator_traits<It>::iterator_category>>
+    : std::bool_constant<!std::is_base_of<
+          std::forward_iterator_tag,
+          typename std::iterator_traits<It>::iterator_category>::value> {};
+
 template <typename T>
 class vector {
  public:
@@ -25,10 +45,11 @@ class vector {
   vector(size_type n);
   vector(std::initializer_list<T> const& items);
   vector(const vector& v);
-  vector(vector&& v);
+  vector(vector&& v) noexcept;
   ~vector();
 
-  vector& operator=(vector<T>&& v);
+  vector& operator=(const vector& v);
+  vector& operator=(vector<T>&& v) noexcept;
   reference operator[](size_type pos);
   const_reference operator[](size_type pos) const;
 
@@ -36,6 +57,7 @@ class vector {
   const_reference front() const;
   const_reference back() const;
   iterator_pointer data() noexcept;
+  const_iterator_pointer data() const noexcept;
 
   iterator begin();
   iterator end();
@@ -45,26 +67,85 @@ class vector {
   bool empty() const;
   size_type size() const;
   size_type max_size() const;
-  size_type capacity();
+  size_type capacity() const;
   void reserve(size_type size);
   void shrink_to_fit();
 
   void push_back(const_reference value);
+  void push_back(value_type&& value);
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
   void pop_back();
-  void erase(iterator pos);
+  iterator erase(iterator pos);
+  iterator erase(iterator first, iterator last);
   iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, value_type&& value);
+  iterator insert(iterator pos, size_type count, const_reference value);
+  iterator insert(iterator pos, std::initializer_list<T> items);
+  /* The range must not point into this vector */
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+  iterator insert(iterator pos, InputIt first, InputIt last);
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args&&... args);
+  void assign(size_type count, const_reference value);
+  void assign(std::initializer_list<T> items);
+  /* A range inside this vector is copied out before the old elements go */
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+  void assign(InputIt first, InputIt last);
+  template <typename Range>
+  void append_range(Range&& range);
   void clear();
   void swap(vector& other);
 
+  /* Arguments are built in place and must not refer into this vector */
   template <typename... Args>
   iterator insert_many(const_iterator pos, Args&&... args);
   template <typename... Args>
   void insert_many_back(Args&&... args);
 
+  /* Bulk scans, vectorized for arithmetic T (see s21_simd.h) */
+  void fill(const_reference value);
+  iterator find(const_reference value);
+  const_iterator find(const_reference value) const;
+  size_type count(const_reference value) const;
+  value_type min() const;
+  value_type max() const;
+  value_type sum() const;
+  value_type dot(const vector& other) const;
+  int compare(const vector& other) const;
+
  private:
   size_type _size;
   size_type _capacity;
   iterator_pointer _obj;
+
+  /* Raw storage: elements in [_size, _capacity) are never constructed */
+  static iterator_pointer allocate(size_type n);
+  static void deallocate(iterator_pointer ptr, size_type n);
+  /* Move-construct [first, last) into dest (copy if the move may throw),
+   * the source is left for the caller to destroy */
+  static void transfer(iterator_pointer first, iterator_pointer last,
+                       iterator_pointer dest);
+  template <typename InputIt>
+  static size_type distance(InputIt first, InputIt last);
+  template <typename InputIt>
+  static void constructRange(InputIt first, size_type count,
+                             iterator_pointer dest);
+  bool owns(const_iterator_pointer ptr) const;
+  void reallocate(size_type new_capacity);
+  size_type grownCapacity(size_type needed) const;
+
+  /* Bulk primitives: fill(dest) constructs count elements in raw memory
+   * at dest and destroys what it built if it throws. The tail is moved
+   * once and the buffer grows at most once per call. */
+  void openGap(size_type idx, size_type count);
+  void closeGap(size_type idx, size_type count);
+  template <typename Fill>
+  void insertWith(size_type idx, size_type count, Fill fill);
+  template <typename Fill>
+  void assignWith(size_type count, Fill fill);
 };
 }  // namespace s21
 
@@ -6,44 +6,68 @@
 namespace s21 {
 template <typename T>
 vector<T>::vector(size_type n)
-    : _size(n), _capacity(n), _obj(new value_type[n]) {
-  for (size_type i = 0; i < _size; i++) _obj[i] = value_type();
+    : _size(n), _capacity(n), _obj(allocate(n)) {
+  try {
+    std::uninitialized_value_construct(_obj, _obj + n);
+  } catch (...) {
+    deallocate(_obj, n);
+    throw;
+  }
 }
 
 template <typename T>
 vector<T>::vector(std::initializer_list<T> const& items)
     : _size(items.size()),
       _capacity(items.size()),
-      _obj(new value_type[items.size()]) {
-  std::copy(items.begin(), items.end(), _obj);
+      _obj(allocate(items.size())) {
+  try {
+    std::uninitialized_copy(items.begin(), items.end(), _obj);
+  } catch (...) {
+    deallocate(_obj, _capacity);
+    throw;
+  }
 }
 
 template <typename T>
 vector<T>::vector(const vector& v)
-    : _size(v._size), _capacity(v._capacity), _obj(new T[v._size]) {
-  for (size_type i = 0; i < _size; i++) _obj[i] = v._obj[i];
+    : _size(v._size), _capacity(v._size), _obj(allocate(v._size)) {
+  try {
+    std::uninitialized_copy(v._obj, v._obj + v._size, _obj);
+  } catch (...) {
+    deallocate(_obj, _capacity);
+    throw;
+  }
 }
 
 template <typename T>
-vector<T>::vector(vector&& v)
+vector<T>::vector(vector&& v) noexcept
     : _size(v._size), _capacity(v._capacity), _obj(v._obj) {
+  v._size = 0;
+  v._capacity = 0;
   v._obj = nullptr;
 }
 
 template <typename T>
 vector<T>::~vector() {
-  delete[] _obj;
+  clear();
+  deallocate(_obj, _capacity);
 }
 
 template <typename T>
-vector<T>& vector<T>::operator=(vector<T>&& v) {
+vector<T>& vector<T>::operator=(const vector& v) {
   if (this != &v) {
-    swap(v);
+    vector tmp(v);
+    swap(tmp);
+  }
+
+  return *this;
+}
 
-    delete[] v._obj;
-    v._size = 0;
-    v._capacity = 0;
-    v._obj = nullptr;
+template <typename T>
+vector<T>& vector<T>::operator=(vector<T>&& v) noexcept {
+  if (this != &v) {
+    vector tmp(std::move(v));
+    swap(tmp);
   }
 
   return *this;
@@ -89,6 +113,11 @@ typename vector<T>::iterator_pointer vector<T>::data() noexcept {
   return _obj;
 }
 
+template <typename T>
+typename vector<T>::const_iterator_pointer vector<T>::data() const noexcept {
+  return _obj;
+}
+
 template <typename T>
 typename vector<T>::iterator vector<T>::begin() {
   return iterator(_obj);
@@ -126,78 +155,239 @@ typename vector<T>::size_type vector<T>::max_size() const {
 }
 
 template <typename T>
-typename vector<T>::size_type vector<T>::capacity() {
+typename vector<T>::size_type vector<T>::capacity() const {
   return _capacity;
 }
 
 template <typename T>
 void vector<T>::reserve(size_type size) {
-  if (size < _capacity) return;
+  if (size <= _capacity) return;
 
   if (size > max_size())
     throw std::out_of_range("Too large size for a new capacity");
 
-  iterator_pointer tmp = new T[size];
-  std::copy(_obj, _obj + _size, tmp);
-  delete[] _obj;
-  _obj = tmp;
-  _capacity = size;
+  reallocate(size);
 }
 
 template <typename T>
 void vector<T>::shrink_to_fit() {
   if (_size == _capacity) return;
 
-  iterator_pointer tmp = new value_type[_size];
-  std::copy(_obj, _obj + _size, tmp);
-  delete[] _obj;
-  _obj = tmp;
-  _capacity = _size;
+  reallocate(_size);
 }
 
 template <typename T>
 void vector<T>::push_back(const_reference value) {
-  if (_size == _capacity) reserve(_capacity ? _capacity * 2 : 1);
+  emplace_back(value);
+}
 
-  _obj[_size++] = value;
+template <typename T>
+void vector<T>::push_back(value_type&& value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T>
+template <typename... Args>
+typename vector<T>::reference vector<T>::emplace_back(Args&&... args) {
+  if (_size < _capacity) {
+    ::new (static_cast<void*>(_obj + _size))
+        value_type(std::forward<Args>(args)...);
+    return _obj[_size++];
+  }
+
+  /* a full buffer always reallocates, the old elements stay valid for args */
+  insertWith(_size, 1, [&](iterator_pointer dest) {
+    ::new (static_cast<void*>(dest)) value_type(std::forward<Args>(args)...);
+  });
+  return _obj[_size - 1];
 }
 
 template <typename T>
 void vector<T>::pop_back() {
-  if (_size > 0) _size--;
+  if (_size > 0) std::destroy_at(_obj + --_size);
 }
 
 template <typename T>
-void vector<T>::erase(iterator pos) {
-  if ((size_type)(pos - _obj) > _size)
+typename vector<T>::iterator vector<T>::erase(iterator pos) {
+  if ((size_type)(pos - begin()) >= _size)
     throw std::out_of_range("Index out of range");
 
-  for (iterator it = pos; it != end() - 1; it++) *it = *(it + 1);
+  return erase(pos, pos + 1);
+}
+
+template <typename T>
+typename vector<T>::iterator vector<T>::erase(iterator first, iterator last) {
+  size_type idx = first - begin();
+  size_type count = last - first;
 
-  _size--;
+  if (idx > _size || count > _size - idx)
+    throw std::out_of_range("Index out of range");
+  if (!count) return first;
+
+  size_type tail = _size - idx - count;
+  if constexpr (std::is_trivially_copyable<value_type>::value) {
+    std::memmove(_obj + idx, _obj + idx + count, tail * sizeof(T));
+  } else {
+    std::move(_obj + idx + count, _obj + _size, _obj + idx);
+  }
+  std::destroy(_obj + _size - count, _obj + _size);
+  _size -= count;
+
+  return iterator(_obj + idx);
 }
 
 template <typename T>
 typename vector<T>::iterator vector<T>::insert(iterator pos,
                                                const_reference value) {
+  return emplace(const_iterator(_obj + (pos - begin())), value);
+}
+
+template <typename T>
+typename vector<T>::iterator vector<T>::insert(iterator pos,
+                                               value_type&& value) {
+  return emplace(const_iterator(_obj + (pos - begin())), std::move(value));
+}
+
+template <typename T>
+typename vector<T>::iterator vector<T>::insert(iterator pos, size_type count,
+                                               const_reference value) {
   size_type idx = pos - begin();
 
   if (idx > _size) throw std::out_of_range("Position is out of range");
 
-  if (_size == _capacity) reserve(_capacity ? _capacity * 2 : 1);
+  auto fill = [&](const_reference src) {
+    insertWith(idx, count, [&](iterator_pointer dest) {
+      std::uninitialized_fill_n(dest, count, src);
+    });
+  };
+  /* opening the gap would move value from under us */
+  if (owns(&value)) {
+    fill(value_type(value));
+  } else {
+    fill(value);
+  }
+
+  return iterator(_obj + idx);
+}
+
+template <typename T>
+typename vector<T>::iterator vector<T>::insert(iterator pos,
+                                               std::initializer_list<T> items) {
+  return insert(pos, items.begin(), items.end());
+}
+
+template <typename T>
+template <typename InputIt, typename>
+typename vector<T>::iterator vector<T>::insert(iterator pos, InputIt first,
+                                               InputIt last) {
+  size_type idx = pos - begin();
 
-  iterator new_pos = begin() + idx;
+  if (idx > _size) throw std::out_of_range("Position is out of range");
+
+  if constexpr (is_single_pass<InputIt>::value) {
+    /* the size is unknown until the range is read, so read it aside */
+    vector items;
+    for (; first != last; ++first) items.emplace_back(*first);
+    return insert(pos, std::make_move_iterator(items._obj),
+                  std::make_move_iterator(items._obj + items._size));
+  } else {
+    size_type count = distance(first, last);
+    insertWith(idx, count, [&](iterator_pointer dest) {
+      constructRange(first, count, dest);
+    });
+    return iterator(_obj + idx);
+  }
+}
+
+template <typename T>
+template <typename... Args>
+typename vector<T>::iterator vector<T>::emplace(const_iterator pos,
+                                                Args&&... args) {
+  size_type idx = pos - cbegin();
 
-  for (iterator it = end(); it != new_pos; --it) *it = *(it - 1);
+  if (idx > _size) throw std::out_of_range("Position is out of range");
 
-  *new_pos = value;
-  _size++;
+  if (idx == _size || _size == _capacity) {
+    insertWith(idx, 1, [&](iterator_pointer dest) {
+      ::new (static_cast<void*>(dest)) value_type(std::forward<Args>(args)...);
+    });
+  } else {
+    /* build first: args may refer to an element that is about to move */
+    value_type value(std::forward<Args>(args)...);
+    insertWith(idx, 1, [&](iterator_pointer dest) {
+      ::new (static_cast<void*>(dest)) value_type(std::move(value));
+    });
+  }
 
-  return new_pos;
+  return iterator(_obj + idx);
+}
+
+template <typename T>
+void vector<T>::assign(size_type count, const_reference value) {
+  if (owns(&value)) {
+    value_type copy(value);
+    assign(count, copy);
+    return;
+  }
+
+  assignWith(count, [&](iterator_pointer dest) {
+    std::uninitialized_fill_n(dest, count, value);
+  });
+}
+
+template <typename T>
+void vector<T>::assign(std::initializer_list<T> items) {
+  assign(items.begin(), items.end());
+}
+
+template <typename T>
+template <typename InputIt, typename>
+void vector<T>::assign(InputIt first, InputIt last) {
+  if constexpr (is_single_pass<InputIt>::value) {
+    clear();
+    for (; first != last; ++first) emplace_back(*first);
+  } else {
+    using ref = decltype(*first);
+    if constexpr (std::is_lvalue_reference<ref>::value &&
+                  std::is_same<std::remove_cv_t<std::remove_reference_t<ref>>,
+                               value_type>::value) {
+      /* assignWith() destroys the elements before reading the range */
+      if (first != last && owns(std::addressof(*first))) {
+        vector items;
+        items.assign(first, last);
+        swap(items);
+        return;
+      }
+    }
+    size_type count = distance(first, last);
+    assignWith(count, [&](iterator_pointer dest) {
+      constructRange(first, count, dest);
+    });
+  }
+}
+
+template <typename T>
+template <typename Range>
+void vector<T>::append_range(Range&& range) {
+  using std::begin;
+  using std::end;
+
+  auto first = begin(range);
+  if constexpr (is_single_pass<decltype(first)>::value) {
+    for (auto last = end(range); first != last; ++first) {
+      emplace_back(*first);
+    }
+  } else {
+    size_type count = distance(first, end(range));
+    insertWith(_size, count, [&](iterator_pointer dest) {
+      constructRange(first, count, dest);
+    });
+  }
 }
 
 template <typename T>
 void vector<T>::clear() {
+  std::destroy(_obj, _obj + _size);
   _size = 0;
 }
 
@@ -212,20 +402,261 @@ template <typename T>
 template <typename... Args>
 typename vector<T>::iterator vector<T>::insert_many(const_iterator pos,
                                                     Args&&... args) {
-  vector<value_type> tmp{args...};
-  iterator current = begin() + (pos - cbegin());
+  size_type idx = pos - cbegin();
 
-  for (size_type i = 0; i < tmp.size(); i++) {
-    current = insert(current, tmp[i]);
-    ++current;
-  }
+  if (idx > _size) throw std::out_of_range("Position is out of range");
 
-  return current;
+  insertWith(idx, sizeof...(args), [&](iterator_pointer dest) {
+    size_type built = 0;
+    try {
+      ((::new (static_cast<void*>(dest + built))
+            value_type(std::forward<Args>(args)),
+        ++built),
+       ...);
+    } catch (...) {
+      std::destroy(dest, dest + built);
+      throw;
+    }
+  });
+
+  return iterator(_obj + idx + sizeof...(args));
 }
 
 template <typename T>
 template <typename... Args>
 void vector<T>::insert_many_back(Args&&... args) {
-  insert_many(cend(), args...);
+  insert_many(cend(), std::forward<Args>(args)...);
+}
+
+template <typename T>
+void vector<T>::fill(const_reference value) {
+  simd::fill(_obj, _size, value);
+}
+
+template <typename T>
+typename vector<T>::iterator vector<T>::find(const_reference value) {
+  return iterator(_obj + simd::find(_obj, _size, value));
+}
+
+template <typename T>
+typename vector<T>::const_iterator vector<T>::find(
+    const_reference value) const {
+  return const_iterator(_obj + simd::find(_obj, _size, value));
+}
+
+template <typename T>
+typename vector<T>::size_type vector<T>::count(const_reference value) const {
+  return simd::count(_obj, _size, value);
+}
+
+template <typename T>
+typename vector<T>::value_type vector<T>::min() const {
+  if (_size == 0) throw std::out_of_range("Vector is empty");
+  return simd::min(_obj, _size);
+}
+
+template <typename T>
+typename vector<T>::value_type vector<T>::max() const {
+  if (_size == 0) throw std::out_of_range("Vector is empty");
+  return simd::max(_obj, _size);
+}
+
+template <typename T>
+typename vector<T>::value_type vector<T>::sum() const {
+  return simd::sum(_obj, _size);
+}
+
+template <typename T>
+typename vector<T>::value_type vector<T>::dot(const vector& other) const {
+  if (_size != other._size) {
+    throw std::invalid_argument("Vectors have different sizes");
+  }
+  return simd::dot(_obj, other._obj, _size);
+}
+
+template <typename T>
+int vector<T>::compare(const vector& other) const {
+  return simd::compare(_obj, _size, other._obj, other._size);
+}
+
+template <typename T>
+typename vector<T>::iterator_pointer vector<T>::allocate(size_type n) {
+  return n ? std::allocator<value_type>().allocate(n) : nullptr;
+}
+
+template <typename T>
+void vector<T>::deallocate(iterator_pointer ptr, size_type n) {
+  if (ptr) std::allocator<value_type>().deallocate(ptr, n);
+}
+
+template <typename T>
+void vector<T>::transfer(iterator_pointer first, iterator_pointer last,
+                         iterator_pointer dest) {
+  if constexpr (std::is_trivially_copyable<value_type>::value) {
+    if (first != last) std::memcpy(dest, first, (last - first) * sizeof(T));
+  } else if constexpr (std::is_nothrow_move_constructible<value_type>::value ||
+                       !std::is_copy_constructible<value_type>::value) {
+    std::uninitialized_move(first, last, dest);
+  } else {
+    std::uninitialized_copy(first, last, dest);
+  }
+}
+
+template <typename T>
+template <typename InputIt>
+typename vector<T>::size_type vector<T>::distance(InputIt first,
+                                                  InputIt last) {
+  size_type count = 0;
+  for (; first != last; ++first) ++count;
+  return count;
+}
+
+template <typename T>
+template <typename InputIt>
+void vector<T>::constructRange(InputIt first, size_type count,
+                               iterator_pointer dest) {
+  size_type built = 0;
+  try {
+    for (; built < count; ++built, ++first) {
+      ::new (static_cast<void*>(dest + built)) value_type(*first);
+    }
+  } catch (...) {
+    std::destroy(dest, dest + built);
+    throw;
+  }
+}
+
+template <typename T>
+bool vector<T>::owns(const_iterator_pointer ptr) const {
+  return std::less_equal<const_iterator_pointer>()(_obj, ptr) &&
+         std::less<const_iterator_pointer>()(ptr, _obj + _size);
+}
+
+template <typename T>
+void vector<T>::reallocate(size_type new_capacity) {
+  iterator_pointer tmp = allocate(new_capacity);
+  try {
+    transfer(_obj, _obj + _size, tmp);
+  } catch (...) {
+    deallocate(tmp, new_capacity);
+    throw;
+  }
+  std::destroy(_obj, _obj + _size);
+  deallocate(_obj, _capacity);
+  _obj = tmp;
+  _capacity = new_capacity;
+}
+
+template <typename T>
+typename vector<T>::size_type vector<T>::grownCapacity(
+    size_type needed) const {
+  if (needed > max_size())
+    throw std::out_of_range("Too large size for a new capacity");
+
+  size_type capacity = _capacity ? _capacity : 1;
+  while (capacity < needed) capacity *= 2;
+  return capacity;
+}
+
+template <typename T>
+void vector<T>::openGap(size_type idx, size_type count) {
+  if constexpr (std::is_trivially_copyable<value_type>::value) {
+    std::memmove(_obj + idx + count, _obj + idx, (_size - idx) * sizeof(T));
+  } else {
+    for (size_type i = _size; i-- > idx;) {
+      ::new (static_cast<void*>(_obj + i + count))
+          value_type(std::move(_obj[i]));
+      std::destroy_at(_obj + i);
+    }
+  }
+}
+
+template <typename T>
+void vector<T>::closeGap(size_type idx, size_type count) {
+  if constexpr (std::is_trivially_copyable<value_type>::value) {
+    std::memmove(_obj + idx, _obj + idx + count, (_size - idx) * sizeof(T));
+  } else {
+    for (size_type i = idx; i < _size; ++i) {
+      ::new (static_cast<void*>(_obj + i))
+          value_type(std::move(_obj[i + count]));
+      std::destroy_at(_obj + i + count);
+    }
+  }
+}
+
+template <typename T>
+template <typename Fill>
+void vector<T>::insertWith(size_type idx, size_type count, Fill fill) {
+  if (!count) return;
+
+  /* in place when there is no tail to move or moving it cannot throw
+   * halfway */
+  constexpr bool nothrow_relocate =
+      std::is_trivially_copyable<value_type>::value ||
+      std::is_nothrow_move_constructible<value_type>::value;
+
+  if ((nothrow_relocate || idx == _size) && count <= _capacity - _size) {
+    openGap(idx, count);
+    try {
+      fill(_obj + idx);
+    } catch (...) {
+      closeGap(idx, count);
+      throw;
+    }
+    _size += count;
+    return;
+  }
+
+  size_type new_capacity = grownCapacity(_size + count);
+  iterator_pointer tmp = allocate(new_capacity);
+  bool filled = false;
+
+  try {
+    /* fill first: the source may live in the old buffer */
+    fill(tmp + idx);
+    filled = true;
+    transfer(_obj, _obj + idx, tmp);
+    try {
+      transfer(_obj + idx, _obj + _size, tmp + idx + count);
+    } catch (...) {
+      std::destroy(tmp, tmp + idx);
+      throw;
+    }
+  } catch (...) {
+    if (filled) std::destroy(tmp + idx, tmp + idx + count);
+    deallocate(tmp, new_capacity);
+    throw;
+  }
+
+  std::destroy(_obj, _obj + _size);
+  deallocate(_obj, _capacity);
+  _obj = tmp;
+  _capacity = new_capacity;
+  _size += count;
+}
+
+template <typename T>
+template <typename Fill>
+void vector<T>::assignWith(size_type count, Fill fill) {
+  if (count > _capacity) {
+    if (count > max_size())
+      throw std::out_of_range("Too large size for a new capacity");
+
+    iterator_pointer tmp = allocate(count);
+    try {
+      fill(tmp);
+    } catch (...) {
+      deallocate(tmp, count);
+      throw;
+    }
+    clear();
+    deallocate(_obj, _capacity);
+    _obj = tmp;
+    _capacity = count;
+  } else {
+    clear();
+    fill(_obj);
+  }
+  _size = count;
 }
-}  // namespace s21
\ No newline at end of file
+}  // namespace s21
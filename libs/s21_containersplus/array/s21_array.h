@@ -3,6 +3,9 @@
 
 #include <iostream>
 #include <limits>
+#include <stdexcept>
+
+#include "../../s21_containers/simd/s21_simd.h"
 
 namespace s21 {
 template <typename T, std::size_t N>
@@ -43,6 +46,16 @@ class array {
   void swap(array &other);
   void fill(const_reference val);
 
+  /* Bulk scans, vectorized for arithmetic T (see s21_simd.h) */
+  iterator find(const_reference val);
+  const_iterator find(const_reference val) const;
+  size_type count(const_reference val) const;
+  value_type min() const;
+  value_type max() const;
+  value_type sum() const;
+  value_type dot(const array &other) const;
+  int compare(const array &other) const;
+
  private:
   value_type data_[N] = {};
   size_type size_ = N;
@@ -120,7 +120,52 @@ void array<T, N>::swap(array &other) {
 
 template <typename T, std::size_t N>
 void array<T, N>::fill(const_reference val) {
-  std::fill(data(), data() + N, val);
+  simd::fill(data(), N, val);
+}
+
+/* BULK SCANS */
+
+template <typename T, std::size_t N>
+typename array<T, N>::iterator array<T, N>::find(const_reference val) {
+  return data() + simd::find(cdata(), N, val);
+}
+
+template <typename T, std::size_t N>
+typename array<T, N>::const_iterator array<T, N>::find(
+    const_reference val) const {
+  return cdata() + simd::find(cdata(), N, val);
+}
+
+template <typename T, std::size_t N>
+typename array<T, N>::size_type array<T, N>::count(const_reference val) const {
+  return simd::count(cdata(), N, val);
+}
+
+template <typename T, std::size_t N>
+typename array<T, N>::value_type array<T, N>::min() const {
+  if (N == 0) throw std::out_of_range("array::min(): array is empty");
+  return simd::min(cdata(), N);
+}
+
+template <typename T, std::size_t N>
+typename array<T, N>::value_type array<T, N>::max() const {
+  if (N == 0) throw std::out_of_range("array::max(): array is empty");
+  return simd::max(cdata(), N);
+}
+
+template <typename T, std::size_t N>
+typename array<T, N>::value_type array<T, N>::sum() const {
+  return simd::sum(cdata(), N);
+}
+
+template <typename T, std::size_t N>
+typename array<T, N>::value_type array<T, N>::dot(const array &other) const {
+  return simd::dot(cdata(), other.cdata(), N);
+}
+
+template <typename T, std::size_t N>
+int array<T, N>::compare(const array &other) const {
+  return simd::compare(cdata(), N, other.cdata(), N);
 }
 
 }  // namespace s21
\ No newline at end of file
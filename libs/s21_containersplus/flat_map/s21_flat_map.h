@@ -0,0 +1,59 @@
+#ifndef S21_FLAT_MAP_H_
+#define S21_FLAT_MAP_H_
+
+#include <tuple>
+
+#include "../flat_tree/s21_flat_tree.h"
+
+namespace s21 {
+/* map on a sorted s21::vector. Elements are std::pair<K, T> so they can be
+ * moved around inside the buffer; changing a key through an iterator
+ * breaks the ordering. */
+template <typename K, typename T>
+class flat_map
+    : public FlatTree<K, std::pair<K, T>, FlatMapKeyOfValue<K, T>> {
+  using tree_type = FlatTree<K, std::pair<K, T>, FlatMapKeyOfValue<K, T>>;
+
+ public:
+  using key_type = K;
+  using mapped_type = T;
+  using value_type = std::pair<key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using size_type = size_t;
+
+  flat_map() : tree_type() {}
+  flat_map(std::initializer_list<value_type> const &items)
+      : tree_type(items) {}
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+  flat_map(InputIt first, InputIt last) : tree_type(first, last) {}
+  flat_map(const flat_map &other) : tree_type(other) {}
+  flat_map(flat_map &&other) noexcept : tree_type(std::move(other)) {}
+  flat_map &operator=(const flat_map &other);
+  flat_map &operator=(flat_map &&other) noexcept;
+
+  ~flat_map() = default;
+
+  T &at(const K &key);
+  const T &at(const K &key) const;
+  T &operator[](const K &key);
+  T &operator[](K &&key);
+
+  using tree_type::insert;
+  std::pair<iterator, bool> insert(const K &key, const T &obj);
+  std::pair<iterator, bool> insert(const K &key, T &&obj);
+  std::pair<iterator, bool> insert_or_assign(const K &key, const T &obj);
+  std::pair<iterator, bool> insert_or_assign(const K &key, T &&obj);
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(const K &key, Args &&...args);
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(K &&key, Args &&...args);
+};
+}  // namespace s21
+
+#include "s21_flat_map.tpp"
+
+#endif  // S21_FLAT_MAP_H_
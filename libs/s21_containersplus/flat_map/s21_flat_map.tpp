@@ -0,0 +1,94 @@
+#include "s21_flat_map.h"
+
+namespace s21 {
+template <typename K, typename T>
+flat_map<K, T> &flat_map<K, T>::operator=(const flat_map &other) {
+  if (this != &other) {
+    tree_type::operator=(other);
+  }
+  return *this;
+}
+
+template <typename K, typename T>
+flat_map<K, T> &flat_map<K, T>::operator=(flat_map &&other) noexcept {
+  if (this != &other) {
+    tree_type::operator=(std::move(other));
+  }
+  return *this;
+}
+
+template <typename K, typename T>
+T &flat_map<K, T>::at(const K &key) {
+  auto it = tree_type::find(key);
+  if (it == tree_type::end()) {
+    throw std::out_of_range("flat_map<K, T>::at(): key not found");
+  }
+  return it->second;
+}
+
+template <typename K, typename T>
+const T &flat_map<K, T>::at(const K &key) const {
+  auto it = tree_type::find(key);
+  if (it == tree_type::cend()) {
+    throw std::out_of_range("flat_map<K, T>::at(): key not found");
+  }
+  return it->second;
+}
+
+template <typename K, typename T>
+T &flat_map<K, T>::operator[](const K &key) {
+  return try_emplace(key).first->second;
+}
+
+template <typename K, typename T>
+T &flat_map<K, T>::operator[](K &&key) {
+  return try_emplace(std::move(key)).first->second;
+}
+
+template <typename K, typename T>
+std::pair<typename flat_map<K, T>::iterator, bool> flat_map<K, T>::insert(
+    const K &key, const T &obj) {
+  return try_emplace(key, obj);
+}
+
+template <typename K, typename T>
+std::pair<typename flat_map<K, T>::iterator, bool> flat_map<K, T>::insert(
+    const K &key, T &&obj) {
+  return try_emplace(key, std::move(obj));
+}
+
+template <typename K, typename T>
+std::pair<typename flat_map<K, T>::iterator, bool>
+flat_map<K, T>::insert_or_assign(const K &key, const T &obj) {
+  auto res = try_emplace(key, obj);
+  if (!res.second) res.first->second = obj;
+  return res;
+}
+
+template <typename K, typename T>
+std::pair<typename flat_map<K, T>::iterator, bool>
+flat_map<K, T>::insert_or_assign(const K &key, T &&obj) {
+  auto res = try_emplace(key, std::move(obj));
+  if (!res.second) res.first->second = std::move(obj);
+  return res;
+}
+
+template <typename K, typename T>
+template <class... Args>
+std::pair<typename flat_map<K, T>::iterator, bool>
+flat_map<K, T>::try_emplace(const K &key, Args &&...args) {
+  return tree_type::try_emplace(
+      key, std::piecewise_construct, std::forward_as_tuple(key),
+      std::forward_as_tuple(std::forward<Args>(args)...));
+}
+
+template <typename K, typename T>
+template <class... Args>
+std::pair<typename flat_map<K, T>::iterator, bool>
+flat_map<K, T>::try_emplace(K &&key, Args &&...args) {
+  /* key is only moved into the element after the search has finished */
+  return tree_type::try_emplace(
+      key, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+      std::forward_as_tuple(std::forward<Args>(args)...));
+}
+}  // namespace s21
@@ -0,0 +1,38 @@
+#ifndef S21_FLAT_SET_H_
+#define S21_FLAT_SET_H_
+
+#include "../flat_tree/s21_flat_tree.h"
+
+namespace s21 {
+/* set on a sorted s21::vector, iterators are read-only */
+template <typename V>
+class flat_set : public FlatTree<V, V, FlatSetKeyOfValue<V>, const V> {
+  using tree_type = FlatTree<V, V, FlatSetKeyOfValue<V>, const V>;
+
+ public:
+  using key_type = V;
+  using value_type = V;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using size_type = size_t;
+
+  flat_set() : tree_type() {}
+  flat_set(std::initializer_list<value_type> const &items)
+      : tree_type(items) {}
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+  flat_set(InputIt first, InputIt last) : tree_type(first, last) {}
+  flat_set(const flat_set &other) : tree_type(other) {}
+  flat_set(flat_set &&other) noexcept : tree_type(std::move(other)) {}
+  flat_set &operator=(const flat_set &other);
+  flat_set &operator=(flat_set &&other) noexcept;
+
+  ~flat_set() = default;
+};
+}  // namespace s21
+
+#include "s21_flat_set.tpp"
+
+#endif  // S21_FLAT_SET_H_
@@ -0,0 +1,19 @@
+#include "s21_flat_set.h"
+
+namespace s21 {
+template <typename V>
+flat_set<V> &flat_set<V>::operator=(const flat_set &other) {
+  if (this != &other) {
+    tree_type::operator=(other);
+  }
+  return *this;
+}
+
+template <typename V>
+flat_set<V> &flat_set<V>::operator=(flat_set &&other) noexcept {
+  if (this != &other) {
+    tree_type::operator=(std::move(other));
+  }
+  return *this;
+}
+}  // namespace s21
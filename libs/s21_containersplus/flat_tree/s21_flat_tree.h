@@ -0,0 +1,114 @@
+#ifndef S21_FLAT_TREE_H_
+#define S21_FLAT_TREE_H_
+
+#include <cstddef>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+#include "../../s21_containers/vector/s21_vector.h"
+
+namespace s21 {
+/* Key extraction policies for the flat containers */
+template <typename V>
+struct FlatSetKeyOfValue {
+  const V &operator()(const V &value) const { return value; }
+};
+
+template <typename K, typename T>
+struct FlatMapKeyOfValue {
+  const K &operator()(const std::pair<K, T> &value) const {
+    return value.first;
+  }
+};
+
+/* Sorted unique sequence in one contiguous s21::vector. Lookups are a
+ * branchless binary search, single inserts shift the tail, bulk inserts
+ * sort the batch and merge it in one linear pass. Iterators are plain
+ * pointers (IterValue is const V for sets) and any insert or erase
+ * invalidates them. */
+template <typename K, typename V, typename KeyOfValue, typename IterValue = V>
+class FlatTree {
+ public:
+  using key_type = K;
+  using value_type = V;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = IterValue *;
+  using const_iterator = const V *;
+  using size_type = size_t;
+
+  FlatTree() = default;
+  FlatTree(std::initializer_list<value_type> const &items);
+  template <typename InputIt>
+  FlatTree(InputIt first, InputIt last);
+  FlatTree(const FlatTree &other) = default;
+  FlatTree(FlatTree &&other) noexcept = default;
+  FlatTree &operator=(const FlatTree &other) = default;
+  FlatTree &operator=(FlatTree &&other) noexcept = default;
+  ~FlatTree() = default;
+
+  iterator begin();
+  iterator end();
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  size_type capacity() const;
+  void reserve(size_type size);
+  void shrink_to_fit();
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(value_type &&value);
+  template <typename InputIt>
+  void insert(InputIt first, InputIt last);
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args &&...args);
+  /* Build the value from args only if key is not present */
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args);
+  iterator erase(iterator pos);
+  size_type erase(const key_type &key);
+  void swap(FlatTree &other);
+  /* Take every element whose key is missing here, the rest stay in other */
+  void merge(FlatTree &other);
+  template <class... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+  iterator find(const key_type &key);
+  const_iterator find(const key_type &key) const;
+  bool contains(const key_type &key) const;
+  iterator lower_bound(const key_type &key);
+  const_iterator lower_bound(const key_type &key) const;
+  iterator upper_bound(const key_type &key);
+  const_iterator upper_bound(const key_type &key) const;
+
+ protected:
+  using storage_type = vector<value_type>;
+
+  static const K &getKey(const value_type &value);
+  const value_type *lowerBound(const key_type &key) const;
+  const value_type *upperBound(const key_type &key) const;
+  iterator toIterator(const value_type *ptr);
+  /* Positions are indices into data_ */
+  size_type indexOf(const value_type *ptr) const;
+
+ private:
+  storage_type data_;
+
+  /* Sort a batch by key, keeping the first of equal keys */
+  static void normalize(storage_type &batch);
+  /* Linear merge of a sorted unique batch into data_. Keys already
+   * present go to rejected (or are dropped), placed receives the final
+   * index of every accepted batch element. */
+  void mergeSorted(storage_type &batch, storage_type *rejected,
+                   std::vector<size_type> *placed);
+};
+}  // namespace s21
+
+#include "s21_flat_tree.tpp"
+
+#endif  // S21_FLAT_TREE_H_
@@ -0,0 +1,353 @@
+#include <algorithm>
+#include <numeric>
+
+#include "s21_flat_tree.h"
+
+namespace s21 {
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+FlatTree<K, V, KeyOfValue, IterValue>::FlatTree(
+    std::initializer_list<value_type> const &items)
+    : FlatTree(items.begin(), items.end()) {}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+template <typename InputIt>
+FlatTree<K, V, KeyOfValue, IterValue>::FlatTree(InputIt first, InputIt last) {
+  data_.assign(first, last);
+  normalize(data_);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+typename FlatTree<K, V, KeyOfValue, IterValue>::iterator
+FlatTree<K, V, KeyOfValue, IterValue>::begin() {
+  return data_.data();
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+typename FlatTree<K, V, KeyOfValue, IterValue>::iterator
+FlatTree<K, V, KeyOfValue, IterValue>::end() {
+  return data_.data() + data_.size();
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+typename FlatTree<K, V, KeyOfValue, IterValue>::const_iterator
+FlatTree<K, V, KeyOfValue, IterValue>::cbegin() const {
+  return data_.data();
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+typename FlatTree<K, V, KeyOfValue, IterValue>::const_iterator
+FlatTree<K, V, KeyOfValue, IterValue>::cend() const {
+  return data_.data() + data_.size();
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+bool FlatTree<K, V, KeyOfValue, IterValue>::empty() const {
+  return data_.empty();
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+typename FlatTree<K, V, KeyOfValue, IterValue>::size_type
+FlatTree<K, V, KeyOfValue, IterValue>::size() const {
+  return data_.size();
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+typename FlatTree<K, V, KeyOfValue, IterValue>::size_type
+FlatTree<K, V, KeyOfValue, IterValue>::max_size() const {
+  return data_.max_size();
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+typename FlatTree<K, V, KeyOfValue, IterValue>::size_type
+FlatTree<K, V, KeyOfValue, IterValue>::capacity() const {
+  return data_.capacity();
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+void FlatTree<K, V, KeyOfValue, IterValue>::reserve(size_type size) {
+  data_.reserve(size);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+void FlatTree<K, V, KeyOfValue, IterValue>::shrink_to_fit() {
+  data_.shrink_to_fit();
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+void FlatTree<K, V, KeyOfValue, IterValue>::clear() {
+  data_.clear();
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+std::pair<typename FlatTree<K, V, KeyOfValue, IterValue>::iterator, bool>
+FlatTree<K, V, KeyOfValue, IterValue>::insert(const value_type &value) {
+  return try_emplace(getKey(value), value);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+std::pair<typename FlatTree<K, V, KeyOfValue, IterValue>::iterator, bool>
+FlatTree<K, V, KeyOfValue, IterValue>::insert(value_type &&value) {
+  /* the key is only read during the search, before value is moved from */
+  return try_emplace(getKey(value), std::move(value));
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+template <typename InputIt>
+void FlatTree<K, V, KeyOfValue, IterValue>::insert(InputIt first,
+                                                   InputIt last) {
+  storage_type batch;
+  batch.assign(first, last);
+  normalize(batch);
+  mergeSorted(batch, nullptr, nullptr);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+template <class... Args>
+std::pair<typename FlatTree<K, V, KeyOfValue, IterValue>::iterator, bool>
+FlatTree<K, V, KeyOfValue, IterValue>::emplace(Args &&...args) {
+  value_type value(std::forward<Args>(args)...);
+  return insert(std::move(value));
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+template <class... Args>
+std::pair<typename FlatTree<K, V, KeyOfValue, IterValue>::iterator, bool>
+FlatTree<K, V, KeyOfValue, IterValue>::try_emplace(const key_type &key,
+                                                   Args &&...args) {
+  const value_type *pos = lowerBound(key);
+  if (pos != cend() && !(key < getKey(*pos))) {
+    return std::make_pair(toIterator(pos), false);
+  }
+
+  size_type idx = indexOf(pos);
+  data_.emplace(typename storage_type::const_iterator(pos),
+                std::forward<Args>(args)...);
+  return std::make_pair(begin() + idx, true);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+typename FlatTree<K, V, KeyOfValue, IterValue>::iterator
+FlatTree<K, V, KeyOfValue, IterValue>::erase(iterator pos) {
+  size_type idx = indexOf(pos);
+  data_.erase(typename storage_type::iterator(data_.data() + idx));
+  return begin() + idx;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+typename FlatTree<K, V, KeyOfValue, IterValue>::size_type
+FlatTree<K, V, KeyOfValue, IterValue>::erase(const key_type &key) {
+  iterator pos = find(key);
+  if (pos == end()) return 0;
+
+  erase(pos);
+  return 1;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+void FlatTree<K, V, KeyOfValue, IterValue>::swap(FlatTree &other) {
+  data_.swap(other.data_);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+void FlatTree<K, V, KeyOfValue, IterValue>::merge(FlatTree &other) {
+  if (this == &other) return;
+
+  storage_type rejected;
+  mergeSorted(other.data_, &rejected, nullptr);
+  other.data_.swap(rejected);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+template <class... Args>
+std::vector<
+    std::pair<typename FlatTree<K, V, KeyOfValue, IterValue>::iterator, bool>>
+FlatTree<K, V, KeyOfValue, IterValue>::insert_many(Args &&...args) {
+  constexpr size_type npos = size_type(-1);
+  storage_type batch;
+  batch.insert_many_back(std::forward<Args>(args)...);
+
+  /* stable order by key: the first of equal arguments is the one kept */
+  std::vector<size_type> order(batch.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](size_type a, size_type b) {
+    return getKey(batch[a]) < getKey(batch[b]);
+  });
+
+  storage_type fresh;
+  std::vector<size_type> rank(batch.size(), npos);
+  for (size_type i = 0; i < order.size(); ++i) {
+    const K &key = getKey(batch[order[i]]);
+    bool repeated = i > 0 && !(getKey(batch[order[i - 1]]) < key);
+    if (!repeated && !contains(key)) {
+      rank[order[i]] = fresh.size();
+      fresh.push_back(std::move(batch[order[i]]));
+    }
+  }
+
+  std::vector<size_type> placed;
+  mergeSorted(fresh, nullptr, &placed);
+
+  std::vector<std::pair<iterator, bool>> res;
+  res.reserve(batch.size());
+  for (size_type i = 0; i < batch.size(); ++i) {
+    if (rank[i] != npos) {
+      res.push_back(std::make_pair(begin() + placed[rank[i]], true));
+    } else {
+      res.push_back(std::make_pair(find(getKey(batch[i])), false));
+    }
+  }
+  return res;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+typename FlatTree<K, V, KeyOfValue, IterValue>::iterator
+FlatTree<K, V, KeyOfValue, IterValue>::find(const key_type &key) {
+  return toIterator(static_cast<const FlatTree &>(*this).find(key));
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+typename FlatTree<K, V, KeyOfValue, IterValue>::const_iterator
+FlatTree<K, V, KeyOfValue, IterValue>::find(const key_type &key) const {
+  const value_type *pos = lowerBound(key);
+  if (pos != cend() && !(key < getKey(*pos))) return pos;
+  return cend();
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+bool FlatTree<K, V, KeyOfValue, IterValue>::contains(
+    const key_type &key) const {
+  return find(key) != cend();
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+typename FlatTree<K, V, KeyOfValue, IterValue>::iterator
+FlatTree<K, V, KeyOfValue, IterValue>::lower_bound(const key_type &key) {
+  return toIterator(lowerBound(key));
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+typename FlatTree<K, V, KeyOfValue, IterValue>::const_iterator
+FlatTree<K, V, KeyOfValue, IterValue>::lower_bound(const key_type &key) const {
+  return lowerBound(key);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+typename FlatTree<K, V, KeyOfValue, IterValue>::iterator
+FlatTree<K, V, KeyOfValue, IterValue>::upper_bound(const key_type &key) {
+  return toIterator(upperBound(key));
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+typename FlatTree<K, V, KeyOfValue, IterValue>::const_iterator
+FlatTree<K, V, KeyOfValue, IterValue>::upper_bound(const key_type &key) const {
+  return upperBound(key);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+const K &FlatTree<K, V, KeyOfValue, IterValue>::getKey(
+    const value_type &value) {
+  return KeyOfValue()(value);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+const V *FlatTree<K, V, KeyOfValue, IterValue>::lowerBound(
+    const key_type &key) const {
+  const value_type *base = data_.data();
+  size_type n = data_.size();
+  if (!n) return base;
+
+  /* the loop body has no data-dependent branch, the select becomes a
+   * conditional move and the trip count only depends on n. Both possible
+   * next midpoints are prefetched to overlap the cache misses. */
+  while (n > 1) {
+    size_type half = n / 2;
+    __builtin_prefetch(base + half / 2);
+    __builtin_prefetch(base + half + half / 2);
+    base = getKey(base[half]) < key ? base + half : base;
+    n -= half;
+  }
+  return base + (getKey(*base) < key);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+const V *FlatTree<K, V, KeyOfValue, IterValue>::upperBound(
+    const key_type &key) const {
+  const value_type *base = data_.data();
+  size_type n = data_.size();
+  if (!n) return base;
+
+  while (n > 1) {
+    size_type half = n / 2;
+    __builtin_prefetch(base + half / 2);
+    __builtin_prefetch(base + half + half / 2);
+    base = key < getKey(base[half]) ? base : base + half;
+    n -= half;
+  }
+  return base + !(key < getKey(*base));
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+typename FlatTree<K, V, KeyOfValue, IterValue>::iterator
+FlatTree<K, V, KeyOfValue, IterValue>::toIterator(const value_type *ptr) {
+  return begin() + indexOf(ptr);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+typename FlatTree<K, V, KeyOfValue, IterValue>::size_type
+FlatTree<K, V, KeyOfValue, IterValue>::indexOf(const value_type *ptr) const {
+  return ptr - data_.data();
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+void FlatTree<K, V, KeyOfValue, IterValue>::normalize(storage_type &batch) {
+  value_type *first = batch.data();
+  value_type *last = first + batch.size();
+
+  std::stable_sort(first, last, [](const value_type &a, const value_type &b) {
+    return getKey(a) < getKey(b);
+  });
+  value_type *unique_end =
+      std::unique(first, last, [](const value_type &a, const value_type &b) {
+        return !(getKey(a) < getKey(b));
+      });
+  batch.erase(typename storage_type::iterator(unique_end),
+              typename storage_type::iterator(last));
+}
+
+template <typename K, typename V, typename KeyOfValue, typename IterValue>
+void FlatTree<K, V, KeyOfValue, IterValue>::mergeSorted(
+    storage_type &batch, storage_type *rejected,
+    std::vector<size_type> *placed) {
+  if (batch.empty()) return;
+
+  value_type *ours = data_.data();
+  value_type *ours_end = ours + data_.size();
+  value_type *theirs = batch.data();
+  value_type *theirs_end = theirs + batch.size();
+
+  /* elements whose move may throw are copied, so a failed allocation or
+   * copy leaves data_ and batch untouched */
+  storage_type merged;
+  merged.reserve(data_.size() + batch.size());
+  if (rejected) rejected->reserve(batch.size());
+  if (placed) placed->reserve(batch.size());
+
+  while (ours != ours_end || theirs != theirs_end) {
+    if (theirs == theirs_end ||
+        (ours != ours_end && getKey(*ours) < getKey(*theirs))) {
+      merged.push_back(std::move_if_noexcept(*ours++));
+    } else if (ours == ours_end || getKey(*theirs) < getKey(*ours)) {
+      if (placed) placed->push_back(merged.size());
+      merged.push_back(std::move_if_noexcept(*theirs++));
+    } else {
+      /* equal keys: ours wins, theirs goes back to the caller */
+      merged.push_back(std::move_if_noexcept(*ours++));
+      if (rejected) rejected->push_back(std::move_if_noexcept(*theirs));
+      ++theirs;
+    }
+  }
+
+  data_.swap(merged);
+  batch.clear();
+}
+}  // namespace s21
@@ -0,0 +1,181 @@
+#ifndef S21_HASH_TABLE_H_
+#define S21_HASH_TABLE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+/* Key extraction policies for the hash containers */
+template <typename V>
+struct HashSetKeyOfValue {
+  const V &operator()(const V &value) const { return value; }
+};
+
+template <typename K, typename T>
+struct HashMapKeyOfValue {
+  const K &operator()(const std::pair<const K, T> &value) const {
+    return value.first;
+  }
+};
+
+/* Open-addressing table in the Swiss-table layout: one control byte per
+ * slot (empty, deleted, or the low 7 hash bits of a full slot) followed
+ * by an array of slots. A probe loads a group of control bytes at once,
+ * matches the 7-bit tag in all of them and only touches slots whose tag
+ * matched. Groups are probed triangularly over a power-of-two capacity.
+ *
+ * Iterators walk the slot array, so the iteration order and all
+ * iterators stay valid until the next rehash; erase leaves a tombstone
+ * and never moves other elements. */
+template <typename K, typename V, typename KeyOfValue,
+          typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class HashTable {
+ public:
+  class Iterator;
+  class ConstIterator;
+
+  using key_type = K;
+  using value_type = V;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+  using size_type = size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+
+  HashTable();
+  explicit HashTable(size_type bucket_count, const Hash &hash = Hash(),
+                     const KeyEqual &equal = KeyEqual());
+  HashTable(const HashTable &other);
+  HashTable(HashTable &&other) noexcept;
+  HashTable &operator=(const HashTable &other);
+  HashTable &operator=(HashTable &&other) noexcept;
+  ~HashTable();
+
+  iterator begin();
+  iterator end();
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(value_type &&value);
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args &&...args);
+  /* Build the value from args only if key is not present */
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args);
+  iterator erase(iterator pos);
+  size_type erase(const key_type &key);
+  void swap(HashTable &other) noexcept;
+  /* Take every element whose key is missing here, the rest stay in other */
+  void merge(HashTable &other);
+  template <class... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+  iterator find(const key_type &key);
+  const_iterator find(const key_type &key) const;
+  bool contains(const key_type &key) const;
+  size_type count(const key_type &key) const;
+
+  /* Hash policy */
+  size_type bucket_count() const;
+  float load_factor() const;
+  float max_load_factor() const;
+  /* Must be positive. Factors of 1 and above still leave one slot empty:
+   * open addressing needs one to stop a probe. */
+  void max_load_factor(float ml);
+  void rehash(size_type count);
+  void reserve(size_type count);
+  hasher hash_function() const;
+  key_equal key_eq() const;
+
+  class Iterator {
+   protected:
+    HashTable *table_;
+    size_type index_;
+
+   public:
+    Iterator() : table_(nullptr), index_(0) {}
+    Iterator(HashTable *table, size_type index)
+        : table_(table), index_(index) {}
+    iterator &operator++();
+    iterator operator++(int);
+    reference operator*() const;
+    value_type *operator->() const;
+    bool operator==(const iterator &other) const;
+    bool operator!=(const iterator &other) const;
+    size_type getIndex() const { return index_; }
+  };
+
+  class ConstIterator : public Iterator {
+   public:
+    ConstIterator() : Iterator() {}
+    ConstIterator(const HashTable *table, size_type index)
+        : Iterator(const_cast<HashTable *>(table), index) {}
+    ConstIterator(const Iterator &other) : Iterator(other) {}
+    const_reference operator*() const { return Iterator::operator*(); }
+    const value_type *operator->() const { return Iterator::operator->(); }
+  };
+
+ private:
+  using ctrl_t = int8_t;
+  using group_t = uint64_t;
+
+  static constexpr ctrl_t kEmpty = -128; /* 0b10000000 */
+  static constexpr ctrl_t kDeleted = -2; /* 0b11111110 */
+  static constexpr size_type kGroupWidth = 8;
+  static constexpr size_type kMinCapacity = 8;
+  static constexpr size_type npos = size_type(-1);
+
+  /* capacity_ + kGroupWidth - 1 control bytes, the tail mirrors the
+   * first bytes so a group can be loaded at any index without wrapping */
+  ctrl_t *ctrl_;
+  value_type *slots_;
+  size_type capacity_;
+  size_type size_;
+  size_type growth_left_; /* empty slots we may still fill */
+  float max_load_factor_;
+  Hash hash_;
+  KeyEqual equal_;
+
+  /* Group matching on 8 control bytes packed into a 64-bit word */
+  static group_t loadGroup(const ctrl_t *ctrl);
+  static group_t matchTag(group_t group, ctrl_t tag);
+  static group_t matchEmpty(group_t group);
+  static group_t matchEmptyOrDeleted(group_t group);
+  static size_type lowestByte(group_t mask);
+
+  static size_type mix(size_t hash);
+  static const K &getKey(const value_type &value);
+  static ctrl_t tagOf(size_type hash);
+  static size_type probeStart(size_type hash);
+
+  size_type findIndex(const key_type &key, size_type hash) const;
+  size_type findInsertSlot(size_type hash) const;
+  void setCtrl(size_type index, ctrl_t ctrl);
+  size_type growthCapacity(size_type capacity) const;
+  size_type capacityFor(size_type count) const;
+  template <class... Args>
+  size_type insertAt(size_type hash, Args &&...args);
+  void resize(size_type new_capacity);
+  void allocate(size_type capacity);
+  void deallocate();
+  void destroySlots();
+  size_type nextFull(size_type index) const;
+};
+}  // namespace s21
+
+#include "s21_hash_table.tpp"
+
+#endif  // S21_HASH_TABLE_H_
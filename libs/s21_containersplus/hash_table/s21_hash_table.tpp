@@ -0,0 +1,690 @@
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#include "s21_hash_table.h"
+
+namespace s21 {
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::HashTable()
+    : ctrl_(nullptr),
+      slots_(nullptr),
+      capacity_(0),
+      size_(0),
+      growth_left_(0),
+      max_load_factor_(0.875f),
+      hash_(),
+      equal_() {}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::HashTable(size_type bucket_count,
+                                                      const Hash &hash,
+                                                      const KeyEqual &equal)
+    : HashTable() {
+  hash_ = hash;
+  equal_ = equal;
+  if (bucket_count) rehash(bucket_count);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::HashTable(const HashTable &other)
+    : HashTable() {
+  max_load_factor_ = other.max_load_factor_;
+  hash_ = other.hash_;
+  equal_ = other.equal_;
+  if (!other.capacity_) return;
+
+  allocate(other.capacity_);
+  /* same capacity and hasher: every element keeps its slot */
+  size_type i = 0;
+  try {
+    for (; i < capacity_; ++i) {
+      if (other.ctrl_[i] >= 0) ::new (slots_ + i) value_type(other.slots_[i]);
+    }
+  } catch (...) {
+    for (size_type j = 0; j < i; ++j) {
+      if (other.ctrl_[j] >= 0) std::destroy_at(slots_ + j);
+    }
+    deallocate();
+    throw;
+  }
+  std::memcpy(ctrl_, other.ctrl_, capacity_ + kGroupWidth - 1);
+  size_ = other.size_;
+  growth_left_ = other.growth_left_;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::HashTable(
+    HashTable &&other) noexcept
+    : HashTable() {
+  swap(other);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+HashTable<K, V, KeyOfValue, Hash, KeyEqual> &
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::operator=(
+    const HashTable &other) {
+  if (this != &other) {
+    HashTable tmp(other);
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+HashTable<K, V, KeyOfValue, Hash, KeyEqual> &
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::operator=(
+    HashTable &&other) noexcept {
+  if (this != &other) {
+    HashTable tmp(std::move(other));
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::~HashTable() {
+  destroySlots();
+  deallocate();
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::iterator
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::begin() {
+  return iterator(this, nextFull(0));
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::iterator
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::end() {
+  return iterator(this, capacity_);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::const_iterator
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::cbegin() const {
+  return const_iterator(this, nextFull(0));
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::const_iterator
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::cend() const {
+  return const_iterator(this, capacity_);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+bool HashTable<K, V, KeyOfValue, Hash, KeyEqual>::empty() const {
+  return size_ == 0;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::size_type
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::size() const {
+  return size_;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::size_type
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::max_size() const {
+  return std::numeric_limits<size_type>::max() / (sizeof(value_type) + 1) /
+         2;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+void HashTable<K, V, KeyOfValue, Hash, KeyEqual>::clear() {
+  if (!capacity_) return;
+
+  destroySlots();
+  std::memset(ctrl_, kEmpty, capacity_ + kGroupWidth - 1);
+  size_ = 0;
+  growth_left_ = growthCapacity(capacity_);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+std::pair<typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::iterator, bool>
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::insert(const value_type &value) {
+  return try_emplace(getKey(value), value);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+std::pair<typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::iterator, bool>
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::insert(value_type &&value) {
+  /* the key is only read during the probe, before value is moved from */
+  return try_emplace(getKey(value), std::move(value));
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+template <class... Args>
+std::pair<typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::iterator, bool>
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::emplace(Args &&...args) {
+  value_type value(std::forward<Args>(args)...);
+  return insert(std::move(value));
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+template <class... Args>
+std::pair<typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::iterator, bool>
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::try_emplace(const key_type &key,
+                                                        Args &&...args) {
+  size_type hash = mix(hash_(key));
+  size_type index = findIndex(key, hash);
+  if (index != npos) return std::make_pair(iterator(this, index), false);
+
+  index = insertAt(hash, std::forward<Args>(args)...);
+  return std::make_pair(iterator(this, index), true);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::iterator
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::erase(iterator pos) {
+  size_type index = pos.getIndex();
+  if (index >= capacity_ || ctrl_[index] < 0) {
+    throw std::out_of_range("HashTable::erase(): iterator out of range");
+  }
+
+  std::destroy_at(slots_ + index);
+  setCtrl(index, kDeleted);
+  --size_;
+  return iterator(this, nextFull(index + 1));
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::size_type
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::erase(const key_type &key) {
+  iterator pos = find(key);
+  if (pos == end()) return 0;
+
+  erase(pos);
+  return 1;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+void HashTable<K, V, KeyOfValue, Hash, KeyEqual>::swap(
+    HashTable &other) noexcept {
+  std::swap(ctrl_, other.ctrl_);
+  std::swap(slots_, other.slots_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(size_, other.size_);
+  std::swap(growth_left_, other.growth_left_);
+  std::swap(max_load_factor_, other.max_load_factor_);
+  std::swap(hash_, other.hash_);
+  std::swap(equal_, other.equal_);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+void HashTable<K, V, KeyOfValue, Hash, KeyEqual>::merge(HashTable &other) {
+  if (this == &other) return;
+
+  for (size_type i = other.nextFull(0); i < other.capacity_;
+       i = other.nextFull(i + 1)) {
+    const key_type &key = getKey(other.slots_[i]);
+    size_type hash = mix(hash_(key));
+    if (findIndex(key, hash) == npos) {
+      insertAt(hash, std::move(other.slots_[i]));
+      other.erase(iterator(&other, i));
+    }
+  }
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+template <class... Args>
+std::vector<
+    std::pair<typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::iterator,
+              bool>>
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::insert_many(Args &&...args) {
+  /* one rehash up front keeps the returned iterators valid */
+  reserve(size_ + sizeof...(args));
+
+  std::vector<std::pair<iterator, bool>> res;
+  res.reserve(sizeof...(args));
+  (res.push_back(emplace(std::forward<Args>(args))), ...);
+  return res;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::iterator
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::find(const key_type &key) {
+  size_type index = findIndex(key, mix(hash_(key)));
+  return iterator(this, index == npos ? capacity_ : index);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::const_iterator
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::find(const key_type &key) const {
+  size_type index = findIndex(key, mix(hash_(key)));
+  return const_iterator(this, index == npos ? capacity_ : index);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+bool HashTable<K, V, KeyOfValue, Hash, KeyEqual>::contains(
+    const key_type &key) const {
+  return findIndex(key, mix(hash_(key))) != npos;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::size_type
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::count(const key_type &key) const {
+  return contains(key) ? 1 : 0;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::size_type
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::bucket_count() const {
+  return capacity_;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+float HashTable<K, V, KeyOfValue, Hash, KeyEqual>::load_factor() const {
+  return capacity_ ? float(size_) / float(capacity_) : 0.0f;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+float HashTable<K, V, KeyOfValue, Hash, KeyEqual>::max_load_factor() const {
+  return max_load_factor_;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+void HashTable<K, V, KeyOfValue, Hash, KeyEqual>::max_load_factor(float ml) {
+  if (!(ml > 0.0f)) {
+    throw std::invalid_argument(
+        "HashTable::max_load_factor(): must be positive");
+  }
+  max_load_factor_ = ml;
+  if (!capacity_) return;
+
+  if (size_ > growthCapacity(capacity_)) {
+    resize(capacityFor(size_));
+  } else {
+    size_type used = 0;
+    for (size_type i = 0; i < capacity_; ++i) used += ctrl_[i] != kEmpty;
+    size_type growth = growthCapacity(capacity_);
+    growth_left_ = growth > used ? growth - used : 0;
+  }
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+void HashTable<K, V, KeyOfValue, Hash, KeyEqual>::rehash(size_type count) {
+  if (!count && !size_) {
+    destroySlots();
+    deallocate();
+    return;
+  }
+
+  size_type new_capacity = capacityFor(size_);
+  while (new_capacity < count) new_capacity *= 2;
+  resize(new_capacity);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+void HashTable<K, V, KeyOfValue, Hash, KeyEqual>::reserve(size_type count) {
+  if (count > size_ && count - size_ > growth_left_) {
+    resize(capacityFor(count));
+  }
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::hasher
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::hash_function() const {
+  return hash_;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::key_equal
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::key_eq() const {
+  return equal_;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::iterator &
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::Iterator::operator++() {
+  index_ = table_->nextFull(index_ + 1);
+  return *this;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::iterator
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::Iterator::operator++(int) {
+  iterator tmp = *this;
+  ++(*this);
+  return tmp;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::reference
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::Iterator::operator*() const {
+  if (!table_ || index_ >= table_->capacity_) {
+    throw std::out_of_range(
+        "HashTable::Iterator::operator*(): iterator out of range");
+  }
+  return table_->slots_[index_];
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::value_type *
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::Iterator::operator->() const {
+  return &**this;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+bool HashTable<K, V, KeyOfValue, Hash, KeyEqual>::Iterator::operator==(
+    const iterator &other) const {
+  return table_ == other.table_ && index_ == other.index_;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+bool HashTable<K, V, KeyOfValue, Hash, KeyEqual>::Iterator::operator!=(
+    const iterator &other) const {
+  return !(*this == other);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::group_t
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::loadGroup(const ctrl_t *ctrl) {
+  group_t group;
+  std::memcpy(&group, ctrl, sizeof(group));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  group = __builtin_bswap64(group);
+#endif
+  return group;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::group_t
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::matchTag(group_t group,
+                                                     ctrl_t tag) {
+  /* classic "has zero byte": may report a full slot right after a real
+   * match whose tag differs in the lowest bit, the key check weeds it out */
+  constexpr group_t lsbs = 0x0101010101010101ULL;
+  constexpr group_t msbs = 0x8080808080808080ULL;
+  group_t x = group ^ (lsbs * static_cast<uint8_t>(tag));
+  return (x - lsbs) & ~x & msbs;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::group_t
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::matchEmpty(group_t group) {
+  /* kEmpty is the only control byte with the top bit set and bit 1 clear */
+  constexpr group_t msbs = 0x8080808080808080ULL;
+  return group & ~(group << 6) & msbs;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::group_t
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::matchEmptyOrDeleted(
+    group_t group) {
+  constexpr group_t msbs = 0x8080808080808080ULL;
+  return group & msbs;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::size_type
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::lowestByte(group_t mask) {
+  return __builtin_ctzll(mask) >> 3;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::size_type
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::mix(size_t hash) {
+  /* std::hash is the identity for integers: spread every input bit over
+   * both the 7-bit tag and the probe start */
+  uint64_t h = hash;
+  h ^= h >> 30;
+  h *= 0xbf58476d1ce4e5b9ULL;
+  h ^= h >> 27;
+  h *= 0x94d049bb133111ebULL;
+  h ^= h >> 31;
+  return static_cast<size_type>(h);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+const K &HashTable<K, V, KeyOfValue, Hash, KeyEqual>::getKey(
+    const value_type &value) {
+  return KeyOfValue()(value);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::ctrl_t
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::tagOf(size_type hash) {
+  return static_cast<ctrl_t>(hash & 0x7F);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::size_type
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::probeStart(size_type hash) {
+  return hash >> 7;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::size_type
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::findIndex(const key_type &key,
+                                                      size_type hash) const {
+  if (!size_) return npos;
+
+  size_type mask = capacity_ - 1;
+  size_type pos = probeStart(hash) & mask;
+  ctrl_t tag = tagOf(hash);
+
+  for (size_type step = kGroupWidth;; step += kGroupWidth) {
+    group_t group = loadGroup(ctrl_ + pos);
+    for (group_t match = matchTag(group, tag); match; match &= match - 1) {
+      size_type index = (pos + lowestByte(match)) & mask;
+      if (equal_(getKey(slots_[index]), key)) return index;
+    }
+    if (matchEmpty(group)) return npos;
+    pos = (pos + step) & mask;
+  }
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::size_type
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::findInsertSlot(
+    size_type hash) const {
+  size_type mask = capacity_ - 1;
+  size_type pos = probeStart(hash) & mask;
+
+  for (size_type step = kGroupWidth;; step += kGroupWidth) {
+    group_t free = matchEmptyOrDeleted(loadGroup(ctrl_ + pos));
+    if (free) return (pos + lowestByte(free)) & mask;
+    pos = (pos + step) & mask;
+  }
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+void HashTable<K, V, KeyOfValue, Hash, KeyEqual>::setCtrl(size_type index,
+                                                         ctrl_t ctrl) {
+  ctrl_[index] = ctrl;
+  if (index < kGroupWidth - 1) ctrl_[capacity_ + index] = ctrl;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::size_type
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::growthCapacity(
+    size_type capacity) const {
+  /* at least one slot stays empty so every probe terminates */
+  size_type growth = static_cast<size_type>(capacity * max_load_factor_);
+  return growth < capacity ? growth : capacity - 1;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::size_type
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::capacityFor(
+    size_type count) const {
+  if (count > max_size()) {
+    throw std::length_error("HashTable: too many elements");
+  }
+  size_type capacity = kMinCapacity;
+  while (growthCapacity(capacity) < count) capacity *= 2;
+  return capacity;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+template <class... Args>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::size_type
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::insertAt(size_type hash,
+                                                     Args &&...args) {
+  size_type index = capacity_ ? findInsertSlot(hash) : 0;
+
+  if (!capacity_ || (!growth_left_ && ctrl_[index] == kEmpty)) {
+    /* args may refer into the table, build the value before it moves */
+    value_type value(std::forward<Args>(args)...);
+    /* plenty of tombstones: rebuild in place instead of growing; either
+     * way the new capacity must have room for size_ + 1 */
+    bool crowded = size_ + 1 > growthCapacity(capacity_) / 2;
+    resize(std::max(capacityFor(size_ + 1),
+                    crowded ? capacity_ * 2 : capacity_));
+    index = findInsertSlot(hash);
+    ::new (slots_ + index) value_type(std::move(value));
+  } else {
+    ::new (slots_ + index) value_type(std::forward<Args>(args)...);
+  }
+
+  if (growth_left_ && ctrl_[index] == kEmpty) --growth_left_;
+  setCtrl(index, tagOf(hash));
+  ++size_;
+  return index;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+void HashTable<K, V, KeyOfValue, Hash, KeyEqual>::resize(
+    size_type new_capacity) {
+  ctrl_t *old_ctrl = ctrl_;
+  value_type *old_slots = slots_;
+  size_type old_capacity = capacity_;
+  size_type old_size = size_;
+  size_type old_growth = growth_left_;
+
+  allocate(new_capacity);
+  try {
+    for (size_type i = 0; i < old_capacity; ++i) {
+      if (old_ctrl[i] < 0) continue;
+      size_type hash = mix(hash_(getKey(old_slots[i])));
+      size_type index = findInsertSlot(hash);
+      ::new (slots_ + index) value_type(std::move_if_noexcept(old_slots[i]));
+      setCtrl(index, tagOf(hash));
+      ++size_;
+      --growth_left_;
+    }
+  } catch (...) {
+    destroySlots();
+    deallocate();
+    ctrl_ = old_ctrl;
+    slots_ = old_slots;
+    capacity_ = old_capacity;
+    size_ = old_size;
+    growth_left_ = old_growth;
+    throw;
+  }
+
+  for (size_type i = 0; i < old_capacity; ++i) {
+    if (old_ctrl[i] >= 0) std::destroy_at(old_slots + i);
+  }
+  delete[] old_ctrl;
+  std::allocator<value_type>().deallocate(old_slots, old_capacity);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+void HashTable<K, V, KeyOfValue, Hash, KeyEqual>::allocate(
+    size_type capacity) {
+  value_type *slots = std::allocator<value_type>().allocate(capacity);
+  try {
+    ctrl_ = new ctrl_t[capacity + kGroupWidth - 1];
+  } catch (...) {
+    std::allocator<value_type>().deallocate(slots, capacity);
+    throw;
+  }
+  slots_ = slots;
+  std::memset(ctrl_, kEmpty, capacity + kGroupWidth - 1);
+  capacity_ = capacity;
+  size_ = 0;
+  growth_left_ = growthCapacity(capacity);
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+void HashTable<K, V, KeyOfValue, Hash, KeyEqual>::deallocate() {
+  if (capacity_) {
+    delete[] ctrl_;
+    std::allocator<value_type>().deallocate(slots_, capacity_);
+  }
+  ctrl_ = nullptr;
+  slots_ = nullptr;
+  capacity_ = 0;
+  size_ = 0;
+  growth_left_ = 0;
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+void HashTable<K, V, KeyOfValue, Hash, KeyEqual>::destroySlots() {
+  for (size_type i = 0; i < capacity_; ++i) {
+    if (ctrl_[i] >= 0) std::destroy_at(slots_ + i);
+  }
+}
+
+template <typename K, typename V, typename KeyOfValue, typename Hash,
+          typename KeyEqual>
+typename HashTable<K, V, KeyOfValue, Hash, KeyEqual>::size_type
+HashTable<K, V, KeyOfValue, Hash, KeyEqual>::nextFull(size_type index) const {
+  while (index < capacity_ && ctrl_[index] < 0) ++index;
+  return index;
+}
+}  // namespace s21
@@ -0,0 +1,59 @@
+#ifndef S21_UNORDERED_MAP_H_
+#define S21_UNORDERED_MAP_H_
+
+#include <tuple>
+
+#include "../hash_table/s21_hash_table.h"
+
+namespace s21 {
+template <typename K, typename T, typename Hash = std::hash<K>,
+          typename KeyEqual = std::equal_to<K>>
+class unordered_map
+    : public HashTable<K, std::pair<const K, T>, HashMapKeyOfValue<K, T>, Hash,
+                       KeyEqual> {
+  using table_type = HashTable<K, std::pair<const K, T>,
+                               HashMapKeyOfValue<K, T>, Hash, KeyEqual>;
+
+ public:
+  using key_type = K;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = typename table_type::iterator;
+  using const_iterator = typename table_type::const_iterator;
+  using size_type = size_t;
+
+  unordered_map() : table_type() {}
+  explicit unordered_map(size_type bucket_count, const Hash &hash = Hash(),
+                         const KeyEqual &equal = KeyEqual())
+      : table_type(bucket_count, hash, equal) {}
+  unordered_map(std::initializer_list<value_type> const &items);
+  unordered_map(const unordered_map &other) : table_type(other) {}
+  unordered_map(unordered_map &&other) noexcept
+      : table_type(std::move(other)) {}
+  unordered_map &operator=(const unordered_map &other);
+  unordered_map &operator=(unordered_map &&other) noexcept;
+
+  ~unordered_map() = default;
+
+  T &at(const K &key);
+  const T &at(const K &key) const;
+  T &operator[](const K &key);
+  T &operator[](K &&key);
+
+  using table_type::insert;
+  std::pair<iterator, bool> insert(const K &key, const T &obj);
+  std::pair<iterator, bool> insert(const K &key, T &&obj);
+  std::pair<iterator, bool> insert_or_assign(const K &key, const T &obj);
+  std::pair<iterator, bool> insert_or_assign(const K &key, T &&obj);
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(const K &key, Args &&...args);
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(K &&key, Args &&...args);
+};
+}  // namespace s21
+
+#include "s21_unordered_map.tpp"
+
+#endif  // S21_UNORDERED_MAP_H_
@@ -0,0 +1,108 @@
+#include "s21_unordered_map.h"
+
+namespace s21 {
+template <typename K, typename T, typename Hash, typename KeyEqual>
+unordered_map<K, T, Hash, KeyEqual>::unordered_map(
+    std::initializer_list<value_type> const &items) {
+  table_type::reserve(items.size());
+  for (auto it = items.begin(); it != items.end(); ++it) {
+    table_type::insert(*it);
+  }
+}
+
+template <typename K, typename T, typename Hash, typename KeyEqual>
+unordered_map<K, T, Hash, KeyEqual> &
+unordered_map<K, T, Hash, KeyEqual>::operator=(const unordered_map &other) {
+  if (this != &other) {
+    table_type::operator=(other);
+  }
+  return *this;
+}
+
+template <typename K, typename T, typename Hash, typename KeyEqual>
+unordered_map<K, T, Hash, KeyEqual> &
+unordered_map<K, T, Hash, KeyEqual>::operator=(
+    unordered_map &&other) noexcept {
+  if (this != &other) {
+    table_type::operator=(std::move(other));
+  }
+  return *this;
+}
+
+template <typename K, typename T, typename Hash, typename KeyEqual>
+T &unordered_map<K, T, Hash, KeyEqual>::at(const K &key) {
+  auto it = table_type::find(key);
+  if (it == table_type::end()) {
+    throw std::out_of_range("unordered_map<K, T>::at(): key not found");
+  }
+  return it->second;
+}
+
+template <typename K, typename T, typename Hash, typename KeyEqual>
+const T &unordered_map<K, T, Hash, KeyEqual>::at(const K &key) const {
+  auto it = table_type::find(key);
+  if (it == table_type::cend()) {
+    throw std::out_of_range("unordered_map<K, T>::at(): key not found");
+  }
+  return it->second;
+}
+
+template <typename K, typename T, typename Hash, typename KeyEqual>
+T &unordered_map<K, T, Hash, KeyEqual>::operator[](const K &key) {
+  return try_emplace(key).first->second;
+}
+
+template <typename K, typename T, typename Hash, typename KeyEqual>
+T &unordered_map<K, T, Hash, KeyEqual>::operator[](K &&key) {
+  return try_emplace(std::move(key)).first->second;
+}
+
+template <typename K, typename T, typename Hash, typename KeyEqual>
+std::pair<typename unordered_map<K, T, Hash, KeyEqual>::iterator, bool>
+unordered_map<K, T, Hash, KeyEqual>::insert(const K &key, const T &obj) {
+  return try_emplace(key, obj);
+}
+
+template <typename K, typename T, typename Hash, typename KeyEqual>
+std::pair<typename unordered_map<K, T, Hash, KeyEqual>::iterator, bool>
+unordered_map<K, T, Hash, KeyEqual>::insert(const K &key, T &&obj) {
+  return try_emplace(key, std::move(obj));
+}
+
+template <typename K, typename T, typename Hash, typename KeyEqual>
+std::pair<typename unordered_map<K, T, Hash, KeyEqual>::iterator, bool>
+unordered_map<K, T, Hash, KeyEqual>::insert_or_assign(const K &key,
+                                                      const T &obj) {
+  auto res = try_emplace(key, obj);
+  if (!res.second) res.first->second = obj;
+  return res;
+}
+
+template <typename K, typename T, typename Hash, typename KeyEqual>
+std::pair<typename unordered_map<K, T, Hash, KeyEqual>::iterator, bool>
+unordered_map<K, T, Hash, KeyEqual>::insert_or_assign(const K &key, T &&obj) {
+  auto res = try_emplace(key, std::move(obj));
+  if (!res.second) res.first->second = std::move(obj);
+  return res;
+}
+
+template <typename K, typename T, typename Hash, typename KeyEqual>
+template <class... Args>
+std::pair<typename unordered_map<K, T, Hash, KeyEqual>::iterator, bool>
+unordered_map<K, T, Hash, KeyEqual>::try_emplace(const K &key,
+                                                 Args &&...args) {
+  return table_type::try_emplace(
+      key, std::piecewise_construct, std::forward_as_tuple(key),
+      std::forward_as_tuple(std::forward<Args>(args)...));
+}
+
+template <typename K, typename T, typename Hash, typename KeyEqual>
+template <class... Args>
+std::pair<typename unordered_map<K, T, Hash, KeyEqual>::iterator, bool>
+unordered_map<K, T, Hash, KeyEqual>::try_emplace(K &&key, Args &&...args) {
+  /* key is only moved into the slot after the probe has finished */
+  return table_type::try_emplace(
+      key, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+      std::forward_as_tuple(std::forward<Args>(args)...));
+}
+}  // namespace s21
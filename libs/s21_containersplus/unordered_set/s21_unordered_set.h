@@ -0,0 +1,39 @@
+#ifndef S21_UNORDERED_SET_H_
+#define S21_UNORDERED_SET_H_
+
+#include "../hash_table/s21_hash_table.h"
+
+namespace s21 {
+template <typename V, typename Hash = std::hash<V>,
+          typename KeyEqual = std::equal_to<V>>
+class unordered_set
+    : public HashTable<V, V, HashSetKeyOfValue<V>, Hash, KeyEqual> {
+  using table_type = HashTable<V, V, HashSetKeyOfValue<V>, Hash, KeyEqual>;
+
+ public:
+  using key_type = V;
+  using value_type = V;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = typename table_type::iterator;
+  using const_iterator = typename table_type::const_iterator;
+  using size_type = size_t;
+
+  unordered_set() : table_type() {}
+  explicit unordered_set(size_type bucket_count, const Hash &hash = Hash(),
+                         const KeyEqual &equal = KeyEqual())
+      : table_type(bucket_count, hash, equal) {}
+  unordered_set(std::initializer_list<value_type> const &items);
+  unordered_set(const unordered_set &other) : table_type(other) {}
+  unordered_set(unordered_set &&other) noexcept
+      : table_type(std::move(other)) {}
+  unordered_set &operator=(const unordered_set &other);
+  unordered_set &operator=(unordered_set &&other) noexcept;
+
+  ~unordered_set() = default;
+};
+}  // namespace s21
+
+#include "s21_unordered_set.tpp"
+
+#endif  // S21_UNORDERED_SET_H_
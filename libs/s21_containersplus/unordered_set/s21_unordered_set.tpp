@@ -0,0 +1,30 @@
+#include "s21_unordered_set.h"
+
+namespace s21 {
+template <typename V, typename Hash, typename KeyEqual>
+unordered_set<V, Hash, KeyEqual>::unordered_set(
+    std::initializer_list<value_type> const &items) {
+  table_type::reserve(items.size());
+  for (auto it = items.begin(); it != items.end(); ++it) {
+    table_type::insert(*it);
+  }
+}
+
+template <typename V, typename Hash, typename KeyEqual>
+unordered_set<V, Hash, KeyEqual> &unordered_set<V, Hash, KeyEqual>::operator=(
+    const unordered_set &other) {
+  if (this != &other) {
+    table_type::operator=(other);
+  }
+  return *this;
+}
+
+template <typename V, typename Hash, typename KeyEqual>
+unordered_set<V, Hash, KeyEqual> &unordered_set<V, Hash, KeyEqual>::operator=(
+    unordered_set &&other) noexcept {
+  if (this != &other) {
+    table_type::operator=(std::move(other));
+  }
+  return *this;
+}
+}  // namespace s21
@@ -0,0 +1,263 @@
+#ifndef S21_UNROLLED_LIST_H_
+#define S21_UNROLLED_LIST_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+/* Doubly linked list of chunks holding up to ChunkSize elements each
+ * (about 512 bytes of elements by default), so links cost a few bytes per
+ * chunk instead of two pointers per element and a traversal reads whole
+ * cache lines. Elements sit in a contiguous [lo, hi) window of their
+ * chunk, which leaves room to push at either end without shifting.
+ *
+ * Unlike s21::list, an element may move within its chunk or to a
+ * neighbouring chunk: insert and erase invalidate iterators and
+ * references into the chunks they touch, push_* and pop_* only those to
+ * the popped element. splice relinks whole chunks; sort, merge and
+ * unique move elements between chunks, so they invalidate everything. */
+template <typename T,
+          std::size_t ChunkSize = std::max<std::size_t>(8, 512 / sizeof(T)),
+          typename Allocator = std::allocator<T>>
+class unrolled_list {
+  static_assert(ChunkSize >= 2, "unrolled_list chunks hold 2+ elements");
+
+  struct Link {
+    Link *prev;
+    Link *next;
+    std::size_t lo; /* first and past-the-last slot in use */
+    std::size_t hi;
+  };
+
+  struct Chunk : Link {
+    alignas(T) unsigned char storage[ChunkSize * sizeof(T)];
+
+    T *slot(std::size_t i) {
+      return std::launder(reinterpret_cast<T *>(storage)) + i;
+    }
+  };
+
+  using chunk_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<Chunk>;
+  using chunk_traits = std::allocator_traits<chunk_allocator>;
+
+ public:
+  template <bool Const>
+  class UnrolledIterator;
+
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = UnrolledIterator<false>;
+  using const_iterator = UnrolledIterator<true>;
+  using size_type = std::size_t;
+  using allocator_type = Allocator;
+
+  static constexpr size_type chunk_size = ChunkSize;
+
+  /* Bidirectional iterator: a chunk and a slot in it */
+  template <bool Const>
+  class UnrolledIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T *, T *>;
+    using reference = std::conditional_t<Const, const T &, T &>;
+
+    UnrolledIterator() : link_(nullptr), slot_(0) {}
+    template <bool C = Const, typename = std::enable_if_t<C>>
+    UnrolledIterator(const UnrolledIterator<false> &other)
+        : link_(other.link_), slot_(other.slot_) {}
+
+    reference operator*() const { return *chunk()->slot(slot_); }
+    pointer operator->() const { return chunk()->slot(slot_); }
+    UnrolledIterator &operator++() {
+      if (++slot_ == link_->hi) {
+        link_ = link_->next;
+        slot_ = link_->lo;
+      }
+      return *this;
+    }
+    UnrolledIterator operator++(int) {
+      UnrolledIterator tmp(*this);
+      ++*this;
+      return tmp;
+    }
+    UnrolledIterator &operator--() {
+      if (slot_ == link_->lo) {
+        link_ = link_->prev;
+        slot_ = link_->hi;
+      }
+      --slot_;
+      return *this;
+    }
+    UnrolledIterator operator--(int) {
+      UnrolledIterator tmp(*this);
+      --*this;
+      return tmp;
+    }
+    bool operator==(const UnrolledIterator &other) const {
+      return link_ == other.link_ && slot_ == other.slot_;
+    }
+    bool operator!=(const UnrolledIterator &other) const {
+      return !(*this == other);
+    }
+
+   private:
+    friend class unrolled_list;
+    friend class UnrolledIterator<!Const>;
+
+    UnrolledIterator(Link *link, size_type slot) : link_(link), slot_(slot) {}
+    Chunk *chunk() const { return static_cast<Chunk *>(link_); }
+
+    Link *link_; /* the list's sentinel for end() */
+    size_type slot_;
+  };
+
+  unrolled_list();
+  explicit unrolled_list(const allocator_type &alloc);
+  explicit unrolled_list(size_type n);
+  unrolled_list(std::initializer_list<value_type> const &items);
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+  unrolled_list(InputIt first, InputIt last);
+  unrolled_list(const unrolled_list &other);
+  unrolled_list(unrolled_list &&other) noexcept;
+  unrolled_list &operator=(const unrolled_list &other);
+  /* Allocators move along only as their propagate_on_container_* traits
+   * say; a move between unequal ones moves the elements one by one */
+  unrolled_list &operator=(unrolled_list &&other) noexcept(
+      chunk_traits::propagate_on_container_move_assignment::value ||
+      chunk_traits::is_always_equal::value);
+  ~unrolled_list();
+
+  allocator_type get_allocator() const;
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type max_size() const;
+  /* Chunks in use, for memory accounting */
+  size_type chunk_count() const { return chunks_; }
+
+  reference front() { return *begin(); }
+  const_reference front() const { return *begin(); }
+  reference back() { return *std::prev(end()); }
+  const_reference back() const { return *std::prev(end()); }
+
+  iterator begin() { return iterator(head_.next, head_.next->lo); }
+  iterator end() { return iterator(&head_, 0); }
+  const_iterator begin() const {
+    return const_iterator(head_.next, head_.next->lo);
+  }
+  const_iterator end() const {
+    return const_iterator(const_cast<Link *>(&head_), 0);
+  }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
+  void push_front(const_reference value);
+  void push_front(value_type &&value);
+  template <class... Args>
+  reference emplace_back(Args &&...args);
+  template <class... Args>
+  reference emplace_front(Args &&...args);
+  /* No-ops on an empty list, like list */
+  void pop_back();
+  void pop_front();
+
+  iterator insert(const_iterator pos, const_reference value);
+  iterator insert(const_iterator pos, value_type &&value);
+  template <class... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
+  iterator erase(const_iterator pos);
+  void clear();
+  void swap(unrolled_list &other) noexcept;
+
+  /* Move other's chunks in before pos, splitting pos's chunk if pos is
+   * inside it; O(ChunkSize) */
+  void splice(const_iterator pos, unrolled_list &other);
+  /* Merge sorted other into this sorted list; stable */
+  void merge(unrolled_list &other);
+  void reverse();
+  void unique();
+  /* Stable: each chunk is sorted in place, then runs of chunks are
+   * merged bottom-up */
+  void sort();
+
+  template <class... Args>
+  iterator insert_many(const_iterator pos, Args &&...args);
+  template <class... Args>
+  void insert_many_back(Args &&...args);
+  template <class... Args>
+  void insert_many_front(Args &&...args);
+
+ private:
+  /* Detached run of chunks, for merging */
+  struct Chain {
+    Link *first;
+    Link *last;
+    size_type size;
+    size_type chunks;
+  };
+
+  Link head_; /* sentinel of the circular chunk list, lo = hi = 0 */
+  size_type size_;
+  size_type chunks_;
+  chunk_allocator alloc_;
+
+  static Chunk *asChunk(Link *link) { return static_cast<Chunk *>(link); }
+  static size_type count(const Link *link) { return link->hi - link->lo; }
+
+  /* Raw chunk with an empty window at lo; linkBefore and unlink keep
+   * chunks_ current, detached chains count their own chunks */
+  Chunk *createChunk(size_type lo);
+  void destroyChunk(Link *link);
+  void linkBefore(Link *pos, Link *link);
+  void unlink(Link *link);
+  /* Destroy the elements of a linked chunk and free it */
+  void dropChunk(Link *link);
+  /* Point the neighbours of the chunks back at our sentinel after the
+   * list object moved */
+  void adoptChunks();
+  /* Exchange the chunks, not the allocators */
+  void swapStorage(unrolled_list &other) noexcept;
+  /* Raw slot before pos for a new element, shifting the shorter side of
+   * its chunk or splitting a full one; the slot already counts as used */
+  iterator openSlot(const_iterator pos);
+  /* Close the raw slot at (link, slot) by shifting the shorter side over
+   * it; frees the chunk and returns false when it becomes empty */
+  bool closeSlot(Link *link, size_type slot);
+  /* Move [slot, hi) of the chunk into a new chunk after it */
+  Link *splitChunk(Link *link, size_type slot);
+  /* Turn (link, index from lo) into an iterator, stepping to the next
+   * chunk when the index is past the chunk's last element */
+  iterator normalize(Link *link, size_type index);
+  /* Fold the next chunk into this one when both are at most half full */
+  void absorbNext(Link *link);
+
+  /* Chains are null-terminated at both ends */
+  Chain detachAll();
+  /* Append the chain to the back of the list */
+  void attach(Chain chain);
+  static Chain chainFrom(Link *first);
+  /* Stable merge of two detached chains into fresh full chunks, the input
+   * chunks are freed as they are drained */
+  Chain mergeChains(Chain left, Chain right);
+  void appendTo(Chain &out, value_type &&value);
+  void appendChain(Chain &out, Chain tail);
+};
+}  // namespace s21
+
+#include "s21_unrolled_list.tpp"
+
+#endif  // S21_UNROLLED_LIST_H_
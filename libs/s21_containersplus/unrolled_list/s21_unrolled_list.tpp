@@ -0,0 +1,711 @@
+#include "s21_unrolled_list.h"
+
+namespace s21 {
+
+template <typename T, std::size_t C, typename A>
+unrolled_list<T, C, A>::unrolled_list() : unrolled_list(allocator_type()) {}
+
+template <typename T, std::size_t C, typename A>
+unrolled_list<T, C, A>::unrolled_list(const allocator_type &alloc)
+    : head_{&head_, &head_, 0, 0}, size_(0), chunks_(0), alloc_(alloc) {}
+
+template <typename T, std::size_t C, typename A>
+unrolled_list<T, C, A>::unrolled_list(size_type n) : unrolled_list() {
+  while (size_ < n) emplace_back();
+}
+
+template <typename T, std::size_t C, typename A>
+unrolled_list<T, C, A>::unrolled_list(
+    std::initializer_list<value_type> const &items)
+    : unrolled_list(items.begin(), items.end()) {}
+
+template <typename T, std::size_t C, typename A>
+template <typename InputIt, typename>
+unrolled_list<T, C, A>::unrolled_list(InputIt first, InputIt last)
+    : unrolled_list() {
+  for (; first != last; ++first) emplace_back(*first);
+}
+
+template <typename T, std::size_t C, typename A>
+unrolled_list<T, C, A>::unrolled_list(const unrolled_list &other)
+    : unrolled_list(
+          chunk_traits::select_on_container_copy_construction(other.alloc_)) {
+  for (const_reference value : other) emplace_back(value);
+}
+
+template <typename T, std::size_t C, typename A>
+unrolled_list<T, C, A>::unrolled_list(unrolled_list &&other) noexcept
+    : head_(other.head_),
+      size_(other.size_),
+      chunks_(other.chunks_),
+      alloc_(std::move(other.alloc_)) {
+  adoptChunks();
+  other.head_ = Link{&other.head_, &other.head_, 0, 0};
+  other.size_ = 0;
+  other.chunks_ = 0;
+}
+
+template <typename T, std::size_t C, typename A>
+unrolled_list<T, C, A> &unrolled_list<T, C, A>::operator=(
+    const unrolled_list &other) {
+  constexpr bool propagate =
+      chunk_traits::propagate_on_container_copy_assignment::value;
+  if (this != &other) {
+    unrolled_list tmp(propagate ? other.alloc_ : alloc_);
+    for (const_reference value : other) tmp.emplace_back(value);
+    /* tmp frees the old chunks with the allocator that made them */
+    swapStorage(tmp);
+    if (propagate) std::swap(alloc_, tmp.alloc_);
+  }
+  return *this;
+}
+
+template <typename T, std::size_t C, typename A>
+unrolled_list<T, C, A> &unrolled_list<T, C, A>::operator=(
+    unrolled_list &&other) noexcept(
+    chunk_traits::propagate_on_container_move_assignment::value ||
+    chunk_traits::is_always_equal::value) {
+  constexpr bool propagate =
+      chunk_traits::propagate_on_container_move_assignment::value;
+  if (this == &other) return *this;
+
+  if (!propagate && alloc_ != other.alloc_) {
+    /* chunks cannot change owners, move the elements into our own */
+    unrolled_list tmp(alloc_);
+    for (reference value : other) tmp.emplace_back(std::move(value));
+    other.clear();
+    swapStorage(tmp);
+    return *this;
+  }
+  unrolled_list tmp(std::move(other));
+  swapStorage(tmp);
+  if (propagate) std::swap(alloc_, tmp.alloc_);
+  return *this;
+}
+
+template <typename T, std::size_t C, typename A>
+unrolled_list<T, C, A>::~unrolled_list() {
+  clear();
+}
+
+template <typename T, std::size_t C, typename A>
+typename unrolled_list<T, C, A>::allocator_type
+unrolled_list<T, C, A>::get_allocator() const {
+  return allocator_type(alloc_);
+}
+
+template <typename T, std::size_t C, typename A>
+typename unrolled_list<T, C, A>::size_type unrolled_list<T, C, A>::max_size()
+    const {
+  return std::numeric_limits<std::ptrdiff_t>::max() / sizeof(T);
+}
+
+template <typename T, std::size_t C, typename A>
+void unrolled_list<T, C, A>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, std::size_t C, typename A>
+void unrolled_list<T, C, A>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T, std::size_t C, typename A>
+void unrolled_list<T, C, A>::push_front(const_reference value) {
+  emplace_front(value);
+}
+
+template <typename T, std::size_t C, typename A>
+void unrolled_list<T, C, A>::push_front(value_type &&value) {
+  emplace_front(std::move(value));
+}
+
+template <typename T, std::size_t C, typename A>
+template <class... Args>
+typename unrolled_list<T, C, A>::reference
+unrolled_list<T, C, A>::emplace_back(Args &&...args) {
+  Link *last = head_.prev;
+  if (last != &head_ && last->hi < C) {
+    T *value = ::new (static_cast<void *>(asChunk(last)->slot(last->hi)))
+        value_type(std::forward<Args>(args)...);
+    ++last->hi;
+    ++size_;
+    return *value;
+  }
+  Chunk *chunk = createChunk(0);
+  T *value;
+  try {
+    value = ::new (static_cast<void *>(chunk->slot(0)))
+        value_type(std::forward<Args>(args)...);
+  } catch (...) {
+    destroyChunk(chunk);
+    throw;
+  }
+  chunk->hi = 1;
+  linkBefore(&head_, chunk);
+  ++size_;
+  return *value;
+}
+
+template <typename T, std::size_t C, typename A>
+template <class... Args>
+typename unrolled_list<T, C, A>::reference
+unrolled_list<T, C, A>::emplace_front(Args &&...args) {
+  Link *first = head_.next;
+  if (first != &head_ && first->lo > 0) {
+    T *value = ::new (static_cast<void *>(asChunk(first)->slot(first->lo - 1)))
+        value_type(std::forward<Args>(args)...);
+    --first->lo;
+    ++size_;
+    return *value;
+  }
+  /* a new front chunk fills from its end */
+  Chunk *chunk = createChunk(C);
+  T *value;
+  try {
+    value = ::new (static_cast<void *>(chunk->slot(C - 1)))
+        value_type(std::forward<Args>(args)...);
+  } catch (...) {
+    destroyChunk(chunk);
+    throw;
+  }
+  chunk->lo = C - 1;
+  linkBefore(head_.next, chunk);
+  ++size_;
+  return *value;
+}
+
+template <typename T, std::size_t C, typename A>
+void unrolled_list<T, C, A>::pop_back() {
+  if (!size_) return;
+  Link *last = head_.prev;
+  asChunk(last)->slot(--last->hi)->~T();
+  --size_;
+  if (last->lo == last->hi) {
+    unlink(last);
+    destroyChunk(last);
+  }
+}
+
+template <typename T, std::size_t C, typename A>
+void unrolled_list<T, C, A>::pop_front() {
+  if (!size_) return;
+  Link *first = head_.next;
+  asChunk(first)->slot(first->lo++)->~T();
+  --size_;
+  if (first->lo == first->hi) {
+    unlink(first);
+    destroyChunk(first);
+  }
+}
+
+template <typename T, std::size_t C, typename A>
+typename unrolled_list<T, C, A>::iterator unrolled_list<T, C, A>::insert(
+    const_iterator pos, const_reference value) {
+  return emplace(pos, value);
+}
+
+template <typename T, std::size_t C, typename A>
+typename unrolled_list<T, C, A>::iterator unrolled_list<T, C, A>::insert(
+    const_iterator pos, value_type &&value) {
+  return emplace(pos, std::move(value));
+}
+
+template <typename T, std::size_t C, typename A>
+template <class... Args>
+typename unrolled_list<T, C, A>::iterator unrolled_list<T, C, A>::emplace(
+    const_iterator pos, Args &&...args) {
+  /* build the value first: args may refer to an element that shifts */
+  value_type value(std::forward<Args>(args)...);
+  iterator it = openSlot(pos);
+  try {
+    ::new (static_cast<void *>(&*it)) value_type(std::move(value));
+  } catch (...) {
+    closeSlot(it.link_, it.slot_);
+    throw;
+  }
+  ++size_;
+  return it;
+}
+
+template <typename T, std::size_t C, typename A>
+typename unrolled_list<T, C, A>::iterator unrolled_list<T, C, A>::erase(
+    const_iterator pos) {
+  Link *link = pos.link_;
+  size_type index = pos.slot_ - link->lo;
+  Link *next = link->next;
+  asChunk(link)->slot(pos.slot_)->~T();
+  --size_;
+  if (!closeSlot(link, pos.slot_)) return iterator(next, next->lo);
+  absorbNext(link);
+  return normalize(link, index);
+}
+
+template <typename T, std::size_t C, typename A>
+void unrolled_list<T, C, A>::clear() {
+  while (head_.next != &head_) dropChunk(head_.next);
+  size_ = 0;
+}
+
+template <typename T, std::size_t C, typename A>
+void unrolled_list<T, C, A>::swap(unrolled_list &other) noexcept {
+  swapStorage(other);
+  if (chunk_traits::propagate_on_container_swap::value) {
+    std::swap(alloc_, other.alloc_);
+  }
+}
+
+template <typename T, std::size_t C, typename A>
+void unrolled_list<T, C, A>::splice(const_iterator pos, unrolled_list &other) {
+  if (this == &other || other.empty()) return;
+  if (alloc_ != other.alloc_) {
+    /* chunks cannot change owners, move the values into our own memory */
+    unrolled_list tmp(get_allocator());
+    for (reference value : other) tmp.push_back(std::move(value));
+    other.clear();
+    splice(pos, tmp);
+    return;
+  }
+
+  Link *before = pos.link_;
+  if (before != &head_ && pos.slot_ != before->lo) {
+    before = splitChunk(before, pos.slot_);
+  }
+  Chain chain = other.detachAll();
+  chain.first->prev = before->prev;
+  before->prev->next = chain.first;
+  chain.last->next = before;
+  before->prev = chain.last;
+  size_ += chain.size;
+  chunks_ += chain.chunks;
+}
+
+template <typename T, std::size_t C, typename A>
+void unrolled_list<T, C, A>::merge(unrolled_list &other) {
+  if (this == &other || other.empty()) return;
+  if (alloc_ != other.alloc_) {
+    unrolled_list tmp(get_allocator());
+    for (reference value : other) tmp.push_back(std::move(value));
+    other.clear();
+    merge(tmp);
+    return;
+  }
+  Chain left = detachAll();
+  Chain right = other.detachAll();
+  attach(mergeChains(left, right));
+}
+
+template <typename T, std::size_t C, typename A>
+void unrolled_list<T, C, A>::reverse() {
+  Link *link = &head_;
+  do {
+    if (link != &head_) {
+      Chunk *chunk = asChunk(link);
+      std::reverse(chunk->slot(link->lo), chunk->slot(link->hi));
+    }
+    std::swap(link->prev, link->next);
+    link = link->prev; /* the old next */
+  } while (link != &head_);
+}
+
+template <typename T, std::size_t C, typename A>
+void unrolled_list<T, C, A>::unique() {
+  if (size_ < 2) return;
+  iterator last = std::unique(begin(), end());
+  if (last == end()) return;
+
+  /* drop everything from last on: the rest of its chunk, then whole
+   * chunks */
+  Link *link = last.link_;
+  for (size_type slot = last.slot_; slot < link->hi; ++slot) {
+    asChunk(link)->slot(slot)->~T();
+    --size_;
+  }
+  link->hi = last.slot_;
+  Link *next = link->next;
+  if (link->lo == link->hi) {
+    unlink(link);
+    destroyChunk(link);
+  }
+  while (next != &head_) {
+    link = next;
+    next = link->next;
+    size_ -= count(link);
+    dropChunk(link);
+  }
+}
+
+template <typename T, std::size_t C, typename A>
+void unrolled_list<T, C, A>::sort() {
+  if (size_ < 2) return;
+  /* bins[i] holds a sorted run of about 2^i chunks; a higher bin always
+   * holds earlier elements, so it is the left side of every merge */
+  Chain bins[std::numeric_limits<size_type>::digits] = {};
+  size_type used = 0;
+  Chain rest = detachAll();
+  Chain carry = {};
+  try {
+    while (rest.first) {
+      Link *link = rest.first;
+      rest.first = link->next;
+      link->next = nullptr;
+      if (rest.first) rest.first->prev = nullptr;
+      rest.size -= count(link);
+      --rest.chunks;
+      carry = Chain{link, link, count(link), 1};
+      std::stable_sort(asChunk(link)->slot(link->lo),
+                       asChunk(link)->slot(link->hi));
+
+      size_type i = 0;
+      for (; i < used && bins[i].first; ++i) {
+        Chain left = bins[i];
+        bins[i] = Chain{};
+        Chain right = carry;
+        carry = Chain{};
+        carry = mergeChains(left, right);
+      }
+      bins[i] = carry;
+      carry = Chain{};
+      if (i == used) ++used;
+    }
+    for (size_type i = 0; i < used; ++i) {
+      Chain left = bins[i];
+      bins[i] = Chain{};
+      Chain right = carry;
+      carry = Chain{};
+      carry = mergeChains(left, right);
+    }
+  } catch (...) {
+    /* mergeChains already put back the runs it was merging */
+    attach(carry);
+    for (size_type i = used; i-- > 0;) attach(bins[i]);
+    attach(rest);
+    throw;
+  }
+  attach(carry);
+}
+
+template <typename T, std::size_t C, typename A>
+template <class... Args>
+typename unrolled_list<T, C, A>::iterator unrolled_list<T, C, A>::insert_many(
+    const_iterator pos, Args &&...args) {
+  iterator it(pos.link_, pos.slot_);
+  ((it = std::next(emplace(it, std::forward<Args>(args)))), ...);
+  return it;
+}
+
+template <typename T, std::size_t C, typename A>
+template <class... Args>
+void unrolled_list<T, C, A>::insert_many_back(Args &&...args) {
+  (emplace_back(std::forward<Args>(args)), ...);
+}
+
+template <typename T, std::size_t C, typename A>
+template <class... Args>
+void unrolled_list<T, C, A>::insert_many_front(Args &&...args) {
+  (emplace_front(std::forward<Args>(args)), ...);
+}
+
+/* CHUNKS */
+template <typename T, std::size_t C, typename A>
+typename unrolled_list<T, C, A>::Chunk *unrolled_list<T, C, A>::createChunk(
+    size_type lo) {
+  Chunk *chunk = chunk_traits::allocate(alloc_, 1);
+  ::new (static_cast<void *>(chunk)) Chunk;
+  chunk->prev = chunk->next = nullptr;
+  chunk->lo = chunk->hi = lo;
+  return chunk;
+}
+
+template <typename T, std::size_t C, typename A>
+void unrolled_list<T, C, A>::destroyChunk(Link *link) {
+  Chunk *chunk = asChunk(link);
+  chunk->~Chunk();
+  chunk_traits::deallocate(alloc_, chunk, 1);
+}
+
+template <typename T, std::size_t C, typename A>
+void unrolled_list<T, C, A>::linkBefore(Link *pos, Link *link) {
+  link->next = pos;
+  link->prev = pos->prev;
+  pos->prev->next = link;
+  pos->prev = link;
+  ++chunks_;
+}
+
+template <typename T, std::size_t C, typename A>
+void unrolled_list<T, C, A>::unlink(Link *link) {
+  link->prev->next = link->next;
+  link->next->prev = link->prev;
+  --chunks_;
+}
+
+template <typename T, std::size_t C, typename A>
+void unrolled_list<T, C, A>::dropChunk(Link *link) {
+  std::destroy(asChunk(link)->slot(link->lo), asChunk(link)->slot(link->hi));
+  unlink(link);
+  destroyChunk(link);
+}
+
+template <typename T, std::size_t C, typename A>
+void unrolled_list<T, C, A>::adoptChunks() {
+  if (chunks_) {
+    head_.next->prev = &head_;
+    head_.prev->next = &head_;
+  } else {
+    head_.next = head_.prev = &head_;
+  }
+}
+
+template <typename T, std::size_t C, typename A>
+void unrolled_list<T, C, A>::swapStorage(unrolled_list &other) noexcept {
+  std::swap(head_, other.head_);
+  std::swap(size_, other.size_);
+  std::swap(chunks_, other.chunks_);
+  adoptChunks();
+  other.adoptChunks();
+}
+
+template <typename T, std::size_t C, typename A>
+typename unrolled_list<T, C, A>::iterator unrolled_list<T, C, A>::openSlot(
+    const_iterator pos) {
+  Link *link = pos.link_;
+  size_type slot = pos.slot_;
+  Link *prev = link->prev;
+  if (link == &head_ || slot == link->lo) {
+    /* between two chunks: use the room at either side of the gap */
+    if (prev != &head_ && prev->hi < C) return iterator(prev, prev->hi++);
+    if (link != &head_ && link->lo > 0) return iterator(link, --link->lo);
+    if (link == &head_) {
+      Chunk *chunk = createChunk(0);
+      linkBefore(&head_, chunk);
+      return iterator(chunk, chunk->hi++);
+    }
+  }
+
+  if (count(link) == C) {
+    Link *right = splitChunk(link, C / 2);
+    if (slot >= C / 2) {
+      link = right;
+      slot -= C / 2;
+    }
+  }
+
+  Chunk *chunk = asChunk(link);
+  bool room_front = link->lo > 0;
+  bool room_back = link->hi < C;
+  if (room_back && (!room_front || link->hi - slot <= slot - link->lo)) {
+    if (slot < link->hi) {
+      ::new (static_cast<void *>(chunk->slot(link->hi)))
+          value_type(std::move(*chunk->slot(link->hi - 1)));
+      std::move_backward(chunk->slot(slot), chunk->slot(link->hi - 1),
+                         chunk->slot(link->hi));
+      chunk->slot(slot)->~T();
+    }
+    ++link->hi;
+    return iterator(link, slot);
+  }
+  /* the new element goes right before slot, the front moves left */
+  ::new (static_cast<void *>(chunk->slot(link->lo - 1)))
+      value_type(std::move(*chunk->slot(link->lo)));
+  std::move(chunk->slot(link->lo + 1), chunk->slot(slot),
+            chunk->slot(link->lo));
+  chunk->slot(slot - 1)->~T();
+  --link->lo;
+  return iterator(link, slot - 1);
+}
+
+template <typename T, std::size_t C, typename A>
+bool unrolled_list<T, C, A>::closeSlot(Link *link, size_type slot) {
+  Chunk *chunk = asChunk(link);
+  if (slot == link->lo) {
+    ++link->lo;
+  } else if (slot + 1 == link->hi) {
+    --link->hi;
+  } else if (slot - link->lo < link->hi - 1 - slot) {
+    ::new (static_cast<void *>(chunk->slot(slot)))
+        value_type(std::move(*chunk->slot(slot - 1)));
+    std::move_backward(chunk->slot(link->lo), chunk->slot(slot - 1),
+                       chunk->slot(slot));
+    chunk->slot(link->lo)->~T();
+    ++link->lo;
+  } else {
+    ::new (static_cast<void *>(chunk->slot(slot)))
+        value_type(std::move(*chunk->slot(slot + 1)));
+    std::move(chunk->slot(slot + 2), chunk->slot(link->hi),
+              chunk->slot(slot + 1));
+    chunk->slot(link->hi - 1)->~T();
+    --link->hi;
+  }
+  if (link->lo < link->hi) return true;
+  unlink(link);
+  destroyChunk(link);
+  return false;
+}
+
+template <typename T, std::size_t C, typename A>
+typename unrolled_list<T, C, A>::Link *unrolled_list<T, C, A>::splitChunk(
+    Link *link, size_type slot) {
+  Chunk *chunk = asChunk(link);
+  Chunk *right = createChunk(0);
+  try {
+    std::uninitialized_move(chunk->slot(slot), chunk->slot(link->hi),
+                            right->slot(0));
+  } catch (...) {
+    destroyChunk(right);
+    throw;
+  }
+  std::destroy(chunk->slot(slot), chunk->slot(link->hi));
+  right->hi = link->hi - slot;
+  link->hi = slot;
+  linkBefore(link->next, right);
+  return right;
+}
+
+template <typename T, std::size_t C, typename A>
+typename unrolled_list<T, C, A>::iterator unrolled_list<T, C, A>::normalize(
+    Link *link, size_type index) {
+  if (link->lo + index < link->hi) return iterator(link, link->lo + index);
+  Link *next = link->next;
+  return iterator(next, next->lo);
+}
+
+template <typename T, std::size_t C, typename A>
+void unrolled_list<T, C, A>::absorbNext(Link *link) {
+  Link *next = link->next;
+  if (next == &head_ || count(link) + count(next) > C / 2) return;
+  Chunk *chunk = asChunk(link);
+  Chunk *source = asChunk(next);
+  if (link->hi + count(next) > C) {
+    /* slide the window to the start of the chunk */
+    size_type n = count(link);
+    for (size_type i = 0; i < n; ++i) {
+      ::new (static_cast<void *>(chunk->slot(i)))
+          value_type(std::move(*chunk->slot(link->lo + i)));
+      chunk->slot(link->lo + i)->~T();
+    }
+    link->lo = 0;
+    link->hi = n;
+  }
+  for (size_type i = next->lo; i < next->hi; ++i) {
+    ::new (static_cast<void *>(chunk->slot(link->hi)))
+        value_type(std::move(*source->slot(i)));
+    source->slot(i)->~T();
+    ++link->hi;
+    ++next->lo;
+  }
+  unlink(next);
+  destroyChunk(next);
+}
+
+/* CHAINS */
+template <typename T, std::size_t C, typename A>
+typename unrolled_list<T, C, A>::Chain unrolled_list<T, C, A>::detachAll() {
+  if (!chunks_) return Chain{};
+  Chain chain{head_.next, head_.prev, size_, chunks_};
+  chain.first->prev = nullptr;
+  chain.last->next = nullptr;
+  head_.next = head_.prev = &head_;
+  size_ = 0;
+  chunks_ = 0;
+  return chain;
+}
+
+template <typename T, std::size_t C, typename A>
+void unrolled_list<T, C, A>::attach(Chain chain) {
+  if (!chain.first) return;
+  chain.first->prev = head_.prev;
+  head_.prev->next = chain.first;
+  chain.last->next = &head_;
+  head_.prev = chain.last;
+  size_ += chain.size;
+  chunks_ += chain.chunks;
+}
+
+template <typename T, std::size_t C, typename A>
+typename unrolled_list<T, C, A>::Chain unrolled_list<T, C, A>::chainFrom(
+    Link *first) {
+  Chain chain{first, nullptr, 0, 0};
+  for (Link *link = first; link; link = link->next) {
+    chain.last = link;
+    chain.size += count(link);
+    ++chain.chunks;
+  }
+  if (first) first->prev = nullptr;
+  return chain;
+}
+
+template <typename T, std::size_t C, typename A>
+typename unrolled_list<T, C, A>::Chain unrolled_list<T, C, A>::mergeChains(
+    Chain left, Chain right) {
+  Chain out{};
+  Link *l = left.first;
+  Link *r = right.first;
+  try {
+    while (l && r) {
+      bool take_right = *asChunk(r)->slot(r->lo) < *asChunk(l)->slot(l->lo);
+      Link *&from = take_right ? r : l;
+      T *value = asChunk(from)->slot(from->lo);
+      appendTo(out, std::move(*value));
+      value->~T();
+      if (++from->lo == from->hi) {
+        Link *drained = from;
+        from = from->next;
+        destroyChunk(drained);
+      }
+    }
+  } catch (...) {
+    /* keep every element: the merged prefix, then both remainders */
+    attach(out);
+    attach(chainFrom(l));
+    attach(chainFrom(r));
+    throw;
+  }
+  /* the remainder is already sorted and keeps its chunks */
+  appendChain(out, chainFrom(l ? l : r));
+  return out;
+}
+
+template <typename T, std::size_t C, typename A>
+void unrolled_list<T, C, A>::appendTo(Chain &out, value_type &&value) {
+  Link *last = out.last;
+  if (last && last->hi < C) {
+    ::new (static_cast<void *>(asChunk(last)->slot(last->hi)))
+        value_type(std::move(value));
+    ++last->hi;
+  } else {
+    Chunk *chunk = createChunk(0);
+    try {
+      ::new (static_cast<void *>(chunk->slot(0))) value_type(std::move(value));
+    } catch (...) {
+      destroyChunk(chunk);
+      throw;
+    }
+    chunk->hi = 1;
+    chunk->prev = last;
+    if (last) {
+      last->next = chunk;
+    } else {
+      out.first = chunk;
+    }
+    out.last = chunk;
+    ++out.chunks;
+  }
+  ++out.size;
+}
+
+template <typename T, std::size_t C, typename A>
+void unrolled_list<T, C, A>::appendChain(Chain &out, Chain tail) {
+  if (!tail.first) return;
+  if (out.last) {
+    out.last->next = tail.first;
+    tail.first->prev = out.last;
+  } else {
+    out.first = tail.first;
+  }
+  out.last = tail.last;
+  out.size += tail.size;
+  out.chunks += tail.chunks;
+}
+
+}  // namespace s21
@@ -1,10 +1,17 @@
 #ifndef S21_CONTAINERS_H
 #define S21_CONTAINERS_H
 
+#include "libs/s21_containers/allocator/s21_allocator.h"
+#include "libs/s21_containers/deque/s21_deque.h"
+#include "libs/s21_containers/list/s21_intrusive_list.h"
 #include "libs/s21_containers/list/s21_list.h"
 #include "libs/s21_containers/map/s21_map.h"
+#include "libs/s21_containers/map/s21_persistent_map.h"
+#include "libs/s21_containers/parallel/s21_parallel.h"
+#include "libs/s21_containers/queue/s21_mpmc_queue.h"
 #include "libs/s21_containers/queue/s21_queue.h"
 #include "libs/s21_containers/set/s21_set.h"
+#include "libs/s21_containers/simd/s21_simd.h"
 #include "libs/s21_containers/stack/s21_stack.h"
 #include "libs/s21_containers/vector/s21_vector.h"
 
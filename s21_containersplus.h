@@ -2,5 +2,10 @@
 #define S21_CONTAINERSPLUS_H
 
 #include "libs/s21_containersplus/array/s21_array.h"
+#include "libs/s21_containersplus/flat_map/s21_flat_map.h"
+#include "libs/s21_containersplus/flat_set/s21_flat_set.h"
+#include "libs/s21_containersplus/unordered_map/s21_unordered_map.h"
+#include "libs/s21_containersplus/unordered_set/s21_unordered_set.h"
+#include "libs/s21_containersplus/unrolled_list/s21_unrolled_list.h"
 
 #endif // S21_CONTAINERSPLUS_H
\ No newline at end of file
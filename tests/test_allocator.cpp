@@ -0,0 +1,99 @@
+#include <map>
+#include <memory>
+
+#include "tests_init.h"
+
+TEST(allocator, PoolReusesFreedBlocks) {
+  s21::pool_resource pool;
+  void *first = pool.allocate(40, alignof(std::max_align_t));
+  void *second = pool.allocate(40, alignof(std::max_align_t));
+  EXPECT_NE(first, second);
+
+  pool.deallocate(first, 40, alignof(std::max_align_t));
+  EXPECT_EQ(pool.allocate(40, alignof(std::max_align_t)), first);
+
+  void *large = pool.allocate(4096, alignof(std::max_align_t));
+  EXPECT_NE(large, nullptr);
+  pool.deallocate(large, 4096, alignof(std::max_align_t));
+  pool.deallocate(second, 40, alignof(std::max_align_t));
+}
+
+TEST(allocator, ArenaAlignment) {
+  s21::arena_resource arena(64);
+  for (std::size_t align : {1u, 2u, 8u, 16u, 64u}) {
+    void *ptr = arena.allocate(3, align);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % align, 0u);
+  }
+  void *big = arena.allocate(1000, 8);
+  EXPECT_NE(big, nullptr);
+  arena.release();
+}
+
+TEST(allocator, AllocatorEquality) {
+  s21::pool_allocator<int> a;
+  s21::pool_allocator<int> b;
+  s21::pool_allocator<double> c(a);
+
+  EXPECT_TRUE(a == c);
+  EXPECT_FALSE(a == b);
+
+  s21::pool_allocator<int> moved(std::move(a));
+  EXPECT_TRUE(moved == c);
+  EXPECT_TRUE(a == c);
+}
+
+TEST(allocator, MapWithPoolAllocator) {
+  using alloc = s21::pool_allocator<std::pair<const int, std::string>>;
+  s21::map<int, std::string, alloc> s21_map;
+  std::map<int, std::string> std_map;
+
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 1000; ++i) {
+      s21_map[i] = std::to_string(i);
+      std_map[i] = std::to_string(i);
+    }
+    for (int i = 0; i < 1000; i += 3) {
+      s21_map.erase(s21_map.find(i));
+      std_map.erase(i);
+    }
+    EXPECT_EQ(s21_map.size(), std_map.size());
+    s21_map.clear();
+    std_map.clear();
+  }
+
+  s21_map.insert(1, "one");
+  s21::map<int, std::string, alloc> copy(s21_map);
+  EXPECT_TRUE(copy.get_allocator() == s21_map.get_allocator());
+  EXPECT_EQ(copy.at(1), "one");
+}
+
+TEST(allocator, SetWithArenaAllocator) {
+  s21::arena_allocator<int> alloc;
+  s21::set<int, s21::arena_allocator<int>> s21_set(alloc);
+  for (int i = 0; i < 500; ++i) s21_set.insert(i % 250);
+  EXPECT_EQ(s21_set.size(), 250);
+  EXPECT_EQ(*s21_set.nth_element(100), 100);
+}
+
+TEST(allocator, ListSpliceAcrossPools) {
+  using list = s21::list<int, s21::pool_allocator<int>>;
+  list first = {1, 3, 5};
+  list second = {2, 4};
+  EXPECT_FALSE(first.get_allocator() == second.get_allocator());
+
+  first.merge(second);
+  EXPECT_TRUE(second.empty());
+  EXPECT_EQ(first.size(), 5);
+
+  list third = {10, 11};
+  first.splice(first.begin(), third);
+  EXPECT_TRUE(third.empty());
+  EXPECT_EQ(first.front(), 10);
+  EXPECT_EQ(first.back(), 5);
+
+  list shared(first.get_allocator());
+  shared.push_back(7);
+  first.splice(first.begin(), shared);
+  EXPECT_EQ(first.front(), 7);
+  EXPECT_EQ(first.size(), 8);
+}
@@ -163,4 +163,25 @@ TEST(array, Fill) {
   for (size_t i = 0; i < s21_array.size(); i++) {
     EXPECT_EQ(s21_array[i], 10);
   }
-}
\ No newline at end of file
+}
+
+TEST(array, BulkScans) {
+  s21::array<int, 40> s21_array;
+  for (size_t i = 0; i < s21_array.size(); i++) {
+    s21_array[i] = int(i % 7) - 3;
+  }
+
+  EXPECT_EQ(s21_array.find(2), s21_array.begin() + 5);
+  EXPECT_EQ(s21_array.find(9), s21_array.end());
+  EXPECT_EQ(s21_array.count(-3), 6);
+  EXPECT_EQ(s21_array.min(), -3);
+  EXPECT_EQ(s21_array.max(), 3);
+  EXPECT_EQ(s21_array.sum(), -5);
+  EXPECT_EQ(s21_array.dot(s21_array), 155);
+
+  s21::array<int, 40> other(s21_array);
+  EXPECT_EQ(s21_array.compare(other), 0);
+  other[39] = 100;
+  EXPECT_EQ(s21_array.compare(other), -1);
+  EXPECT_EQ(other.compare(s21_array), 1);
+}
@@ -0,0 +1,225 @@
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <random>
+#include <string>
+
+#include "tests_init.h"
+
+TEST(deque, Constructors) {
+  s21::deque<int> empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(empty.begin(), empty.end());
+
+  s21::deque<int> sized(5);
+  EXPECT_EQ(sized.size(), 5);
+  EXPECT_EQ(std::count(sized.begin(), sized.end(), 0), 5);
+
+  s21::deque<std::string> items = {"a", "b", "c"};
+  s21::deque<std::string> copy(items);
+  s21::deque<std::string> moved(std::move(items));
+  EXPECT_TRUE(items.empty());
+  EXPECT_EQ(copy.size(), 3);
+  EXPECT_EQ(moved.front(), "a");
+  EXPECT_EQ(moved.back(), "c");
+
+  copy = {"x"};
+  moved = copy;
+  EXPECT_EQ(moved.size(), 1);
+  EXPECT_EQ(moved[0], "x");
+}
+
+TEST(deque, PushPopBothEnds) {
+  s21::deque<int> d;
+  for (int i = 0; i < 1000; ++i) {
+    d.push_back(i);
+    d.push_front(-i - 1);
+  }
+  ASSERT_EQ(d.size(), 2000);
+  for (int i = 0; i < 2000; ++i) EXPECT_EQ(d[i], i - 1000);
+  EXPECT_EQ(d.at(1999), 999);
+  EXPECT_THROW(d.at(2000), std::out_of_range);
+
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(d.front(), i - 1000);
+    d.pop_front();
+    EXPECT_EQ(d.back(), 999 - i);
+    d.pop_back();
+  }
+  EXPECT_TRUE(d.empty());
+  d.pop_front();
+  d.pop_back();
+  EXPECT_TRUE(d.empty());
+}
+
+TEST(deque, ReferencesStayValid) {
+  s21::deque<int> d;
+  d.push_back(42);
+  int &first = d.front();
+  for (int i = 0; i < 10000; ++i) {
+    d.push_back(i);
+    d.push_front(i);
+  }
+  EXPECT_EQ(first, 42);
+  EXPECT_EQ(&first, &d[10000]);
+}
+
+TEST(deque, RandomAccessIterators) {
+  s21::deque<int> d;
+  for (int i = 0; i < 300; ++i) d.push_front(i);
+  std::sort(d.begin(), d.end());
+  EXPECT_TRUE(std::is_sorted(d.cbegin(), d.cend()));
+  EXPECT_EQ(d.end() - d.begin(), 300);
+  EXPECT_EQ(*(d.begin() + 150), 150);
+  EXPECT_EQ(d.begin()[7], 7);
+
+  s21::deque<int>::const_iterator it = d.begin();
+  it += 299;
+  EXPECT_EQ(*it, 299);
+  EXPECT_TRUE(it < d.cend());
+  EXPECT_EQ(std::lower_bound(d.begin(), d.end(), 77) - d.begin(), 77);
+}
+
+TEST(deque, MatchesStdDeque) {
+  std::mt19937 gen(7);
+  s21::deque<int> d;
+  std::deque<int> expected;
+  for (int step = 0; step < 20000; ++step) {
+    int value = int(gen());
+    switch (gen() % 5) {
+      case 0:
+        d.push_back(value);
+        expected.push_back(value);
+        break;
+      case 1:
+        d.emplace_front(value);
+        expected.push_front(value);
+        break;
+      case 2:
+        if (!expected.empty()) expected.pop_back();
+        d.pop_back();
+        break;
+      case 3:
+        if (!expected.empty()) expected.pop_front();
+        d.pop_front();
+        break;
+      default:
+        if (step % 1000 == 0) d.shrink_to_fit();
+        d.insert_many_back(value, value + 1);
+        expected.push_back(value);
+        expected.push_back(value + 1);
+    }
+    ASSERT_EQ(d.size(), expected.size());
+  }
+  EXPECT_TRUE(std::equal(d.begin(), d.end(), expected.begin()));
+}
+
+TEST(deque, MoveOnlyAndClear) {
+  auto token = std::make_shared<int>(0);
+  s21::deque<std::shared_ptr<int>> d;
+  for (int i = 0; i < 100; ++i) d.emplace_back(token);
+  d.insert_many_front(token, token);
+  EXPECT_EQ(token.use_count(), 103);
+  d.clear();
+  EXPECT_EQ(token.use_count(), 1);
+  EXPECT_TRUE(d.empty());
+
+  s21::deque<std::unique_ptr<int>> owners;
+  owners.push_back(std::make_unique<int>(1));
+  owners.push_front(std::make_unique<int>(0));
+  s21::deque<std::unique_ptr<int>> other;
+  other.swap(owners);
+  EXPECT_EQ(*other.front(), 0);
+  EXPECT_EQ(*other.back(), 1);
+}
+
+/* Throws from the constructor on request */
+struct Fragile {
+  static bool fail;
+  int value;
+  Fragile(int v) : value(v) {
+    if (fail) throw std::runtime_error("fragile");
+  }
+};
+bool Fragile::fail = false;
+
+TEST(deque, ThrowingEmplaceLeavesDequeIntact) {
+  s21::deque<Fragile> d;
+  for (int i = 0; i < 64; ++i) d.emplace_back(i);
+  Fragile::fail = true;
+  EXPECT_THROW(d.emplace_back(64), std::runtime_error);
+  EXPECT_THROW(d.emplace_front(-1), std::runtime_error);
+  Fragile::fail = false;
+  EXPECT_EQ(d.size(), 64);
+  d.emplace_back(64);
+  EXPECT_EQ(d.back().value, 64);
+  EXPECT_EQ(d.front().value, 0);
+}
+
+namespace {
+long tagged_live[3] = {0, 0, 0};
+
+/* Unequal across tags and never propagated; counts blocks per tag, so a
+ * block freed through the wrong allocator shows up as a mismatch */
+template <typename T>
+struct TaggedAllocator {
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::false_type;
+  using propagate_on_container_move_assignment = std::false_type;
+  using propagate_on_container_swap = std::false_type;
+  using is_always_equal = std::false_type;
+
+  int tag;
+
+  explicit TaggedAllocator(int t = 0) : tag(t) {}
+  template <typename U>
+  TaggedAllocator(const TaggedAllocator<U> &other) : tag(other.tag) {}
+
+  T *allocate(size_t n) {
+    ++tagged_live[tag];
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *p, size_t n) {
+    --tagged_live[tag];
+    std::allocator<T>().deallocate(p, n);
+  }
+  bool operator==(const TaggedAllocator &other) const {
+    return tag == other.tag;
+  }
+  bool operator!=(const TaggedAllocator &other) const {
+    return tag != other.tag;
+  }
+};
+}  // namespace
+
+TEST(deque, AllocatorsStayUnlessPropagated) {
+  using tagged = s21::deque<std::string, TaggedAllocator<std::string>>;
+  static_assert(!std::is_nothrow_move_assignable<tagged>::value);
+  static_assert(std::is_nothrow_move_assignable<s21::deque<int>>::value);
+  {
+    tagged first(TaggedAllocator<std::string>(1));
+    tagged second(TaggedAllocator<std::string>(2));
+    for (int i = 0; i < 100; ++i) first.push_back(std::to_string(i));
+    second.push_back("x");
+
+    second = first;
+    EXPECT_EQ(second.get_allocator().tag, 2);
+    ASSERT_EQ(second.size(), 100);
+    EXPECT_EQ(second.back(), "99");
+
+    second.push_back("moved");
+    first = std::move(second);
+    EXPECT_EQ(first.get_allocator().tag, 1);
+    EXPECT_EQ(second.get_allocator().tag, 2);
+    ASSERT_EQ(first.size(), 101);
+    EXPECT_EQ(first.back(), "moved");
+    EXPECT_TRUE(second.empty());
+
+    tagged third(TaggedAllocator<std::string>(1));
+    third = std::move(first);
+    EXPECT_EQ(third.size(), 101);
+    EXPECT_EQ(third[50], "50");
+  }
+  EXPECT_EQ(tagged_live[1], 0);
+  EXPECT_EQ(tagged_live[2], 0);
+}
@@ -0,0 +1,110 @@
+#include <map>
+#include <string>
+
+#include "tests_init.h"
+
+TEST(flat_map, ConstructorSortsAndDeduplicates) {
+  s21::flat_map<int, std::string> s21_map{
+      {3, "three"}, {1, "one"}, {2, "two"}, {1, "uno"}};
+
+  ASSERT_EQ(s21_map.size(), 3);
+  EXPECT_EQ(s21_map.at(1), "one");
+  int expected = 1;
+  for (auto it = s21_map.begin(); it != s21_map.end(); ++it) {
+    EXPECT_EQ(it->first, expected++);
+  }
+}
+
+TEST(flat_map, AccessAndInsert) {
+  s21::flat_map<std::string, int> s21_map;
+
+  s21_map["b"] = 2;
+  s21_map["a"] = 1;
+  EXPECT_TRUE(s21_map.insert("c", 3).second);
+  EXPECT_FALSE(s21_map.insert("a", 10).second);
+  EXPECT_TRUE(s21_map.insert(std::make_pair(std::string("d"), 4)).second);
+  EXPECT_FALSE(s21_map.insert_or_assign("a", 10).second);
+
+  EXPECT_EQ(s21_map.size(), 4);
+  EXPECT_EQ(s21_map.at("a"), 10);
+  EXPECT_EQ(s21_map["d"], 4);
+  EXPECT_THROW(s21_map.at("z"), std::out_of_range);
+  EXPECT_TRUE(s21_map.contains("c"));
+  EXPECT_FALSE(s21_map.contains("z"));
+}
+
+TEST(flat_map, MatchesStdMap) {
+  s21::flat_map<int, int> s21_map;
+  std::map<int, int> std_map;
+
+  for (int i = 0; i < 2000; ++i) {
+    int key = (i * 7919) % 1009;
+    s21_map[key] += i;
+    std_map[key] += i;
+    if (i % 5 == 0) {
+      EXPECT_EQ(s21_map.erase(key / 2), std_map.erase(key / 2));
+    }
+  }
+
+  ASSERT_EQ(s21_map.size(), std_map.size());
+  auto it = s21_map.begin();
+  for (const auto &kv : std_map) {
+    EXPECT_EQ(it->first, kv.first);
+    EXPECT_EQ(it->second, kv.second);
+    ++it;
+  }
+  for (int key = -1; key <= 1010; ++key) {
+    EXPECT_EQ(s21_map.lower_bound(key) - s21_map.begin(),
+              std::distance(std_map.begin(), std_map.lower_bound(key)));
+    EXPECT_EQ(s21_map.upper_bound(key) - s21_map.begin(),
+              std::distance(std_map.begin(), std_map.upper_bound(key)));
+  }
+}
+
+TEST(flat_map, Merge) {
+  s21::flat_map<int, std::string> first{{1, "a"}, {3, "c"}};
+  s21::flat_map<int, std::string> second{{2, "b"}, {3, "x"}, {4, "d"}};
+
+  first.merge(second);
+
+  EXPECT_EQ(first.size(), 4);
+  EXPECT_EQ(first.at(3), "c");
+  ASSERT_EQ(second.size(), 1);
+  EXPECT_EQ(second.at(3), "x");
+}
+
+TEST(flat_map, InsertMany) {
+  s21::flat_map<int, std::string> s21_map{{2, "two"}};
+  auto result =
+      s21_map.insert_many(std::make_pair(3, "three"), std::make_pair(1, "one"),
+                          std::make_pair(2, "deux"), std::make_pair(1, "uno"));
+
+  ASSERT_EQ(result.size(), 4);
+  EXPECT_TRUE(result[0].second);
+  EXPECT_TRUE(result[1].second);
+  EXPECT_FALSE(result[2].second);
+  EXPECT_FALSE(result[3].second);
+  EXPECT_EQ(result[0].first->second, "three");
+  EXPECT_EQ(result[1].first->second, "one");
+  EXPECT_EQ(result[2].first->second, "two");
+  EXPECT_EQ(result[3].first->second, "one");
+  EXPECT_EQ(s21_map.size(), 3);
+}
+
+TEST(flat_map, EmptyLookups) {
+  const s21::flat_map<int, int> s21_map;
+  EXPECT_TRUE(s21_map.empty());
+  EXPECT_EQ(s21_map.find(1), s21_map.cend());
+  EXPECT_FALSE(s21_map.contains(1));
+  EXPECT_THROW(s21_map.at(1), std::out_of_range);
+}
+
+TEST(flat_map, RangeConstructorTakesIterators) {
+  static_assert(!std::is_constructible<s21::flat_map<int, int>, int,
+                                       int>::value);
+  static_assert(!std::is_constructible<s21::flat_set<int>, int, int>::value);
+  std::map<int, int> items{{2, 20}, {1, 10}};
+  s21::flat_map<int, int> s21_map(items.begin(), items.end());
+  ASSERT_EQ(s21_map.size(), 2);
+  EXPECT_EQ(s21_map.begin()->second, 10);
+}
@@ -0,0 +1,110 @@
+#include <iterator>
+#include <set>
+#include <sstream>
+
+#include "tests_init.h"
+
+namespace {
+int copies_left = -1; /* the copy that finds it at 0 throws, -1 never */
+
+/* Copies can fail and moves may throw, so merges have to copy it */
+struct Fragile {
+  int key;
+
+  explicit Fragile(int k) : key(k) {}
+  Fragile(const Fragile &other) : key(other.key) {
+    if (copies_left == 0) throw std::runtime_error("copy failed");
+    if (copies_left > 0) --copies_left;
+  }
+  Fragile(Fragile &&other) : key(other.key) { other.key = -1; }
+  Fragile &operator=(const Fragile &other) = default;
+  Fragile &operator=(Fragile &&other) = default;
+
+  bool operator<(const Fragile &other) const { return key < other.key; }
+};
+}  // namespace
+
+TEST(flat_set, RangeConstructor) {
+  std::vector<int> values{5, 1, 4, 1, 5, 9, 2, 6};
+  s21::flat_set<int> s21_set(values.begin(), values.end());
+  std::set<int> std_set(values.begin(), values.end());
+
+  ASSERT_EQ(s21_set.size(), std_set.size());
+  auto it = s21_set.begin();
+  for (int value : std_set) EXPECT_EQ(*it++, value);
+}
+
+TEST(flat_set, SinglePassRanges) {
+  std::istringstream in("5 1 4 1 5");
+  s21::flat_set<int> s21_set{std::istream_iterator<int>(in),
+                             std::istream_iterator<int>()};
+  ASSERT_EQ(s21_set.size(), 3);
+  EXPECT_EQ(*s21_set.begin(), 1);
+  EXPECT_EQ(*(s21_set.end() - 1), 5);
+
+  std::istringstream more("9 2 4");
+  s21_set.insert(std::istream_iterator<int>(more),
+                 std::istream_iterator<int>());
+  std::set<int> std_set{1, 2, 4, 5, 9};
+  ASSERT_EQ(s21_set.size(), std_set.size());
+  auto it = s21_set.begin();
+  for (int value : std_set) EXPECT_EQ(*it++, value);
+}
+
+TEST(flat_set, InsertEraseFind) {
+  s21::flat_set<std::string> s21_set;
+
+  EXPECT_TRUE(s21_set.insert("b").second);
+  EXPECT_TRUE(s21_set.emplace(3, 'a').second);
+  EXPECT_FALSE(s21_set.insert("b").second);
+  EXPECT_EQ(*s21_set.find("aaa"), "aaa");
+  EXPECT_EQ(s21_set.find("c"), s21_set.end());
+
+  auto next = s21_set.erase(s21_set.find("aaa"));
+  EXPECT_EQ(*next, "b");
+  EXPECT_EQ(s21_set.erase(std::string("zzz")), 0);
+  EXPECT_EQ(s21_set.size(), 1);
+}
+
+TEST(flat_set, MergeAndInsertMany) {
+  s21::flat_set<int> first{1, 3, 5};
+  s21::flat_set<int> second{2, 3, 4};
+
+  first.merge(second);
+  EXPECT_EQ(first.size(), 5);
+  EXPECT_EQ(second.size(), 1);
+  EXPECT_TRUE(second.contains(3));
+
+  auto results = first.insert_many(0, 6, 6, 2);
+  EXPECT_TRUE(results[0].second);
+  EXPECT_TRUE(results[1].second);
+  EXPECT_FALSE(results[2].second);
+  EXPECT_FALSE(results[3].second);
+  EXPECT_EQ(*results[3].first, 2);
+  EXPECT_EQ(first.size(), 7);
+
+  std::vector<int> more{10, 8, 6};
+  first.insert(more.begin(), more.end());
+  EXPECT_EQ(first.size(), 9);
+  EXPECT_EQ(*(first.end() - 1), 10);
+}
+
+TEST(flat_set, FailedMergeKeepsContents) {
+  s21::flat_set<Fragile> first, second;
+  for (int i = 0; i < 10; ++i) first.emplace(i * 2);
+  for (int i = 0; i < 10; ++i) second.emplace(i * 3);
+  std::vector<Fragile> extra{Fragile(5), Fragile(15)};
+
+  copies_left = 7;
+  EXPECT_THROW(first.insert(extra.begin(), extra.end()), std::runtime_error);
+  copies_left = 7;
+  EXPECT_THROW(first.merge(second), std::runtime_error);
+  copies_left = -1;
+
+  ASSERT_EQ(first.size(), 10);
+  ASSERT_EQ(second.size(), 10);
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(first.begin()[i].key, i * 2);
+    EXPECT_EQ(second.begin()[i].key, i * 3);
+  }
+}
@@ -0,0 +1,212 @@
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "tests_init.h"
+
+/* Element that can sit in two lists at once through separate hooks */
+struct Connection {
+  int id;
+  std::string peer;
+  s21::list_hook state_hook;
+  s21::list_hook timer_hook;
+
+  explicit Connection(int i = 0) : id(i), peer("peer" + std::to_string(i)) {}
+  bool operator<(const Connection& other) const { return id < other.id; }
+};
+
+using StateList = s21::intrusive_list<Connection, &Connection::state_hook>;
+using TimerList = s21::intrusive_list<Connection, &Connection::timer_hook>;
+
+template <typename List>
+static std::vector<int> ids(const List& list) {
+  std::vector<int> result;
+  for (const Connection& c : list) result.push_back(c.id);
+  /* the prev links must tell the same story backwards */
+  auto it = list.end();
+  for (size_t i = result.size(); i > 0; --i) {
+    --it;
+    if (it->id != result[i - 1]) return {};
+  }
+  return result;
+}
+
+TEST(intrusive_list, PushPopKeepsObjectsInPlace) {
+  std::vector<Connection> pool;
+  for (int i = 0; i < 5; ++i) pool.emplace_back(i);
+
+  StateList list;
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(list.begin(), list.end());
+  list.push_back(pool[2]);
+  list.push_back(pool[3]);
+  list.push_front(pool[1]);
+  list.insert(list.begin(), pool[0]);
+  list.insert(list.end(), pool[4]);
+  EXPECT_EQ(list.size(), 5);
+  EXPECT_EQ(ids(list), std::vector<int>({0, 1, 2, 3, 4}));
+  EXPECT_EQ(&list.front(), &pool[0]);
+  EXPECT_EQ(&list.back(), &pool[4]);
+  EXPECT_EQ(&*list.iterator_to(pool[3]), &pool[3]);
+
+  list.pop_front();
+  list.pop_back();
+  EXPECT_FALSE(pool[0].state_hook.is_linked());
+  EXPECT_FALSE(pool[4].state_hook.is_linked());
+  EXPECT_EQ(ids(list), std::vector<int>({1, 2, 3}));
+
+  auto next = list.erase(list.iterator_to(pool[2]));
+  EXPECT_EQ(next->id, 3);
+  EXPECT_EQ(ids(list), std::vector<int>({1, 3}));
+
+  list.clear();
+  list.pop_back();
+  EXPECT_TRUE(list.empty());
+  for (const Connection& c : pool) EXPECT_FALSE(c.state_hook.is_linked());
+}
+
+TEST(intrusive_list, RejectsLinkedElements) {
+  Connection a(1), b(2);
+  StateList first, second;
+  first.push_back(a);
+  EXPECT_THROW(first.push_back(a), std::invalid_argument);
+  EXPECT_THROW(second.push_front(a), std::invalid_argument);
+  EXPECT_EQ(first.size(), 1);
+  EXPECT_TRUE(second.empty());
+
+  /* copies of an element start unlinked */
+  Connection copy(a);
+  EXPECT_FALSE(copy.state_hook.is_linked());
+  b = a;
+  EXPECT_TRUE(a.state_hook.is_linked());
+  EXPECT_FALSE(b.state_hook.is_linked());
+  second.push_back(copy);
+  EXPECT_EQ(second.front().id, 1);
+}
+
+TEST(intrusive_list, OneElementInTwoLists) {
+  std::vector<Connection> pool;
+  for (int i = 0; i < 4; ++i) pool.emplace_back(i);
+  StateList active;
+  TimerList timers;
+  for (Connection& c : pool) active.push_back(c);
+  for (int i = 3; i >= 0; --i) timers.push_back(pool[i]);
+
+  active.erase(active.iterator_to(pool[1]));
+  EXPECT_EQ(ids(active), std::vector<int>({0, 2, 3}));
+  EXPECT_EQ(ids(timers), std::vector<int>({3, 2, 1, 0}));
+  EXPECT_TRUE(pool[1].timer_hook.is_linked());
+}
+
+TEST(intrusive_list, SpliceMovesBetweenStates) {
+  std::vector<Connection> pool;
+  for (int i = 0; i < 6; ++i) pool.emplace_back(i);
+  StateList idle, active, closing;
+  for (Connection& c : pool) idle.push_back(c);
+
+  auto it = idle.iterator_to(pool[2]);
+  active.splice(active.end(), idle, idle.iterator_to(pool[2]));
+  active.splice(active.end(), idle, idle.iterator_to(pool[4]));
+  EXPECT_EQ(it->id, 2); /* iterators follow their element */
+  EXPECT_EQ(ids(idle), std::vector<int>({0, 1, 3, 5}));
+  EXPECT_EQ(ids(active), std::vector<int>({2, 4}));
+
+  /* within one list: move 4 in front of 2, then a no-op */
+  active.splice(active.begin(), active, active.iterator_to(pool[4]));
+  active.splice(active.end(), active, active.iterator_to(pool[2]));
+  EXPECT_EQ(ids(active), std::vector<int>({4, 2}));
+  EXPECT_EQ(active.size(), 2);
+
+  auto first = idle.iterator_to(pool[1]);
+  auto last = idle.iterator_to(pool[5]);
+  closing.splice(closing.end(), idle, first, last);
+  EXPECT_EQ(ids(closing), std::vector<int>({1, 3}));
+  EXPECT_EQ(ids(idle), std::vector<int>({0, 5}));
+  EXPECT_EQ(idle.size(), 2);
+  EXPECT_EQ(closing.size(), 2);
+
+  closing.splice(closing.begin(), active);
+  EXPECT_TRUE(active.empty());
+  EXPECT_EQ(ids(closing), std::vector<int>({4, 2, 1, 3}));
+  closing.splice(closing.begin(), closing);
+  EXPECT_EQ(closing.size(), 4);
+}
+
+TEST(intrusive_list, MergeIsStable) {
+  std::vector<Connection> pool;
+  for (int i = 0; i < 10; ++i) pool.emplace_back(i);
+  StateList left, right;
+  /* left holds ids 0 2 4 6 8, right 1 2 5 9 */
+  pool[1].id = 1;
+  pool[3].id = 2;
+  pool[5].id = 5;
+  pool[7].id = 9;
+  for (int i : {0, 2, 4, 6, 8}) left.push_back(pool[i]);
+  for (int i : {1, 3, 5, 7}) right.push_back(pool[i]);
+  left.merge(right);
+  EXPECT_TRUE(right.empty());
+  EXPECT_EQ(left.size(), 9);
+  EXPECT_EQ(ids(left), std::vector<int>({0, 1, 2, 2, 4, 5, 6, 8, 9}));
+  /* the 2 from left comes first */
+  auto it = ++++left.begin();
+  EXPECT_EQ(&*it, &pool[2]);
+
+  Connection high(9), middle(5), low(1);
+  StateList descending, others;
+  descending.push_back(high);
+  descending.push_back(low);
+  others.push_back(middle);
+  auto greater = [](const Connection& a, const Connection& b) {
+    return b < a;
+  };
+  descending.merge(others, greater);
+  EXPECT_EQ(ids(descending), std::vector<int>({9, 5, 1}));
+}
+
+TEST(intrusive_list, MergeKeepsElementsWhenCompareThrows) {
+  std::vector<Connection> pool;
+  for (int i = 0; i < 8; ++i) pool.emplace_back(i);
+  StateList left, right;
+  for (int i = 0; i < 8; i += 2) left.push_back(pool[i]);
+  for (int i = 1; i < 8; i += 2) right.push_back(pool[i]);
+  int calls = 0;
+  auto throwing = [&calls](const Connection& a, const Connection& b) {
+    if (++calls == 4) throw std::runtime_error("compare");
+    return a < b;
+  };
+  EXPECT_THROW(left.merge(right, throwing), std::runtime_error);
+  EXPECT_EQ(left.size() + right.size(), 8);
+  EXPECT_EQ(ids(left).size(), left.size());
+  EXPECT_EQ(ids(right).size(), right.size());
+}
+
+TEST(intrusive_list, MoveAndSwap) {
+  std::vector<Connection> pool;
+  for (int i = 0; i < 4; ++i) pool.emplace_back(i);
+  StateList a;
+  a.push_back(pool[0]);
+  a.push_back(pool[1]);
+  StateList b(std::move(a));
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(ids(b), std::vector<int>({0, 1}));
+
+  StateList c;
+  c.push_back(pool[2]);
+  c = std::move(b);
+  EXPECT_FALSE(pool[2].state_hook.is_linked());
+  EXPECT_EQ(ids(c), std::vector<int>({0, 1}));
+
+  StateList d;
+  d.push_back(pool[3]);
+  d.swap(c);
+  EXPECT_EQ(ids(c), std::vector<int>({3}));
+  EXPECT_EQ(ids(d), std::vector<int>({0, 1}));
+  d.swap(d);
+  EXPECT_EQ(ids(d), std::vector<int>({0, 1}));
+
+  {
+    StateList scoped;
+    scoped.push_back(pool[2]);
+  }
+  EXPECT_FALSE(pool[2].state_hook.is_linked());
+}
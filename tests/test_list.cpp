@@ -1,4 +1,8 @@
+#include <algorithm>
+#include <functional>
 #include <list>
+#include <random>
+#include <vector>
 
 #include "tests_init.h"
 
@@ -292,3 +296,160 @@ TEST(list, InsertManyFront) {
 
   EXPECT_EQ(test_list.size(), expected_list.size());
 }
+
+TEST(list, MoveOnlyElements) {
+  s21::list<std::unique_ptr<int>> test_list;
+  test_list.push_back(std::make_unique<int>(2));
+  test_list.push_front(std::make_unique<int>(1));
+  test_list.emplace_back(new int(4));
+  auto last = test_list.begin();
+  ++last;
+  ++last;
+  test_list.emplace(last, new int(3));
+
+  ASSERT_EQ(test_list.size(), 4);
+  int expected = 1;
+  for (auto it = test_list.begin(); it != test_list.end(); ++it) {
+    EXPECT_EQ(**it, expected++);
+  }
+}
+
+TEST(list, EmplaceAtEnd) {
+  s21::list<std::string> test_list;
+  test_list.emplace(test_list.end(), 3, 'a');
+  test_list.insert_many(test_list.end(), "b", std::string("c"));
+
+  ASSERT_EQ(test_list.size(), 3);
+  EXPECT_EQ(test_list.front(), "aaa");
+  EXPECT_EQ(test_list.back(), "c");
+}
+
+/* Compares by key only, so the sort's stability is observable */
+struct Keyed {
+  int key;
+  int order;
+};
+
+static bool byKey(const Keyed& a, const Keyed& b) { return a.key < b.key; }
+
+template <typename List>
+static bool sameAs(List& list, const std::list<Keyed>& expected) {
+  if (list.size() != expected.size()) return false;
+  auto it = expected.begin();
+  for (const Keyed& value : list) {
+    if (value.key != it->key || value.order != it->order) return false;
+    ++it;
+  }
+  /* walk back through the prev links from the last element */
+  auto back = list.begin();
+  for (size_t i = 1; i < list.size(); ++i) ++back;
+  for (auto rit = expected.rbegin(); rit != expected.rend(); ++rit, --back) {
+    if ((*back).order != rit->order) return false;
+  }
+  return true;
+}
+
+TEST(list, SortStableWithRuns) {
+  std::mt19937 gen(9);
+  s21::list<Keyed> s21_list;
+  std::list<Keyed> std_list;
+  for (int i = 0; i < 20000; ++i) {
+    /* ascending and descending stretches mixed with noise */
+    int key = i % 3000 < 1000 ? i : i % 3000 < 2000 ? -i : int(gen() % 50);
+    s21_list.push_back({key, i});
+    std_list.push_back({key, i});
+  }
+  s21_list.sort(byKey);
+  std_list.sort(byKey);
+  EXPECT_TRUE(sameAs(s21_list, std_list));
+  EXPECT_EQ(s21_list.back().key, std_list.back().key);
+
+  s21::list<Keyed> descending;
+  for (int i = 0; i < 100; ++i) descending.push_front({i / 2, i});
+  descending.sort(byKey);
+  /* (0, 1) was pushed after (0, 0), so it sits first and stays first */
+  EXPECT_EQ(descending.front().order, 1);
+  EXPECT_EQ(descending.back().key, 49);
+}
+
+TEST(list, SortWithCompareAndMerge) {
+  s21::list<int> left = {9, 7, 5, 3};
+  s21::list<int> right = {8, 6, 4, 2, 1};
+  left.sort(std::greater<int>());
+  right.merge(left, std::greater<int>());
+  EXPECT_TRUE(left.empty());
+  ASSERT_EQ(right.size(), 9);
+  int expected = 9;
+  for (int value : right) EXPECT_EQ(value, expected--);
+  EXPECT_EQ(right.back(), 1);
+  right.push_back(0);
+  EXPECT_EQ(right.size(), 10);
+}
+
+TEST(list, ParallelSort) {
+  std::mt19937 gen(4);
+  s21::list<Keyed> s21_list;
+  std::list<Keyed> std_list;
+  for (int i = 0; i < 100000; ++i) {
+    int key = int(gen() % 1000);
+    s21_list.push_back({key, i});
+    std_list.push_back({key, i});
+  }
+  s21_list.parallel_sort(byKey, 4);
+  std_list.sort(byKey);
+  EXPECT_TRUE(sameAs(s21_list, std_list));
+
+  s21::list<int> small = {3, 1, 2};
+  small.parallel_sort();
+  EXPECT_EQ(small.front(), 1);
+  EXPECT_EQ(small.back(), 3);
+}
+
+TEST(list, SortKeepsElementsWhenCompareThrows) {
+  /* throw while building a run, in an early merge and in a late one */
+  std::vector<int> shuffled(1000);
+  for (int i = 0; i < 1000; ++i) shuffled[i] = i;
+  std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(3));
+  for (int throw_at : {5, 700, 6000}) {
+    s21::list<int> list;
+    for (int value : shuffled) list.push_back(value);
+    int calls = 0;
+    auto throwing = [&calls, throw_at](int a, int b) {
+      if (++calls == throw_at) throw std::runtime_error("compare");
+      return a < b;
+    };
+    EXPECT_THROW(list.sort(throwing), std::runtime_error);
+    ASSERT_EQ(list.size(), 1000);
+    std::vector<int> values;
+    for (int value : list) values.push_back(value);
+    std::sort(values.begin(), values.end());
+    for (int i = 0; i < 1000; ++i) EXPECT_EQ(values[i], i);
+
+    list.sort();
+    EXPECT_EQ(list.front(), 0);
+    EXPECT_EQ(list.back(), 999);
+    list.pop_back();
+    EXPECT_EQ(list.back(), 998);
+  }
+}
+
+TEST(list, SwapRelinksNodes) {
+  using list = s21::list<int, s21::pool_allocator<int>>;
+  static_assert(noexcept(std::declval<list&>().swap(std::declval<list&>())));
+  list first = {1, 2, 3};
+  list second = {4, 5};
+  const int* front = &first.front();
+  auto first_alloc = first.get_allocator();
+
+  first.swap(second);
+  EXPECT_EQ(&second.front(), front);
+  EXPECT_TRUE(second.get_allocator() == first_alloc);
+  EXPECT_FALSE(first.get_allocator() == first_alloc);
+  ASSERT_EQ(first.size(), 2);
+  EXPECT_EQ(first.back(), 5);
+
+  second.push_back(6);
+  first.push_back(7);
+  EXPECT_EQ(second.size(), 4);
+  EXPECT_EQ(first.back(), 7);
+}
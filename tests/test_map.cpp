@@ -1,4 +1,6 @@
 #include <map>
+#include <memory>
+#include <vector>
 
 #include "tests_init.h"
 
@@ -258,3 +260,303 @@ TEST(map, InsertMany) {
 
   EXPECT_EQ(myMap.size(), 3);
 }
+
+TEST(map, OrderStatistics) {
+  s21::map<int, char> s21_map;
+  for (int i = 0; i < 100; ++i) s21_map.insert(i * 2, 'a');
+
+  EXPECT_EQ((*s21_map.nth_element(0)).first, 0);
+  EXPECT_EQ((*s21_map.nth_element(50)).first, 100);
+  EXPECT_EQ((*s21_map.nth_element(99)).first, 198);
+  EXPECT_TRUE(s21_map.nth_element(100) == s21_map.end());
+
+  EXPECT_EQ(s21_map.rank(0), 0);
+  EXPECT_EQ(s21_map.rank(11), 6);
+  EXPECT_EQ(s21_map.rank(1000), 100);
+
+  EXPECT_EQ(s21_map.count_range(10, 20), 5);
+  EXPECT_EQ(s21_map.count_range(20, 10), 0);
+
+  for (int i = 0; i < 100; i += 2) s21_map.erase(s21_map.find(i * 2));
+  EXPECT_EQ(s21_map.size(), 50);
+  EXPECT_EQ((*s21_map.nth_element(0)).first, 2);
+  EXPECT_EQ(s21_map.rank(11), 3);
+}
+
+TEST(map, TryEmplace) {
+  s21::map<int, std::string> s21_map;
+  std::map<int, std::string> std_map;
+
+  auto s21_res = s21_map.try_emplace(1, 3, 'x');
+  auto std_res = std_map.try_emplace(1, 3, 'x');
+  EXPECT_EQ((*s21_res.first).second, (*std_res.first).second);
+  EXPECT_EQ(s21_res.second, std_res.second);
+
+  s21_res = s21_map.try_emplace(1, "other");
+  std_res = std_map.try_emplace(1, "other");
+  EXPECT_EQ((*s21_res.first).second, (*std_res.first).second);
+  EXPECT_EQ(s21_res.second, std_res.second);
+  EXPECT_EQ(s21_map.size(), std_map.size());
+}
+
+TEST(map, EmplaceHint) {
+  s21::map<int, int> s21_map;
+  for (int i = 0; i < 50; ++i) {
+    auto it = s21_map.emplace_hint(s21_map.end(), i, i * 10);
+    EXPECT_EQ((*it).first, i);
+  }
+  auto it = s21_map.emplace_hint(s21_map.begin(), 25, 0);
+  EXPECT_EQ((*it).second, 250);
+  s21_map.emplace_hint(s21_map.find(10), -1, -10);
+
+  EXPECT_EQ(s21_map.size(), 51);
+  int expected = -1;
+  for (auto iter = s21_map.begin(); iter != s21_map.end(); ++iter) {
+    EXPECT_EQ((*iter).first, expected);
+    expected = expected < 0 ? 0 : expected + 1;
+  }
+}
+
+TEST(map, InsertOrAssign) {
+  s21::map<int, char> s21_map = {{1, 'a'}, {2, 'b'}};
+  std::map<int, char> std_map = {{1, 'a'}, {2, 'b'}};
+
+  auto s21_res = s21_map.insert_or_assign(1, 'z');
+  auto std_res = std_map.insert_or_assign(1, 'z');
+  EXPECT_EQ(s21_res.second, std_res.second);
+  EXPECT_EQ((*s21_res.first).second, 'z');
+  EXPECT_EQ(s21_map.at(1), 'z');
+  EXPECT_EQ(s21_map.size(), std_map.size());
+}
+
+TEST(map, IteratorSeesAssignedValues) {
+  s21::map<int, std::string> s21_map = {{1, "one"}, {2, "two"}};
+
+  s21_map[1] = "uno";
+  s21_map.at(2) = "dos";
+  (*s21_map.find(1)).second += "!";
+
+  auto it = s21_map.begin();
+  EXPECT_EQ((*it).second, "uno!");
+  ++it;
+  EXPECT_EQ((*it).second, "dos");
+  EXPECT_EQ(s21_map[1], "uno!");
+}
+
+TEST(map, MoveOnlyValues) {
+  s21::map<std::string, std::unique_ptr<int>> s21_map;
+  std::string key(50, 'k');
+
+  s21_map[std::move(key)] = std::make_unique<int>(1);
+  EXPECT_TRUE(key.empty());
+
+  s21_map.insert("a", std::make_unique<int>(2));
+  s21_map.emplace("b", std::make_unique<int>(3));
+  s21_map.try_emplace(std::string("c"), new int(4));
+  s21_map.insert_or_assign("a", std::make_unique<int>(5));
+
+  EXPECT_EQ(s21_map.size(), 4);
+  EXPECT_EQ(*s21_map.at(std::string(50, 'k')), 1);
+  EXPECT_EQ(*s21_map.at("a"), 5);
+  EXPECT_EQ(*s21_map.at("b"), 3);
+  EXPECT_EQ(*s21_map.at("c"), 4);
+}
+
+TEST(map, InsertManyForwards) {
+  s21::map<int, std::unique_ptr<int>> s21_map;
+  auto result = s21_map.insert_many(
+      std::make_pair(1, std::make_unique<int>(10)),
+      std::make_pair(1, std::make_unique<int>(20)));
+
+  ASSERT_EQ(result.size(), 2);
+  EXPECT_TRUE(result[0].second);
+  EXPECT_FALSE(result[1].second);
+  EXPECT_EQ(*s21_map.at(1), 10);
+}
+
+TEST(map, EndIsBidirectional) {
+  s21::map<int, int> s21_map;
+  EXPECT_TRUE(s21_map.begin() == s21_map.end());
+
+  std::map<int, int> std_map;
+  for (int i = 0; i < 200; ++i) {
+    int key = (i * 37) % 101;
+    s21_map.insert(key, i);
+    std_map.insert({key, i});
+    if (i % 3 == 0) {
+      s21_map.erase(s21_map.begin());
+      std_map.erase(std_map.begin());
+    }
+    if (i % 5 == 0 && !std_map.empty()) {
+      s21_map.erase(--s21_map.end());
+      std_map.erase(--std_map.end());
+    }
+  }
+
+  ASSERT_EQ(s21_map.size(), std_map.size());
+  auto s21_it = s21_map.end();
+  for (auto std_it = std_map.rbegin(); std_it != std_map.rend(); ++std_it) {
+    --s21_it;
+    EXPECT_EQ((*s21_it).first, std_it->first);
+  }
+  EXPECT_TRUE(s21_it == s21_map.begin());
+}
+
+TEST(map, SwapKeepsEnds) {
+  s21::map<int, int> a = {{1, 1}, {2, 2}};
+  s21::map<int, int> b;
+  a.swap(b);
+  EXPECT_TRUE(a.begin() == a.end());
+  EXPECT_EQ((*b.begin()).first, 1);
+  EXPECT_EQ((*--b.end()).first, 2);
+
+  s21::map<int, int> c(std::move(b));
+  EXPECT_TRUE(b.begin() == b.end());
+  EXPECT_EQ((*--c.end()).first, 2);
+  c.erase(c.begin());
+  c.erase(c.begin());
+  EXPECT_TRUE(c.begin() == c.end());
+  EXPECT_TRUE(c.empty());
+}
+
+TEST(map, BoundsAndRange) {
+  s21::map<int, int> s21_map;
+  std::map<int, int> std_map;
+  for (int i = 0; i < 100; i += 10) {
+    s21_map.insert(i, i / 10);
+    std_map.insert({i, i / 10});
+  }
+
+  for (int key = -5; key <= 100; ++key) {
+    auto lower = s21_map.lower_bound(key);
+    auto upper = s21_map.upper_bound(key);
+    auto std_lower = std_map.lower_bound(key);
+    auto std_upper = std_map.upper_bound(key);
+    if (std_lower == std_map.end()) {
+      EXPECT_TRUE(lower == s21_map.end());
+    } else {
+      EXPECT_EQ((*lower).first, std_lower->first);
+    }
+    if (std_upper == std_map.end()) {
+      EXPECT_TRUE(upper == s21_map.end());
+    } else {
+      EXPECT_EQ((*upper).first, std_upper->first);
+    }
+    auto eq = s21_map.equal_range(key);
+    EXPECT_TRUE(eq.first == lower);
+    EXPECT_TRUE(eq.second == upper);
+  }
+
+  std::vector<int> keys;
+  for (auto &kv : s21_map.range(15, 50)) keys.push_back(kv.first);
+  EXPECT_EQ(keys, (std::vector<int>{20, 30, 40}));
+
+  for (auto &kv : s21_map.range(20, 40)) kv.second = -1;
+  EXPECT_EQ(s21_map.at(20), -1);
+  EXPECT_EQ(s21_map.at(30), -1);
+  EXPECT_EQ(s21_map.at(40), 4);
+
+  EXPECT_TRUE(s21_map.range(50, 20).empty());
+  EXPECT_TRUE(s21_map.range(91, 1000).empty());
+  const s21::map<int, int> &const_map = s21_map;
+  EXPECT_FALSE(const_map.range(0, 1).empty());
+  EXPECT_EQ((*const_map.lower_bound(85)).first, 90);
+}
+
+TEST(map, SortedBuildKeepsFirstDuplicate) {
+  s21::map<int, char> s21_map = {{1, 'a'}, {2, 'b'}, {2, 'x'}, {3, 'c'}};
+  EXPECT_EQ(s21_map.size(), 3);
+  EXPECT_EQ(s21_map.at(2), 'b');
+
+  std::vector<std::pair<int, char>> items = {{5, 'e'}, {6, 'f'}};
+  s21::map<int, char> from_range(items.begin(), items.end());
+  EXPECT_EQ(from_range.at(6), 'f');
+  from_range.assign_sorted(items.begin(), items.begin());
+  EXPECT_TRUE(from_range.empty());
+}
+
+TEST(map, SplitAndMerge) {
+  s21::map<int, char> s21_map = {{1, 'a'}, {2, 'b'}, {3, 'c'}, {4, 'd'}};
+  s21::map<int, char> upper = s21_map.split(3);
+  EXPECT_EQ(s21_map.size(), 2);
+  EXPECT_EQ(upper.size(), 2);
+  EXPECT_EQ((*upper.begin()).first, 3);
+
+  upper[1] = 'x';
+  s21_map.merge(upper);
+  EXPECT_EQ(s21_map.size(), 4);
+  EXPECT_EQ(s21_map.at(1), 'a');
+  EXPECT_EQ(s21_map.at(4), 'd');
+  ASSERT_EQ(upper.size(), 1);
+  EXPECT_EQ(upper.at(1), 'x');
+
+  s21_map.set_intersection(upper);
+  ASSERT_EQ(s21_map.size(), 1);
+  EXPECT_EQ(s21_map.at(1), 'a');
+}
+
+namespace {
+long tagged_live[3] = {0, 0, 0};
+
+/* Unequal across tags and never propagated; counts blocks per tag, so a
+ * block freed through the wrong allocator shows up as a mismatch */
+template <typename T>
+struct TaggedAllocator {
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::false_type;
+  using propagate_on_container_move_assignment = std::false_type;
+  using propagate_on_container_swap = std::false_type;
+  using is_always_equal = std::false_type;
+
+  int tag;
+
+  explicit TaggedAllocator(int t = 0) : tag(t) {}
+  template <typename U>
+  TaggedAllocator(const TaggedAllocator<U> &other) : tag(other.tag) {}
+
+  T *allocate(size_t n) {
+    ++tagged_live[tag];
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *p, size_t n) {
+    --tagged_live[tag];
+    std::allocator<T>().deallocate(p, n);
+  }
+  bool operator==(const TaggedAllocator &other) const {
+    return tag == other.tag;
+  }
+  bool operator!=(const TaggedAllocator &other) const {
+    return tag != other.tag;
+  }
+};
+}  // namespace
+
+TEST(map, MoveAssignMoveOnlyValues) {
+  using pointers = s21::map<int, std::unique_ptr<int>>;
+  static_assert(std::is_nothrow_move_assignable<pointers>::value);
+  pointers first, second;
+  first.emplace(1, std::make_unique<int>(10));
+  second = std::move(first);
+  EXPECT_TRUE(first.empty());
+  EXPECT_EQ(*second.at(1), 10);
+
+  using value = std::pair<const int, std::unique_ptr<int>>;
+  using tagged =
+      s21::map<int, std::unique_ptr<int>, TaggedAllocator<value>>;
+  static_assert(!std::is_nothrow_move_assignable<tagged>::value);
+  {
+    tagged source(TaggedAllocator<value>(1));
+    tagged target(TaggedAllocator<value>(2));
+    for (int i = 0; i < 50; ++i) source.emplace(i, std::make_unique<int>(i));
+    target.emplace(100, std::make_unique<int>(100));
+
+    target = std::move(source);
+    EXPECT_EQ(target.get_allocator().tag, 2);
+    EXPECT_TRUE(source.empty());
+    ASSERT_EQ(target.size(), 50);
+    EXPECT_EQ(*target.at(49), 49);
+    EXPECT_FALSE(target.contains(100));
+    EXPECT_EQ(tagged_live[1], 0);
+  }
+  EXPECT_EQ(tagged_live[2], 0);
+}
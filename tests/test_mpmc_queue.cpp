@@ -0,0 +1,118 @@
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tests_init.h"
+
+TEST(mpmc_queue, FifoAndCapacity) {
+  s21::mpmc_queue<int> q(5);
+  EXPECT_EQ(q.capacity(), 8);
+  EXPECT_TRUE(q.empty());
+
+  for (int i = 0; i < 8; ++i) EXPECT_TRUE(q.try_push(i));
+  EXPECT_FALSE(q.try_push(8));
+  EXPECT_EQ(q.size(), 8);
+
+  int value = -1;
+  for (int i = 0; i < 8; ++i) {
+    ASSERT_TRUE(q.try_pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(q.try_pop(value));
+  EXPECT_THROW(s21::mpmc_queue<int>(0), std::invalid_argument);
+}
+
+TEST(mpmc_queue, WrapsAroundWithBulk) {
+  s21::spsc_queue<std::string> q(4);
+  std::vector<std::string> in = {"a", "b", "c", "d", "e", "f"};
+  std::vector<std::string> out(6);
+
+  auto source = std::make_move_iterator(in.begin());
+
+  EXPECT_EQ(q.push_bulk(source, 3), 3);
+  EXPECT_EQ(q.pop_bulk(out.begin(), 2), 2);
+  EXPECT_EQ(q.push_bulk(source + 3, 3), 3);
+  EXPECT_EQ(q.push_bulk(source, 1), 0);
+  EXPECT_EQ(q.pop_bulk(out.begin() + 2, 10), 4);
+  EXPECT_EQ(out, (std::vector<std::string>{"a", "b", "c", "d", "e", "f"}));
+
+  q.insert_many_back("x", std::string(20, 'y'));
+  std::string value;
+  q.pop(value);
+  EXPECT_EQ(value, "x");
+}
+
+TEST(mpmc_queue, DestroysLeftovers) {
+  auto token = std::make_shared<int>(1);
+  {
+    s21::mpsc_queue<std::shared_ptr<int>> q(4);
+    q.try_push(token);
+    q.try_emplace(token);
+    EXPECT_EQ(token.use_count(), 3);
+  }
+  EXPECT_EQ(token.use_count(), 1);
+}
+
+/* Producers push their values in bulk, consumers pop until they see a
+ * negative end marker. */
+template <class Queue>
+void runProducersConsumers(int producers, int consumers) {
+  const int kPerProducer = 20000;
+  Queue q(64);
+  std::vector<long long> sums(consumers, 0);
+  std::vector<int> order_errors(consumers, 0);
+  std::vector<std::thread> threads;
+
+  for (int c = 0; c < consumers; ++c) {
+    threads.emplace_back([&, c] {
+      /* values of one producer must arrive in order at every consumer */
+      std::vector<int> last(producers, -1);
+      int value = 0;
+      for (q.pop(value); value >= 0; q.pop(value)) {
+        sums[c] += value;
+        int p = value / kPerProducer;
+        if (value <= last[p]) ++order_errors[c];
+        last[p] = value;
+      }
+    });
+  }
+  std::vector<std::thread> writers;
+  for (int p = 0; p < producers; ++p) {
+    writers.emplace_back([&, p] {
+      int batch[16];
+      for (int i = 0; i < kPerProducer;) {
+        int n = std::min(16, kPerProducer - i);
+        for (int k = 0; k < n; ++k) batch[k] = p * kPerProducer + i + k;
+        size_t pushed = q.push_bulk(batch, n);
+        if (!pushed) q.push(batch[pushed++]);
+        i += int(pushed);
+      }
+    });
+  }
+  for (auto &writer : writers) writer.join();
+  for (int c = 0; c < consumers; ++c) q.push(-1);
+  for (auto &thread : threads) thread.join();
+
+  long long total = (long long)producers * kPerProducer, sum = 0;
+  for (int c = 0; c < consumers; ++c) {
+    sum += sums[c];
+    EXPECT_EQ(order_errors[c], 0);
+  }
+  EXPECT_EQ(sum, total * (total - 1) / 2);
+  EXPECT_TRUE(q.empty());
+}
+
+TEST(mpmc_queue, SingleProducerSingleConsumer) {
+  runProducersConsumers<s21::spsc_queue<int>>(1, 1);
+}
+
+TEST(mpmc_queue, ManyProducersSingleConsumer) {
+  runProducersConsumers<s21::mpsc_queue<int>>(4, 1);
+}
+
+TEST(mpmc_queue, ManyProducersManyConsumers) {
+  runProducersConsumers<s21::mpmc_queue<int>>(3, 3);
+}
@@ -0,0 +1,186 @@
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "tests_init.h"
+
+/* More threads than cores is fine: the point is the scheduling */
+static s21::parallel::thread_pool& testPool() {
+  static s21::parallel::thread_pool pool(4);
+  return pool;
+}
+
+static s21::parallel::options small(std::size_t grain = 100) {
+  s21::parallel::options opts;
+  opts.grain = grain;
+  opts.pool = &testPool();
+  return opts;
+}
+
+TEST(parallel, RunCallsEveryIndexOnce) {
+  s21::parallel::thread_pool& pool = testPool();
+  EXPECT_EQ(pool.size(), 4u);
+  std::vector<std::atomic<int>> hits(10000);
+  pool.run(hits.size(), [&](std::size_t i) { ++hits[i]; });
+  for (auto& hit : hits) EXPECT_EQ(hit.load(), 1);
+  pool.run(0, [](std::size_t) { FAIL(); });
+
+  /* nested runs wait by working, not by blocking a worker */
+  std::atomic<int> inner(0);
+  pool.run(8, [&](std::size_t) {
+    pool.run(8, [&](std::size_t) { ++inner; });
+  });
+  EXPECT_EQ(inner.load(), 64);
+
+  s21::parallel::thread_pool inline_pool(1);
+  EXPECT_EQ(inline_pool.size(), 1u);
+  int sum = 0;
+  inline_pool.run(5, [&](std::size_t i) { sum += int(i); });
+  EXPECT_EQ(sum, 10);
+}
+
+TEST(parallel, RunRethrowsFirstException) {
+  std::atomic<int> calls(0);
+  EXPECT_THROW(testPool().run(1000,
+                              [&](std::size_t i) {
+                                ++calls;
+                                if (i == 10) throw std::runtime_error("x");
+                              }),
+               std::runtime_error);
+  EXPECT_LT(calls.load(), 1000);
+  /* the pool is still usable afterwards */
+  std::atomic<int> after(0);
+  testPool().run(100, [&](std::size_t) { ++after; });
+  EXPECT_EQ(after.load(), 100);
+}
+
+TEST(parallel, ForEachAndTransformOnVector) {
+  s21::vector<int> values(10007);
+  for (std::size_t i = 0; i < values.size(); ++i) values[i] = int(i);
+  s21::parallel::for_each(values, [](int& x) { x *= 2; }, small());
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    ASSERT_EQ(values[i], int(2 * i));
+  }
+
+  s21::vector<double> halves(values.size());
+  double* end = s21::parallel::transform(
+      values.data(), values.data() + values.size(), halves.data(),
+      [](int x) { return x / 2.0; }, small());
+  EXPECT_EQ(end, halves.data() + halves.size());
+  for (std::size_t i = 0; i < halves.size(); ++i) {
+    ASSERT_EQ(halves[i], double(i));
+  }
+
+  s21::array<int, 5> small_array = {1, 2, 3, 4, 5};
+  s21::parallel::for_each(small_array, [](int& x) { ++x; }, small(2));
+  EXPECT_EQ(small_array[4], 6);
+  const s21::array<int, 5>& view = small_array;
+  EXPECT_EQ(s21::parallel::reduce(view, 0, small(2)), 20);
+}
+
+TEST(parallel, DeterministicReduceIsReproducible) {
+  std::mt19937 gen(11);
+  std::uniform_real_distribution<double> dist(-1e6, 1e6);
+  s21::vector<double> values(50000);
+  for (std::size_t i = 0; i < values.size(); ++i) values[i] = dist(gen);
+
+  s21::parallel::options opts = small(777);
+  opts.deterministic = true;
+  double first = s21::parallel::reduce(values, 0.0, opts);
+  s21::parallel::thread_pool other(3);
+  opts.pool = &other;
+  for (int run = 0; run < 5; ++run) {
+    EXPECT_EQ(s21::parallel::reduce(values, 0.0, opts), first);
+  }
+  double sequential = std::accumulate(values.data(),
+                                      values.data() + values.size(), 0.0);
+  EXPECT_NEAR(first, sequential, 1e-3);
+
+  /* deterministic order also allows ops that only associate */
+  s21::vector<std::string> words(300);
+  for (std::size_t i = 0; i < words.size(); ++i) {
+    words[i] = std::string(1, char('a' + i % 26));
+  }
+  std::string joined = s21::parallel::reduce(
+      words, std::string(">"), std::plus<std::string>(), opts);
+  std::string expected = ">";
+  for (std::size_t i = 0; i < words.size(); ++i) expected += words[i];
+  EXPECT_EQ(joined, expected);
+
+  s21::vector<int> empty;
+  EXPECT_EQ(s21::parallel::reduce(empty, 7, opts), 7);
+}
+
+TEST(parallel, SortMatchesStdSort) {
+  std::mt19937 gen(5);
+  for (std::size_t n : {0u, 1u, 99u, 1000u, 54321u}) {
+    s21::vector<unsigned> values(n);
+    for (std::size_t i = 0; i < n; ++i) values[i] = gen() % 1000;
+    std::vector<unsigned> expected(values.data(), values.data() + n);
+    std::sort(expected.begin(), expected.end());
+    s21::parallel::sort(values, small(1000));
+    ASSERT_TRUE(std::equal(expected.begin(), expected.end(), values.data()));
+
+    s21::parallel::sort(values.data(), values.data() + n,
+                        std::greater<unsigned>(), small(333));
+    ASSERT_TRUE(std::equal(expected.rbegin(), expected.rend(), values.data()));
+  }
+}
+
+TEST(parallel, FindIfReturnsFirstMatch) {
+  s21::vector<int> values(20000);
+  for (std::size_t i = 0; i < values.size(); ++i) values[i] = int(i % 5000);
+  auto it = s21::parallel::find_if(
+      values, [](int x) { return x == 4321; }, small(64));
+  EXPECT_EQ(*it, 4321);
+  EXPECT_EQ(it - values.begin(), 4321);
+  auto none = s21::parallel::find_if(
+      values, [](int x) { return x < 0; }, small(64));
+  EXPECT_EQ(none, values.end());
+
+  const s21::vector<int>& view = values;
+  EXPECT_EQ(s21::parallel::count_if(
+                view, [](int x) { return x % 1000 == 0; }, small()),
+            20);
+  int* raw = s21::parallel::find_if(
+      values.data(), values.data() + values.size(),
+      [](int x) { return x == 4999; }, small());
+  EXPECT_EQ(raw - values.data(), 4999);
+}
+
+TEST(parallel, SegmentsOfMapAndSet) {
+  s21::set<int> keys;
+  for (int i = 0; i < 5000; ++i) keys.insert(i * 3);
+  s21::parallel::options opts = small(128);
+  EXPECT_EQ(s21::parallel::count_if(
+                keys, [](int key) { return key % 2 == 0; }, opts),
+            2500);
+  auto found = s21::parallel::find_if(
+      keys, [](int key) { return key > 6000; }, opts);
+  EXPECT_EQ(*found, 6003);
+  EXPECT_EQ(s21::parallel::find_if(keys, [](int) { return false; }, opts),
+            keys.end());
+  opts.deterministic = true;
+  EXPECT_EQ(s21::parallel::reduce(keys, 0LL, opts), 3LL * 4999 * 5000 / 2);
+
+  s21::map<int, double> scores;
+  for (int i = 0; i < 3000; ++i) scores.insert(i, 0.0);
+  s21::parallel::for_each(
+      scores, [](std::pair<const int, double>& item) {
+        item.second = item.first * 0.5;
+      },
+      opts);
+  EXPECT_EQ(scores.at(2999), 1499.5);
+  const s21::map<int, double>& view = scores;
+  s21::vector<double> out(view.size());
+  s21::parallel::transform(
+      view, out.data(),
+      [](const std::pair<const int, double>& item) { return item.second; },
+      opts);
+  EXPECT_EQ(out[10], 5.0);
+  EXPECT_EQ(out[2999], 1499.5);
+}
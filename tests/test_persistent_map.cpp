@@ -0,0 +1,254 @@
+#include <map>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "tests_init.h"
+
+namespace {
+long live_nodes = 0;
+long allocations_left = -1; /* bad_alloc once it reaches 0, -1 never */
+
+/* Counts the nodes alive across all trees using it */
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+
+  CountingAllocator() = default;
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U> &) {}
+
+  T *allocate(size_t n) {
+    if (allocations_left == 0) throw std::bad_alloc();
+    if (allocations_left > 0) --allocations_left;
+    live_nodes += long(n);
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *p, size_t n) {
+    live_nodes -= long(n);
+    std::allocator<T>().deallocate(p, n);
+  }
+  bool operator==(const CountingAllocator &) const { return true; }
+  bool operator!=(const CountingAllocator &) const { return false; }
+};
+
+long tagged_live[3] = {0, 0, 0};
+
+/* Unequal across tags; counts nodes per tag, so a node freed through
+ * another tree's allocator shows up as a mismatch */
+template <typename T>
+struct TaggedAllocator {
+  using value_type = T;
+
+  int tag;
+
+  explicit TaggedAllocator(int t = 0) : tag(t) {}
+  template <typename U>
+  TaggedAllocator(const TaggedAllocator<U> &other) : tag(other.tag) {}
+
+  T *allocate(size_t n) {
+    tagged_live[tag] += long(n);
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *p, size_t n) {
+    tagged_live[tag] -= long(n);
+    std::allocator<T>().deallocate(p, n);
+  }
+  bool operator==(const TaggedAllocator &other) const {
+    return tag == other.tag;
+  }
+  bool operator!=(const TaggedAllocator &other) const {
+    return tag != other.tag;
+  }
+};
+
+using Pair = std::pair<const int, int>;
+using CountedMap = s21::persistent_map<int, int, CountingAllocator<Pair>>;
+}  // namespace
+
+TEST(persistent_map, MatchesStdMap) {
+  s21::persistent_map<int, int> s21_map = {{5, 50}, {1, 10}, {3, 30}};
+  std::map<int, int> std_map = {{5, 50}, {1, 10}, {3, 30}};
+  std::mt19937 gen(3);
+  for (int i = 0; i < 3000; ++i) {
+    int key = int(gen() % 500);
+    if (gen() % 3 == 0) {
+      EXPECT_EQ(s21_map.erase(key), std_map.erase(key) == 1);
+    } else if (gen() % 2) {
+      EXPECT_EQ(s21_map.insert(key, i), std_map.emplace(key, i).second);
+    } else {
+      EXPECT_EQ(s21_map.insert_or_assign(key, i),
+                std_map.insert_or_assign(key, i).second);
+    }
+  }
+
+  ASSERT_EQ(s21_map.size(), std_map.size());
+  auto it = s21_map.begin();
+  for (const auto &item : std_map) {
+    EXPECT_EQ(it->first, item.first);
+    EXPECT_EQ((*it++).second, item.second);
+  }
+  EXPECT_EQ(it, s21_map.end());
+  EXPECT_EQ(s21_map.lower_bound(250)->first, std_map.lower_bound(250)->first);
+  EXPECT_EQ(s21_map.upper_bound(250)->first, std_map.upper_bound(250)->first);
+  EXPECT_THROW(s21_map.at(1000), std::out_of_range);
+  EXPECT_EQ(s21_map.find(1000), s21_map.end());
+}
+
+TEST(persistent_map, SnapshotsAreImmutable) {
+  s21::persistent_map<int, int> s21_map = {{1, 1}, {2, 2}};
+  auto before = s21_map.snapshot();
+
+  s21_map.insert_or_assign(1, 100);
+  s21_map.erase(2);
+  s21_map.insert(3, 3);
+
+  ASSERT_EQ(before.size(), 2);
+  EXPECT_EQ(before.find(1)->second, 1);
+  EXPECT_TRUE(before.contains(2));
+  EXPECT_FALSE(before.contains(3));
+  EXPECT_EQ(s21_map.at(1), 100);
+  EXPECT_FALSE(s21_map.contains(2));
+
+  s21::persistent_map<int, int> copy(s21_map);
+  s21_map.clear();
+  EXPECT_TRUE(s21_map.empty());
+  EXPECT_EQ(copy.size(), 2);
+  EXPECT_EQ(copy.snapshot().begin()->second, 100);
+}
+
+TEST(persistent_map, SnapshotOutlivesMap) {
+  s21::persistent_map<int, int>::snapshot_type snapshot;
+  {
+    s21::persistent_map<int, int> s21_map;
+    for (int i = 0; i < 100; ++i) s21_map.insert(i, i * i);
+    snapshot = s21_map.snapshot();
+  }
+  ASSERT_EQ(snapshot.size(), 100);
+  int i = 0;
+  for (const auto &item : snapshot) {
+    EXPECT_EQ(item.second, i * i);
+    ++i;
+  }
+}
+
+TEST(persistent_map, VersionsShareNodes) {
+  {
+    CountedMap s21_map;
+    for (int i = 0; i < 4096; ++i) s21_map.insert(i, i);
+    EXPECT_EQ(live_nodes, 4096);
+
+    std::vector<CountedMap::snapshot_type> versions;
+    for (int i = 0; i < 100; ++i) {
+      versions.push_back(s21_map.snapshot());
+      s21_map.insert_or_assign(i * 37, -i);
+    }
+    /* each write copies a few root-to-leaf paths, not the tree */
+    EXPECT_LT(live_nodes, 4096 + 100 * 100);
+    EXPECT_EQ(versions[10].find(370)->second, 370);
+
+    versions.clear();
+    EXPECT_EQ(live_nodes, 4096);
+  }
+  EXPECT_EQ(live_nodes, 0);
+}
+
+TEST(persistent_map, FailedWritesLeakNothing) {
+  {
+    CountedMap s21_map;
+    for (int i = 0; i < 500; ++i) s21_map.insert(i * 2, i);
+    /* the snapshot shares every node, so writes copy paths */
+    auto before = s21_map.snapshot();
+    long nodes = live_nodes;
+
+    for (long budget = 0; budget < 60; ++budget) {
+      for (int key : {0, 333, 500, 998, 999}) {
+        allocations_left = budget;
+        bool done = true;
+        try {
+          if (key % 2) {
+            s21_map.insert(key, -1);
+          } else {
+            s21_map.erase(key);
+          }
+        } catch (const std::bad_alloc &) {
+          done = false;
+        }
+        allocations_left = -1;
+        if (done) {
+          /* undo it, on a tree that shares nothing with before */
+          if (key % 2) {
+            s21_map.erase(key);
+          } else {
+            s21_map.insert(key, key / 2);
+          }
+        }
+        ASSERT_EQ(s21_map.size(), 500u);
+        ASSERT_EQ(s21_map.at(key & ~1), (key & ~1) / 2);
+      }
+    }
+    s21_map = CountedMap();
+    EXPECT_EQ(before.size(), 500u);
+    EXPECT_LE(live_nodes, nodes);
+  }
+  EXPECT_EQ(live_nodes, 0);
+}
+
+TEST(persistent_map, ConcurrentReaders) {
+  s21::persistent_map<int, int> s21_map;
+  std::atomic<bool> done(false);
+  std::atomic<int> errors(0);
+
+  /* the writer keeps key -> key * 2 and only grows the map */
+  std::vector<std::thread> readers;
+  for (int r = 0; r < 4; ++r) {
+    readers.emplace_back([&] {
+      size_t last = 0;
+      while (!done) {
+        auto snapshot = s21_map.snapshot();
+        if (snapshot.size() < last) ++errors;
+        last = snapshot.size();
+        int expected = 0;
+        for (const auto &item : snapshot) {
+          if (item.first != expected || item.second != expected * 2) {
+            ++errors;
+          }
+          ++expected;
+        }
+        if (size_t(expected) != snapshot.size()) ++errors;
+      }
+    });
+  }
+  for (int i = 0; i < 5000; ++i) s21_map.insert(i, i * 2);
+  done = true;
+  for (auto &reader : readers) reader.join();
+
+  EXPECT_EQ(errors, 0);
+  EXPECT_EQ(s21_map.size(), 5000);
+}
+
+TEST(persistent_map, AssignmentFreesWithOwnAllocator) {
+  using tagged = s21::persistent_map<int, int, TaggedAllocator<Pair>>;
+  {
+    tagged first(TaggedAllocator<Pair>(1));
+    tagged second(TaggedAllocator<Pair>(2));
+    for (int i = 0; i < 100; ++i) first.insert(i, i);
+    for (int i = 0; i < 10; ++i) second.insert(i, -i);
+
+    first = second;
+    EXPECT_EQ(tagged_live[1], 0);
+    EXPECT_EQ(first.get_allocator().tag, 2);
+    EXPECT_EQ(first.at(9), -9);
+
+    tagged third(TaggedAllocator<Pair>(1));
+    for (int i = 0; i < 50; ++i) third.insert(i, i);
+    auto kept = third.snapshot();
+    third = std::move(first);
+    EXPECT_EQ(third.get_allocator().tag, 2);
+    EXPECT_TRUE(first.empty());
+    EXPECT_EQ(third.size(), 10);
+    EXPECT_EQ(kept.size(), 50);
+  }
+  EXPECT_EQ(tagged_live[1], 0);
+  EXPECT_EQ(tagged_live[2], 0);
+}
@@ -102,4 +102,24 @@ TEST(queue, InsertManyBackFunction) {
   EXPECT_EQ(q.size(), 4);
   EXPECT_EQ(q.front(), 1);
   EXPECT_EQ(q.back(), 4);
-}
\ No newline at end of file
+}
+
+TEST(queue, MoveOnlyElements) {
+  s21::queue<std::unique_ptr<int>> q;
+  q.push(std::make_unique<int>(1));
+  q.emplace(new int(2));
+  q.insert_many_back(std::make_unique<int>(3));
+
+  EXPECT_EQ(q.size(), 3);
+  EXPECT_EQ(*q.front(), 1);
+  EXPECT_EQ(*q.back(), 3);
+}
+
+TEST(queue, ListContainer) {
+  s21::queue<int, s21::list<int>> q({1, 2});
+  q.push(3);
+  q.pop();
+  EXPECT_EQ(q.front(), 2);
+  EXPECT_EQ(q.back(), 3);
+  EXPECT_EQ(q.size(), 2);
+}
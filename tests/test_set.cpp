@@ -1,4 +1,8 @@
+#include <algorithm>
+#include <iterator>
+#include <memory>
 #include <set>
+#include <vector>
 
 #include "tests_init.h"
 
@@ -230,4 +234,261 @@ TEST(test, InsertMany) {
   EXPECT_NE(test_set.find(3), test_set.end());
   EXPECT_NE(test_set.find(4), test_set.end());
   EXPECT_NE(test_set.find(5), test_set.end());
-}
\ No newline at end of file
+}
+
+TEST(set, OrderStatistics) {
+  s21::set<int> s21_set;
+  std::set<int> std_set;
+  for (int i = 0; i < 200; ++i) {
+    int val = (i * 37) % 101;
+    s21_set.insert(val);
+    std_set.insert(val);
+  }
+  EXPECT_EQ(s21_set.size(), std_set.size());
+
+  auto std_it = std_set.begin();
+  for (size_t k = 0; k < std_set.size(); ++k, ++std_it) {
+    EXPECT_EQ(*s21_set.nth_element(k), *std_it);
+    EXPECT_EQ(s21_set.rank(*std_it), k);
+  }
+
+  s21::set<int> s21_copy(s21_set);
+  s21_copy.erase(s21_copy.find(50));
+  EXPECT_EQ(s21_copy.size(), s21_set.size() - 1);
+  EXPECT_EQ(s21_copy.count_range(0, 101), 100);
+  EXPECT_EQ(s21_set.count_range(0, 101), 101);
+  EXPECT_EQ(s21_set.count_range(40, 60), 20);
+}
+
+TEST(set, EmplaceHint) {
+  s21::set<int> s21_set;
+  std::set<int> std_set;
+  for (int i = 0; i < 64; ++i) {
+    int val = (i * 7) % 64;
+    s21_set.emplace_hint(s21_set.end(), val);
+    std_set.emplace_hint(std_set.end(), val);
+  }
+  s21_set.emplace_hint(s21_set.begin(), 5);
+
+  EXPECT_EQ(s21_set.size(), std_set.size());
+  auto std_it = std_set.begin();
+  for (auto it = s21_set.begin(); it != s21_set.end(); ++it, ++std_it) {
+    EXPECT_EQ(*it, *std_it);
+  }
+}
+
+TEST(set, MoveAndEmplace) {
+  s21::set<std::string> test_set;
+  std::string value(64, 'v');
+
+  EXPECT_TRUE(test_set.insert(std::move(value)).second);
+  EXPECT_TRUE(value.empty());
+  EXPECT_TRUE(test_set.emplace(3, 'a').second);
+  EXPECT_FALSE(test_set.emplace("aaa").second);
+
+  auto results = test_set.insert_many(std::string("b"), "c");
+  EXPECT_TRUE(results[0].second);
+  EXPECT_TRUE(results[1].second);
+  EXPECT_EQ(test_set.size(), 4);
+}
+
+TEST(set, BoundsAndRange) {
+  s21::set<int> s21_set = {1, 3, 5, 7};
+  EXPECT_EQ(*s21_set.lower_bound(3), 3);
+  EXPECT_EQ(*s21_set.upper_bound(3), 5);
+  EXPECT_TRUE(s21_set.lower_bound(8) == s21_set.end());
+  auto eq = s21_set.equal_range(4);
+  EXPECT_TRUE(eq.first == eq.second);
+  EXPECT_EQ(*eq.first, 5);
+
+  int sum = 0;
+  for (int key : s21_set.range(2, 7)) sum += key;
+  EXPECT_EQ(sum, 8);
+}
+
+TEST(set, SortedBuild) {
+  std::vector<int> sorted;
+  for (int i = 0; i < 1000; ++i) sorted.push_back(i * 3);
+  s21::set<int> s21_set(sorted.begin(), sorted.end());
+  EXPECT_EQ(s21_set.size(), sorted.size());
+  EXPECT_EQ(*s21_set.nth_element(500), 1500);
+  EXPECT_EQ(*--s21_set.end(), 2997);
+
+  s21_set.insert(1);
+  s21_set.remove(0);
+  EXPECT_EQ(*s21_set.begin(), 1);
+  EXPECT_EQ(s21_set.rank(1500), 500);
+}
+
+TEST(set, AssignSortedFallsBack) {
+  std::vector<int> input = {1, 2, 2, 5, 9, 3, 9, 0, 7};
+  std::set<int> std_set(input.begin(), input.end());
+  s21::set<int> s21_set = {42};
+  s21_set.assign_sorted(input.begin(), input.end());
+
+  ASSERT_EQ(s21_set.size(), std_set.size());
+  auto std_it = std_set.begin();
+  for (auto it = s21_set.begin(); it != s21_set.end(); ++it, ++std_it) {
+    EXPECT_EQ(*it, *std_it);
+  }
+}
+
+TEST(set, SetAlgebra) {
+  std::vector<int> a_keys, b_keys;
+  for (int i = 0; i < 2000; i += 2) a_keys.push_back(i);
+  for (int i = 0; i < 3000; i += 3) b_keys.push_back(i);
+  std::set<int> std_a(a_keys.begin(), a_keys.end());
+  std::set<int> std_b(b_keys.begin(), b_keys.end());
+  auto expect_eq = [](const s21::set<int>& s21_set,
+                      const std::vector<int>& expected) {
+    ASSERT_EQ(s21_set.size(), expected.size());
+    auto it = s21_set.cbegin();
+    for (int key : expected) EXPECT_EQ(*it++, key);
+  };
+
+  std::vector<int> expected;
+  s21::set<int> a(a_keys.begin(), a_keys.end());
+  const s21::set<int> b(b_keys.begin(), b_keys.end());
+  a.set_intersection(b);
+  std::set_intersection(std_a.begin(), std_a.end(), std_b.begin(),
+                        std_b.end(), std::back_inserter(expected));
+  expect_eq(a, expected);
+
+  expected.clear();
+  a = s21::set<int>(a_keys.begin(), a_keys.end());
+  a.set_difference(b);
+  std::set_difference(std_a.begin(), std_a.end(), std_b.begin(),
+                      std_b.end(), std::back_inserter(expected));
+  expect_eq(a, expected);
+  a.insert(6);
+  EXPECT_EQ(*++a.begin(), 4);
+
+  expected.clear();
+  a = s21::set<int>(a_keys.begin(), a_keys.end());
+  s21::set<int> other(b);
+  a.set_union(other);
+  std::set_union(std_a.begin(), std_a.end(), std_b.begin(), std_b.end(),
+                 std::back_inserter(expected));
+  expect_eq(a, expected);
+  EXPECT_TRUE(other.empty());
+
+  a.set_difference(a);
+  EXPECT_TRUE(a.empty());
+}
+
+TEST(set, MergeLeavesDuplicates) {
+  s21::set<int> s21_set = {1, 3, 5, 7};
+  s21::set<int> other = {0, 3, 4, 7, 8};
+  s21_set.merge(other);
+
+  EXPECT_EQ(s21_set.size(), 7);
+  EXPECT_EQ(*--s21_set.end(), 8);
+  ASSERT_EQ(other.size(), 2);
+  EXPECT_EQ(*other.begin(), 3);
+  EXPECT_EQ(*--other.end(), 7);
+  other.insert(5);
+  EXPECT_EQ(other.rank(7), 2);
+  EXPECT_THROW(s21_set.merge(s21_set), std::invalid_argument);
+}
+
+TEST(set, Split) {
+  std::vector<int> keys;
+  for (int i = 0; i < 500; ++i) keys.push_back(i);
+  s21::set<int> s21_set(keys.begin(), keys.end());
+
+  s21::set<int> upper = s21_set.split(200);
+  EXPECT_EQ(s21_set.size(), 200);
+  EXPECT_EQ(*--s21_set.end(), 199);
+  EXPECT_EQ(upper.size(), 300);
+  EXPECT_EQ(*upper.begin(), 200);
+  EXPECT_EQ(*upper.nth_element(299), 499);
+
+  s21::set<int> empty = s21_set.split(1000);
+  EXPECT_TRUE(empty.empty());
+  s21::set<int> all = s21_set.split(-1);
+  EXPECT_TRUE(s21_set.empty());
+  EXPECT_EQ(all.size(), 200);
+
+  all.merge(upper);
+  EXPECT_EQ(all.size(), 500);
+  EXPECT_EQ(all.rank(250), 250);
+}
+
+TEST(set, LargeCopy) {
+  std::vector<int> keys;
+  for (int i = 0; i < 100000; ++i) keys.push_back(i);
+  s21::set<int> s21_set(keys.begin(), keys.end());
+
+  s21::set<int> copy(s21_set);
+  ASSERT_EQ(copy.size(), s21_set.size());
+  EXPECT_TRUE(std::equal(keys.begin(), keys.end(), copy.begin()));
+  EXPECT_EQ(*--copy.end(), 99999);
+  copy.remove(500);
+  EXPECT_EQ(copy.rank(1000), 999);
+  EXPECT_TRUE(s21_set.contains(500));
+}
+
+namespace {
+long tagged_live[3] = {0, 0, 0};
+
+/* Unequal across tags and never propagated; counts blocks per tag, so a
+ * block freed through the wrong allocator shows up as a mismatch */
+template <typename T>
+struct TaggedAllocator {
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::false_type;
+  using propagate_on_container_move_assignment = std::false_type;
+  using propagate_on_container_swap = std::false_type;
+  using is_always_equal = std::false_type;
+
+  int tag;
+
+  explicit TaggedAllocator(int t = 0) : tag(t) {}
+  template <typename U>
+  TaggedAllocator(const TaggedAllocator<U> &other) : tag(other.tag) {}
+
+  T *allocate(size_t n) {
+    ++tagged_live[tag];
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *p, size_t n) {
+    --tagged_live[tag];
+    std::allocator<T>().deallocate(p, n);
+  }
+  bool operator==(const TaggedAllocator &other) const {
+    return tag == other.tag;
+  }
+  bool operator!=(const TaggedAllocator &other) const {
+    return tag != other.tag;
+  }
+};
+}  // namespace
+
+TEST(set, MoveAssignMoveOnlyValues) {
+  using pointers = s21::set<std::unique_ptr<int>>;
+  static_assert(std::is_nothrow_move_assignable<pointers>::value);
+  pointers first, second;
+  first.insert(std::make_unique<int>(10));
+  second = std::move(first);
+  EXPECT_TRUE(first.empty());
+  EXPECT_EQ(**second.begin(), 10);
+
+  using tagged =
+      s21::set<std::unique_ptr<int>, TaggedAllocator<std::unique_ptr<int>>>;
+  static_assert(!std::is_nothrow_move_assignable<tagged>::value);
+  {
+    tagged source(TaggedAllocator<std::unique_ptr<int>>(1));
+    tagged target(TaggedAllocator<std::unique_ptr<int>>(2));
+    for (int i = 0; i < 50; ++i) source.insert(std::make_unique<int>(i));
+
+    target = std::move(source);
+    EXPECT_EQ(target.get_allocator().tag, 2);
+    EXPECT_TRUE(source.empty());
+    ASSERT_EQ(target.size(), 50);
+    int sum = 0;
+    for (const auto &p : target) sum += *p;
+    EXPECT_EQ(sum, 49 * 50 / 2);
+    EXPECT_EQ(tagged_live[1], 0);
+  }
+  EXPECT_EQ(tagged_live[2], 0);
+}
@@ -0,0 +1,100 @@
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "tests_init.h"
+
+namespace {
+
+const s21::simd::Isa kIsas[] = {s21::simd::Isa::kScalar,
+                                s21::simd::Isa::kSse2, s21::simd::Isa::kAvx2,
+                                s21::simd::Isa::kAvx512};
+
+/* Run every kernel on each instruction set the CPU has, over lengths that
+ * cover the empty range, partial registers and the unrolled loops */
+template <typename T>
+void checkKernels() {
+  const s21::simd::Isa saved = s21::simd::active_isa();
+  for (s21::simd::Isa isa : kIsas) {
+    if (s21::simd::set_isa(isa) != isa) continue;
+    for (size_t n : {0u, 1u, 7u, 31u, 64u, 257u, 1000u}) {
+      std::vector<T> a(n), b(n);
+      for (size_t i = 0; i < n; ++i) {
+        a[i] = T((i * 37) % 11);
+        b[i] = T((i * 13) % 5);
+      }
+      const T *pa = a.data();
+
+      EXPECT_EQ(s21::simd::find(pa, n, T(10)),
+                size_t(std::find(a.begin(), a.end(), T(10)) - a.begin()));
+      EXPECT_EQ(s21::simd::find(pa, n, T(99)), n);
+      EXPECT_EQ(s21::simd::count(pa, n, T(3)),
+                size_t(std::count(a.begin(), a.end(), T(3))));
+      if (n) {
+        EXPECT_EQ(s21::simd::min(pa, n), *std::min_element(a.begin(), a.end()));
+        EXPECT_EQ(s21::simd::max(pa, n), *std::max_element(a.begin(), a.end()));
+      }
+      EXPECT_EQ(s21::simd::sum(pa, n), T(std::accumulate(a.begin(), a.end(),
+                                                         std::int64_t(0))));
+      EXPECT_EQ(s21::simd::dot(pa, b.data(), n),
+                T(std::inner_product(a.begin(), a.end(), b.begin(),
+                                     std::int64_t(0))));
+
+      std::vector<T> c(a);
+      EXPECT_EQ(s21::simd::compare(pa, n, c.data(), n), 0);
+      if (n) {
+        c[n - 1] = T(c[n - 1] + 1);
+        EXPECT_EQ(s21::simd::compare(pa, n, c.data(), n), -1);
+        EXPECT_EQ(s21::simd::compare(c.data(), n, pa, n), 1);
+        EXPECT_EQ(s21::simd::compare(pa, n - 1, pa, n), -1);
+      }
+
+      s21::simd::fill(c.data(), n, T(4));
+      EXPECT_EQ(std::count(c.begin(), c.end(), T(4)), std::ptrdiff_t(n));
+    }
+  }
+  s21::simd::set_isa(saved);
+}
+
+}  // namespace
+
+TEST(simd, Int8) { checkKernels<std::int8_t>(); }
+TEST(simd, Uint16) { checkKernels<std::uint16_t>(); }
+TEST(simd, Int32) { checkKernels<std::int32_t>(); }
+TEST(simd, Uint64) { checkKernels<std::uint64_t>(); }
+TEST(simd, Float) { checkKernels<float>(); }
+TEST(simd, Double) { checkKernels<double>(); }
+
+TEST(simd, CountPastLaneCounter) {
+  std::vector<std::uint8_t> bytes(100000, 1);
+  bytes[5] = 2;
+  EXPECT_EQ(s21::simd::count(bytes.data(), bytes.size(), std::uint8_t(1)),
+            bytes.size() - 1);
+}
+
+TEST(simd, SumWrapsAround) {
+  std::vector<std::int8_t> bytes(1000, 100);
+  EXPECT_EQ(s21::simd::sum(bytes.data(), bytes.size()),
+            std::int8_t(std::uint8_t(100000 % 256)));
+}
+
+TEST(simd, NonArithmetic) {
+  std::vector<std::string> words = {"b", "a", "c", "a"};
+  EXPECT_EQ(s21::simd::count(words.data(), words.size(), std::string("a")),
+            2u);
+  EXPECT_EQ(s21::simd::find(words.data(), words.size(), std::string("c")),
+            2u);
+  EXPECT_EQ(s21::simd::min(words.data(), words.size()), "a");
+  EXPECT_EQ(s21::simd::sum(words.data(), words.size()), "baca");
+}
+
+TEST(simd, SetIsaClamps) {
+  const s21::simd::Isa saved = s21::simd::active_isa();
+  EXPECT_EQ(s21::simd::set_isa(s21::simd::Isa::kAvx512),
+            s21::simd::detected_isa());
+  EXPECT_EQ(s21::simd::set_isa(s21::simd::Isa::kScalar),
+            s21::simd::Isa::kScalar);
+  s21::simd::set_isa(saved);
+}
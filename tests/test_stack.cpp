@@ -148,3 +148,106 @@ TEST(S21StackTest, InsertMany2) {
   EXPECT_EQ(s.size(), 18);
   EXPECT_EQ(s.top(), 0);
 }
+
+TEST(S21StackTest, MoveOnlyElements) {
+  stack<std::unique_ptr<int>> s;
+  s.push(std::make_unique<int>(1));
+  s.emplace(new int(2));
+  s.insert_many_front(std::make_unique<int>(3), std::make_unique<int>(4));
+
+  EXPECT_EQ(s.size(), 4);
+  EXPECT_EQ(*s.top(), 4);
+
+  stack<std::unique_ptr<int>> moved(std::move(s));
+  EXPECT_EQ(s.size(), 0);
+  s.push(std::make_unique<int>(5));
+  EXPECT_EQ(*s.top(), 5);
+  EXPECT_EQ(*moved.top(), 4);
+}
+
+TEST(S21StackTest, SmallBufferStaysInline) {
+  stack_buffer<std::string, 4> buffer;
+  for (int i = 0; i < 4; i++) buffer.push_back(std::string(30, 'a' + i));
+  EXPECT_TRUE(buffer.is_inline());
+  EXPECT_EQ(buffer.capacity(), 4);
+
+  buffer.emplace_back(buffer.back());
+  EXPECT_FALSE(buffer.is_inline());
+  EXPECT_EQ(buffer.size(), 5);
+  EXPECT_EQ(buffer.back(), std::string(30, 'd'));
+
+  stack_buffer<std::string, 4> copy(buffer);
+  buffer.clear();
+  EXPECT_EQ(copy.size(), 5);
+  EXPECT_EQ(*copy.begin(), std::string(30, 'a'));
+}
+
+TEST(S21StackTest, SmallBufferSwapAndMove) {
+  small_stack<std::unique_ptr<int>, 8> shallow;
+  small_stack<std::unique_ptr<int>, 8> deep;
+  for (int i = 0; i < 3; i++) shallow.push(std::make_unique<int>(i));
+  for (int i = 0; i < 20; i++) deep.emplace(new int(100 + i));
+
+  shallow.swap(deep);
+  EXPECT_EQ(shallow.size(), 20);
+  EXPECT_EQ(*shallow.top(), 119);
+  EXPECT_EQ(deep.size(), 3);
+  EXPECT_EQ(*deep.top(), 2);
+
+  small_stack<std::unique_ptr<int>, 8> moved(std::move(deep));
+  EXPECT_TRUE(deep.empty());
+  EXPECT_EQ(*moved.top(), 2);
+  moved = std::move(shallow);
+  EXPECT_EQ(moved.size(), 20);
+  EXPECT_TRUE(shallow.empty());
+}
+
+TEST(S21StackTest, ElementsDestroyedOnce) {
+  auto token = std::make_shared<int>(0);
+  {
+    small_stack<std::shared_ptr<int>, 2> s;
+    for (int i = 0; i < 10; i++) s.push(token);
+    s.pop();
+    small_stack<std::shared_ptr<int>, 2> copy = s;
+    EXPECT_EQ(token.use_count(), 19);
+    s.clear();
+    EXPECT_EQ(token.use_count(), 10);
+  }
+  EXPECT_EQ(token.use_count(), 1);
+}
+
+TEST(S21StackTest, OtherContainers) {
+  stack<int, s21::vector<int>> on_vector({1, 2});
+  on_vector.reserve(100);
+  on_vector.push_range(std::vector<int>{3, 4, 5});
+  EXPECT_EQ(on_vector.size(), 5);
+  EXPECT_EQ(on_vector.top(), 5);
+  on_vector.pop();
+  EXPECT_EQ(on_vector.top(), 4);
+
+  stack<std::string, s21::list<std::string>> on_list;
+  on_list.reserve(10);
+  on_list.emplace(3, 'x');
+  on_list.push("top");
+  EXPECT_EQ(on_list.top(), "top");
+  on_list.pop();
+  EXPECT_EQ(on_list.top(), "xxx");
+
+  s21::deque<int> blocks = {7, 8};
+  stack<int, s21::deque<int>> on_deque(std::move(blocks));
+  on_deque.insert_many_front(9);
+  EXPECT_EQ(on_deque.size(), 3);
+  EXPECT_EQ(on_deque.top(), 9);
+  on_deque.clear();
+  EXPECT_THROW(on_deque.pop(), std::out_of_range);
+}
+
+TEST(S21StackTest, PushRangeMoves) {
+  std::vector<std::unique_ptr<int>> items;
+  items.push_back(std::make_unique<int>(1));
+  items.push_back(std::make_unique<int>(2));
+  stack<std::unique_ptr<int>> s;
+  s.push_range(std::move(items));
+  EXPECT_EQ(s.size(), 2);
+  EXPECT_EQ(*s.top(), 2);
+}
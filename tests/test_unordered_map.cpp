@@ -0,0 +1,171 @@
+#include <string>
+#include <unordered_map>
+
+#include "tests_init.h"
+
+TEST(unordered_map, AccessAndInsert) {
+  s21::unordered_map<std::string, int> s21_map{{"a", 1}, {"b", 2}};
+
+  s21_map["c"] = 3;
+  EXPECT_TRUE(s21_map.insert("d", 4).second);
+  EXPECT_FALSE(s21_map.insert("a", 10).second);
+  EXPECT_FALSE(s21_map.insert_or_assign("b", 20).second);
+  EXPECT_TRUE(s21_map.emplace("e", 5).second);
+
+  EXPECT_EQ(s21_map.size(), 5);
+  EXPECT_EQ(s21_map.at("a"), 1);
+  EXPECT_EQ(s21_map.at("b"), 20);
+  EXPECT_EQ(s21_map["c"], 3);
+  EXPECT_THROW(s21_map.at("z"), std::out_of_range);
+  EXPECT_TRUE(s21_map.contains("e"));
+  EXPECT_EQ(s21_map.find("z"), s21_map.end());
+}
+
+TEST(unordered_map, MatchesStdUnorderedMap) {
+  s21::unordered_map<int, int> s21_map;
+  std::unordered_map<int, int> std_map;
+
+  for (int i = 0; i < 20000; ++i) {
+    int key = (i * 7919) % 4099;
+    s21_map[key] += i;
+    std_map[key] += i;
+    if (i % 3 == 0) {
+      EXPECT_EQ(s21_map.erase(key / 2), std_map.erase(key / 2));
+    }
+  }
+
+  ASSERT_EQ(s21_map.size(), std_map.size());
+  size_t visited = 0;
+  for (auto it = s21_map.begin(); it != s21_map.end(); ++it, ++visited) {
+    EXPECT_EQ(it->second, std_map.at(it->first));
+  }
+  EXPECT_EQ(visited, std_map.size());
+  EXPECT_LE(s21_map.load_factor(), s21_map.max_load_factor());
+}
+
+TEST(unordered_map, ReserveKeepsIterators) {
+  s21::unordered_map<int, std::string> s21_map;
+  s21_map.reserve(100);
+  size_t buckets = s21_map.bucket_count();
+
+  auto first = s21_map.insert(0, "zero").first;
+  for (int i = 1; i < 100; ++i) s21_map.insert(i, std::to_string(i));
+
+  EXPECT_EQ(s21_map.bucket_count(), buckets);
+  EXPECT_EQ(first->second, "zero");
+
+  s21_map.rehash(1000);
+  EXPECT_GE(s21_map.bucket_count(), 1000);
+  EXPECT_EQ(s21_map.at(42), "42");
+}
+
+TEST(unordered_map, EraseDuringIteration) {
+  s21::unordered_map<int, int> s21_map;
+  for (int i = 0; i < 1000; ++i) s21_map[i] = i;
+
+  for (auto it = s21_map.begin(); it != s21_map.end();) {
+    if (it->first % 2) {
+      it = s21_map.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  EXPECT_EQ(s21_map.size(), 500);
+  for (int i = 0; i < 1000; ++i) EXPECT_EQ(s21_map.contains(i), i % 2 == 0);
+}
+
+TEST(unordered_map, TombstonesAreReclaimed) {
+  s21::unordered_map<int, int> s21_map;
+  s21_map.reserve(64);
+  size_t buckets = s21_map.bucket_count();
+
+  for (int round = 0; round < 100; ++round) {
+    for (int i = 0; i < 32; ++i) s21_map[round * 32 + i] = i;
+    for (int i = 0; i < 32; ++i) s21_map.erase(round * 32 + i);
+  }
+
+  EXPECT_TRUE(s21_map.empty());
+  EXPECT_EQ(s21_map.bucket_count(), buckets);
+}
+
+TEST(unordered_map, MaxLoadFactor) {
+  s21::unordered_map<int, int> s21_map;
+  s21_map.max_load_factor(0.5f);
+  for (int i = 0; i < 1000; ++i) s21_map[i] = i;
+
+  EXPECT_LE(s21_map.load_factor(), 0.5f);
+  EXPECT_THROW(s21_map.max_load_factor(0.0f), std::invalid_argument);
+
+  s21_map.max_load_factor(0.95f);
+  EXPECT_EQ(s21_map.size(), 1000);
+  EXPECT_EQ(s21_map.at(999), 999);
+}
+
+TEST(unordered_map, SmallMaxLoadFactorKeepsGrowing) {
+  /* 8 slots at 0.1 leave no growth at all: inserts must still grow */
+  s21::unordered_set<int> s21_set;
+  s21_set.max_load_factor(0.1f);
+  for (int i = 0; i < 100; ++i) {
+    s21_set.insert(i);
+    ASSERT_EQ(s21_set.size(), size_t(i + 1));
+    ASSERT_LE(s21_set.load_factor(), 0.1f);
+  }
+  for (int i = 0; i < 100; ++i) EXPECT_TRUE(s21_set.contains(i));
+
+  s21::unordered_map<int, int> s21_map;
+  s21_map.max_load_factor(2.0f);
+  for (int i = 0; i < 100; ++i) s21_map[i] = i;
+  EXPECT_LT(s21_map.load_factor(), 1.0f);
+  EXPECT_EQ(s21_map.at(99), 99);
+}
+
+struct ModHash {
+  size_t operator()(int key) const { return size_t(key % 3); }
+};
+
+TEST(unordered_map, CustomHasher) {
+  s21::unordered_map<int, int, ModHash> s21_map;
+  for (int i = 0; i < 300; ++i) s21_map[i] = -i;
+
+  EXPECT_EQ(s21_map.size(), 300);
+  for (int i = 0; i < 300; ++i) EXPECT_EQ(s21_map.at(i), -i);
+}
+
+TEST(unordered_map, MergeAndInsertMany) {
+  s21::unordered_map<int, std::string> first{{1, "a"}, {3, "c"}};
+  s21::unordered_map<int, std::string> second{{2, "b"}, {3, "x"}};
+
+  first.merge(second);
+  EXPECT_EQ(first.size(), 3);
+  EXPECT_EQ(first.at(3), "c");
+  ASSERT_EQ(second.size(), 1);
+  EXPECT_EQ(second.at(3), "x");
+
+  auto result = first.insert_many(std::make_pair(4, "d"),
+                                  std::make_pair(1, "z"),
+                                  std::make_pair(4, "e"));
+  ASSERT_EQ(result.size(), 3);
+  EXPECT_TRUE(result[0].second);
+  EXPECT_FALSE(result[1].second);
+  EXPECT_FALSE(result[2].second);
+  EXPECT_EQ(result[0].first->second, "d");
+  EXPECT_EQ(result[1].first->second, "a");
+}
+
+TEST(unordered_map, CopyAndMove) {
+  s21::unordered_map<std::string, int> s21_map{{"a", 1}, {"b", 2}};
+  s21::unordered_map<std::string, int> copy(s21_map);
+  s21::unordered_map<std::string, int> moved(std::move(s21_map));
+
+  EXPECT_EQ(copy.at("b"), 2);
+  EXPECT_EQ(moved.at("a"), 1);
+  EXPECT_TRUE(s21_map.empty());
+  s21_map["c"] = 3;
+  EXPECT_EQ(s21_map.size(), 1);
+
+  copy = moved;
+  copy.clear();
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.size(), 2);
+}
@@ -0,0 +1,50 @@
+#include <string>
+#include <unordered_set>
+
+#include "tests_init.h"
+
+TEST(unordered_set, InsertFindErase) {
+  s21::unordered_set<std::string> s21_set{"a", "b", "a"};
+
+  EXPECT_EQ(s21_set.size(), 2);
+  EXPECT_TRUE(s21_set.insert("c").second);
+  EXPECT_FALSE(s21_set.insert("b").second);
+  EXPECT_EQ(*s21_set.find("c"), "c");
+  EXPECT_EQ(s21_set.count("d"), 0);
+  EXPECT_EQ(s21_set.erase("a"), 1);
+  EXPECT_EQ(s21_set.erase("a"), 0);
+  EXPECT_EQ(s21_set.size(), 2);
+}
+
+TEST(unordered_set, Stress) {
+  s21::unordered_set<int> s21_set;
+  std::unordered_set<int> std_set;
+
+  for (int i = 0; i < 50000; ++i) {
+    int value = (i * 7919) % 10007;
+    if (i % 4 == 3) {
+      EXPECT_EQ(s21_set.erase(value), std_set.erase(value));
+    } else {
+      EXPECT_EQ(s21_set.insert(value).second, std_set.insert(value).second);
+    }
+  }
+
+  ASSERT_EQ(s21_set.size(), std_set.size());
+  for (int value : std_set) EXPECT_TRUE(s21_set.contains(value));
+}
+
+TEST(unordered_set, MergeAndInsertMany) {
+  s21::unordered_set<int> first{1, 2};
+  s21::unordered_set<int> second{2, 3};
+
+  first.merge(second);
+  EXPECT_EQ(first.size(), 3);
+  EXPECT_EQ(second.size(), 1);
+
+  auto results = first.insert_many(4, 5, 1);
+  EXPECT_TRUE(results[0].second);
+  EXPECT_TRUE(results[1].second);
+  EXPECT_FALSE(results[2].second);
+  EXPECT_EQ(*results[0].first, 4);
+  EXPECT_EQ(first.size(), 5);
+}
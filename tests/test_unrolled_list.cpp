@@ -0,0 +1,257 @@
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <random>
+#include <string>
+
+#include "tests_init.h"
+
+/* Small chunks so that every operation crosses chunk boundaries */
+using SmallList = s21::unrolled_list<std::string, 4>;
+
+static std::string text(int value) {
+  return std::string(20, 'a') + std::to_string(value);
+}
+
+template <typename List, typename Expected>
+void expectSame(const List &list, const Expected &expected) {
+  ASSERT_EQ(list.size(), expected.size());
+  EXPECT_TRUE(std::equal(list.begin(), list.end(), expected.begin()));
+  EXPECT_TRUE(std::equal(std::make_reverse_iterator(list.end()),
+                         std::make_reverse_iterator(list.begin()),
+                         std::make_reverse_iterator(expected.end())));
+}
+
+TEST(unrolled_list, PacksElementsIntoChunks) {
+  s21::unrolled_list<int> list;
+  for (int i = 0; i < 1000; ++i) list.push_back(i);
+  EXPECT_EQ(list.size(), 1000);
+  size_t chunk = list.chunk_size;
+  EXPECT_EQ(list.chunk_count(), (1000 + chunk - 1) / chunk);
+  EXPECT_EQ(list.front(), 0);
+  EXPECT_EQ(list.back(), 999);
+
+  /* FIFO use frees chunks as they drain */
+  for (int i = 0; i < 990; ++i) list.pop_front();
+  EXPECT_EQ(list.chunk_count(), 1);
+  EXPECT_EQ(list.front(), 990);
+}
+
+TEST(unrolled_list, ConstructAndAssign) {
+  SmallList list = {"a", "b", "c", "d", "e"};
+  SmallList copy(list);
+  SmallList moved(std::move(list));
+  EXPECT_TRUE(list.empty());
+  expectSame(copy, std::list<std::string>{"a", "b", "c", "d", "e"});
+  expectSame(moved, copy);
+
+  list = moved;
+  moved = SmallList(3);
+  expectSame(moved, std::list<std::string>(3));
+  list.swap(moved);
+  EXPECT_EQ(list.size(), 3);
+  EXPECT_EQ(moved.back(), "e");
+  list.clear();
+  EXPECT_EQ(list.begin(), list.end());
+  EXPECT_EQ(list.chunk_count(), 0);
+}
+
+TEST(unrolled_list, InsertEraseMatchesStdList) {
+  std::mt19937 gen(11);
+  SmallList list;
+  std::list<std::string> expected;
+  for (int step = 0; step < 4000; ++step) {
+    size_t index = expected.empty() ? 0 : gen() % (expected.size() + 1);
+    auto it = std::next(list.begin(), index);
+    auto expected_it = std::next(expected.begin(), index);
+    switch (gen() % 6) {
+      case 0:
+        list.push_front(text(step));
+        expected.push_front(text(step));
+        break;
+      case 1:
+        list.pop_back();
+        if (!expected.empty()) expected.pop_back();
+        break;
+      case 2:
+      case 3: {
+        auto inserted = list.insert(it, text(step));
+        EXPECT_EQ(*inserted, text(step));
+        expected.insert(expected_it, text(step));
+        break;
+      }
+      default:
+        if (expected_it == expected.end()) break;
+        auto next = list.erase(it);
+        auto expected_next = expected.erase(expected_it);
+        EXPECT_EQ(next == list.end(), expected_next == expected.end());
+        if (expected_next != expected.end()) {
+          EXPECT_EQ(*next, *expected_next);
+        }
+    }
+    if (step % 97 == 0) expectSame(list, expected);
+  }
+  expectSame(list, expected);
+  EXPECT_LE(list.chunk_count(), list.size());
+}
+
+TEST(unrolled_list, SpliceInsideChunk) {
+  SmallList list = {"1", "2", "3", "4", "5", "6"};
+  SmallList other = {"a", "b", "c", "d", "e"};
+  list.splice(std::next(list.cbegin(), 2), other);
+  EXPECT_TRUE(other.empty());
+  expectSame(list, std::list<std::string>{"1", "2", "a", "b", "c", "d", "e",
+                                          "3", "4", "5", "6"});
+
+  SmallList tail = {"x"};
+  list.splice(list.cend(), tail);
+  SmallList head = {"0"};
+  list.splice(list.cbegin(), head);
+  EXPECT_EQ(list.front(), "0");
+  EXPECT_EQ(list.back(), "x");
+  EXPECT_EQ(list.size(), 13);
+}
+
+TEST(unrolled_list, SortMergeUniqueReverse) {
+  std::mt19937 gen(5);
+  SmallList list;
+  std::list<std::string> expected;
+  for (int i = 0; i < 500; ++i) {
+    std::string value = text(int(gen() % 100));
+    list.push_back(value);
+    expected.push_back(value);
+  }
+  list.sort();
+  expected.sort();
+  expectSame(list, expected);
+
+  SmallList other;
+  std::list<std::string> expected_other;
+  for (int i = 0; i < 300; i += 3) {
+    other.push_back(text(i));
+    expected_other.push_back(text(i));
+  }
+  other.sort();
+  expected_other.sort();
+  list.merge(other);
+  expected.merge(expected_other);
+  EXPECT_TRUE(other.empty());
+  expectSame(list, expected);
+
+  list.unique();
+  expected.unique();
+  expectSame(list, expected);
+
+  list.reverse();
+  expected.reverse();
+  expectSame(list, expected);
+}
+
+/* Orders by key only, to check that sort and merge keep equal keys in
+ * their original order */
+struct Keyed {
+  int key;
+  int order;
+  bool operator<(const Keyed &other) const { return key < other.key; }
+  bool operator==(const Keyed &other) const { return key == other.key; }
+};
+
+TEST(unrolled_list, SortIsStable) {
+  s21::unrolled_list<Keyed, 8> list;
+  for (int i = 0; i < 1000; ++i) list.push_back({(i * 7) % 10, i});
+  list.sort();
+  auto it = list.begin();
+  for (auto next = std::next(it); next != list.end(); ++it, ++next) {
+    ASSERT_TRUE(it->key < next->key ||
+                (it->key == next->key && it->order < next->order));
+  }
+}
+
+TEST(unrolled_list, InsertMany) {
+  SmallList list = {"a", "e"};
+  auto after = list.insert_many(std::next(list.cbegin()), "b", "c", "d");
+  EXPECT_EQ(*after, "e");
+  list.insert_many_back("f");
+  list.insert_many_front("0");
+  expectSame(list,
+             std::list<std::string>{"0", "a", "b", "c", "d", "e", "f"});
+}
+
+namespace {
+long tagged_live[3] = {0, 0, 0};
+
+/* Unequal across tags and never propagated; counts chunks per tag, so a
+ * chunk freed through the wrong allocator shows up as a mismatch */
+template <typename T>
+struct TaggedAllocator {
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::false_type;
+  using propagate_on_container_move_assignment = std::false_type;
+  using propagate_on_container_swap = std::false_type;
+  using is_always_equal = std::false_type;
+
+  int tag;
+
+  explicit TaggedAllocator(int t = 0) : tag(t) {}
+  template <typename U>
+  TaggedAllocator(const TaggedAllocator<U> &other) : tag(other.tag) {}
+
+  T *allocate(size_t n) {
+    ++tagged_live[tag];
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *p, size_t n) {
+    --tagged_live[tag];
+    std::allocator<T>().deallocate(p, n);
+  }
+  bool operator==(const TaggedAllocator &other) const {
+    return tag == other.tag;
+  }
+  bool operator!=(const TaggedAllocator &other) const {
+    return tag != other.tag;
+  }
+};
+}  // namespace
+
+TEST(unrolled_list, AllocatorsStayUnlessPropagated) {
+  using tagged =
+      s21::unrolled_list<std::string, 4, TaggedAllocator<std::string>>;
+  static_assert(!std::is_nothrow_move_assignable<tagged>::value);
+  static_assert(std::is_nothrow_move_assignable<SmallList>::value);
+  {
+    tagged first(TaggedAllocator<std::string>(1));
+    tagged second(TaggedAllocator<std::string>(2));
+    for (int i = 0; i < 30; ++i) first.push_back(std::to_string(i));
+    second.push_back("x");
+
+    second = first;
+    EXPECT_EQ(second.get_allocator().tag, 2);
+    ASSERT_EQ(second.size(), 30);
+    EXPECT_EQ(second.back(), "29");
+
+    second.push_back("moved");
+    first = std::move(second);
+    EXPECT_EQ(first.get_allocator().tag, 1);
+    EXPECT_EQ(second.get_allocator().tag, 2);
+    ASSERT_EQ(first.size(), 31);
+    EXPECT_EQ(first.back(), "moved");
+    EXPECT_TRUE(second.empty());
+
+    tagged third(TaggedAllocator<std::string>(1));
+    third = std::move(first);
+    EXPECT_EQ(third.size(), 31);
+    EXPECT_EQ(third.front(), "0");
+
+    using pointers = s21::unrolled_list<std::unique_ptr<int>, 4,
+                                        TaggedAllocator<std::unique_ptr<int>>>;
+    pointers source(TaggedAllocator<std::unique_ptr<int>>(1));
+    pointers target(TaggedAllocator<std::unique_ptr<int>>(2));
+    for (int i = 0; i < 10; ++i) source.push_back(std::make_unique<int>(i));
+    target = std::move(source);
+    ASSERT_EQ(target.size(), 10);
+    EXPECT_EQ(*target.back(), 9);
+  }
+  EXPECT_EQ(tagged_live[1], 0);
+  EXPECT_EQ(tagged_live[2], 0);
+}
@@ -67,3 +67,85 @@ TEST(S21VectorcapacityTest, Capacity4) {
   EXPECT_EQ(v[1], 2);
   EXPECT_EQ(v[2], 5);
 }
+
+namespace {
+struct Tracked {
+  static int defaults;
+  static int alive;
+  int value;
+
+  Tracked() : value(0) { ++defaults, ++alive; }
+  explicit Tracked(int v) : value(v) { ++alive; }
+  Tracked(const Tracked& other) : value(other.value) { ++alive; }
+  Tracked(Tracked&& other) noexcept : value(other.value) { ++alive; }
+  Tracked& operator=(const Tracked&) = default;
+  Tracked& operator=(Tracked&&) = default;
+  ~Tracked() { --alive; }
+};
+int Tracked::defaults = 0;
+int Tracked::alive = 0;
+}  // namespace
+
+TEST(S21VectorcapacityTest, ReserveDoesNotConstruct) {
+  Tracked::defaults = 0;
+  Tracked::alive = 0;
+  {
+    vector<Tracked> v;
+    v.reserve(100);
+    EXPECT_EQ(Tracked::alive, 0);
+
+    for (int i = 0; i < 1000; ++i) v.emplace_back(i);
+    EXPECT_EQ(Tracked::alive, 1000);
+    EXPECT_EQ(Tracked::defaults, 0);
+
+    v.pop_back();
+    v.erase(v.begin());
+    EXPECT_EQ(Tracked::alive, 998);
+    EXPECT_EQ(v[0].value, 1);
+
+    v.shrink_to_fit();
+    EXPECT_EQ(Tracked::alive, 998);
+
+    v.clear();
+    EXPECT_EQ(Tracked::alive, 0);
+    EXPECT_EQ(v.capacity(), 998);
+
+    vector<Tracked> sized(5);
+    EXPECT_EQ(Tracked::defaults, 5);
+  }
+  EXPECT_EQ(Tracked::alive, 0);
+}
+
+TEST(S21VectorcapacityTest, GrowWithSelfReference) {
+  vector<std::string> v{"first"};
+  for (int i = 0; i < 10; ++i) v.push_back(v[0]);
+  v.insert(v.begin(), v[3]);
+  v.emplace(v.cbegin() + 2, v[0]);
+
+  EXPECT_EQ(v.size(), 13);
+  for (size_t i = 0; i < v.size(); ++i) EXPECT_EQ(v[i], "first");
+}
+
+TEST(S21VectorcapacityTest, ReserveHoldsForThrowingMoves) {
+  /* a move that may throw, so a full buffer is copied, not moved */
+  struct Loud {
+    int value;
+    explicit Loud(int v) : value(v) {}
+    Loud(const Loud& other) : value(other.value) {}
+    Loud(Loud&& other) noexcept(false) : value(other.value) {}
+  };
+  static_assert(!std::is_nothrow_move_constructible<Loud>::value);
+
+  vector<Loud> v;
+  v.reserve(100);
+  const Loud* data = v.data();
+  for (int i = 0; i < 50; ++i) v.emplace_back(i);
+  for (int i = 50; i < 90; ++i) v.push_back(Loud(i));
+  v.insert(v.end(), 10, Loud(90));
+
+  EXPECT_EQ(v.data(), data);
+  EXPECT_EQ(v.capacity(), 100);
+  ASSERT_EQ(v.size(), 100);
+  EXPECT_EQ(v[89].value, 89);
+  EXPECT_EQ(v[99].value, 90);
+}
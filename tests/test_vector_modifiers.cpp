@@ -1,3 +1,6 @@
+#include <iterator>
+#include <sstream>
+#include <string>
 #include <vector>
 
 #include "tests_init.h"
@@ -110,3 +113,170 @@ TEST(S21VectorModifyTest, Modify7) {
   EXPECT_EQ(v2.front(), 19);
   EXPECT_EQ(v2.back(), 1);
 }
+
+TEST(S21VectorModifyTest, MoveOnlyElements) {
+  vector<std::unique_ptr<int>> v;
+  v.push_back(std::make_unique<int>(1));
+  v.emplace_back(new int(3));
+  v.insert(v.begin() + 1, std::make_unique<int>(2));
+  v.emplace(v.cbegin(), new int(0));
+
+  ASSERT_EQ(v.size(), 4);
+  for (int i = 0; i < 4; ++i) EXPECT_EQ(*v[i], i);
+
+  v.erase(v.begin());
+  EXPECT_EQ(*v[0], 1);
+}
+
+TEST(S21VectorModifyTest, InsertManyForwards) {
+  std::string moved(100, 'x');
+  vector<std::string> v{"a"};
+
+  v.insert_many_back(std::move(moved), "b", std::string(3, 'c'));
+
+  ASSERT_EQ(v.size(), 4);
+  EXPECT_EQ(v[1], std::string(100, 'x'));
+  EXPECT_EQ(v[2], "b");
+  EXPECT_EQ(v[3], "ccc");
+  EXPECT_TRUE(moved.empty());
+}
+
+TEST(S21VectorModifyTest, RangeInsert) {
+  vector<int> v{1, 2, 7, 8};
+  std::vector<int> chunk{3, 4, 5, 6};
+
+  auto it = v.insert(v.begin() + 2, chunk.begin(), chunk.end());
+  EXPECT_EQ(*it, 3);
+  EXPECT_EQ(v.capacity(), 8);
+  ASSERT_EQ(v.size(), 8);
+  for (int i = 0; i < 8; ++i) EXPECT_EQ(v[i], i + 1);
+
+  s21::list<int> tail{9, 10};
+  v.insert(v.end(), tail.begin(), tail.end());
+  v.insert(v.begin(), {-1, 0});
+  EXPECT_EQ(v.size(), 12);
+  EXPECT_EQ(v.front(), -1);
+  EXPECT_EQ(v.back(), 10);
+}
+
+TEST(S21VectorModifyTest, FillInsert) {
+  vector<std::string> v{"a", "b"};
+  v.reserve(10);
+
+  v.insert(v.begin() + 1, 3, v[0]);
+  ASSERT_EQ(v.size(), 5);
+  EXPECT_EQ(v[0], "a");
+  EXPECT_EQ(v[3], "a");
+  EXPECT_EQ(v[4], "b");
+
+  v.insert(v.begin(), 0, std::string("x"));
+  EXPECT_EQ(v.size(), 5);
+}
+
+TEST(S21VectorModifyTest, RangeErase) {
+  vector<std::string> v{"0", "1", "2", "3", "4", "5"};
+
+  auto it = v.erase(v.begin() + 1, v.begin() + 4);
+  EXPECT_EQ(*it, "4");
+  ASSERT_EQ(v.size(), 3);
+  EXPECT_EQ(v[0], "0");
+  EXPECT_EQ(v[2], "5");
+
+  it = v.erase(v.begin(), v.end());
+  EXPECT_EQ(it, v.end());
+  EXPECT_TRUE(v.empty());
+  EXPECT_ANY_THROW(v.erase(v.begin() + 1, v.begin() + 2));
+}
+
+TEST(S21VectorModifyTest, AssignAndAppend) {
+  vector<int> v{1, 2, 3};
+
+  v.assign(5, v[1]);
+  ASSERT_EQ(v.size(), 5);
+  for (int i = 0; i < 5; ++i) EXPECT_EQ(v[i], 2);
+
+  v.assign({7, 8});
+  ASSERT_EQ(v.size(), 2);
+  EXPECT_EQ(v.capacity(), 5);
+
+  std::vector<int> more{9, 10, 11};
+  v.append_range(more);
+  int raw[] = {12, 13};
+  v.append_range(raw);
+  ASSERT_EQ(v.size(), 7);
+  EXPECT_EQ(v[2], 9);
+  EXPECT_EQ(v.back(), 13);
+
+  std::vector<int> src{4, 5};
+  v.assign(src.begin(), src.end());
+  EXPECT_EQ(v.size(), 2);
+  EXPECT_EQ(v.back(), 5);
+
+  /* a range inside the vector itself */
+  v.assign({1, 2, 3, 4, 5});
+  v.assign(v.begin() + 1, v.end());
+  ASSERT_EQ(v.size(), 4);
+  EXPECT_EQ(v[0], 2);
+  EXPECT_EQ(v[3], 5);
+  vector<std::string> words{"alpha", "beta", "gamma"};
+  words.assign(words.data() + 1, words.data() + 3);
+  ASSERT_EQ(words.size(), 2);
+  EXPECT_EQ(words[0], "beta");
+  EXPECT_EQ(words[1], "gamma");
+}
+
+/* Yields a stream once, as append_range() sees it */
+struct StreamRange {
+  std::istream& in;
+  std::istream_iterator<int> begin() const {
+    return std::istream_iterator<int>(in);
+  }
+  std::istream_iterator<int> end() const { return {}; }
+};
+
+TEST(S21VectorModifyTest, SinglePassRanges) {
+  std::istringstream in("1 2 3 4");
+  vector<int> v;
+  v.assign(std::istream_iterator<int>(in), std::istream_iterator<int>());
+  ASSERT_EQ(v.size(), 4);
+  for (int i = 0; i < 4; ++i) EXPECT_EQ(v[i], i + 1);
+
+  std::istringstream more("7 8 9");
+  v.insert(v.begin() + 1, std::istream_iterator<int>(more),
+           std::istream_iterator<int>());
+  ASSERT_EQ(v.size(), 7);
+  int expected[] = {1, 7, 8, 9, 2, 3, 4};
+  for (int i = 0; i < 7; ++i) EXPECT_EQ(v[i], expected[i]);
+
+  std::istringstream tail("5 6");
+  v.append_range(StreamRange{tail});
+  ASSERT_EQ(v.size(), 9);
+  EXPECT_EQ(v[7], 5);
+  EXPECT_EQ(v[8], 6);
+}
+
+TEST(S21VectorModifyTest, BulkScans) {
+  vector<double> v(100);
+  v.fill(0.5);
+  v[60] = -2.0;
+  v[70] = 4.0;
+
+  EXPECT_EQ(v.find(4.0) - v.begin(), 70);
+  EXPECT_EQ(v.find(1.0), v.end());
+  EXPECT_EQ(v.count(0.5), 98);
+  EXPECT_EQ(v.min(), -2.0);
+  EXPECT_EQ(v.max(), 4.0);
+  EXPECT_DOUBLE_EQ(v.sum(), 51.0);
+
+  vector<double> w(v);
+  EXPECT_EQ(v.compare(w), 0);
+  EXPECT_DOUBLE_EQ(v.dot(w), 0.25 * 98 + 4.0 + 16.0);
+  w.pop_back();
+  EXPECT_EQ(v.compare(w), 1);
+  EXPECT_THROW(v.dot(w), std::invalid_argument);
+
+  vector<int> empty;
+  EXPECT_EQ(empty.sum(), 0);
+  EXPECT_EQ(empty.find(1), empty.end());
+  EXPECT_THROW(empty.min(), std::out_of_range);
+}